@@ -76,6 +76,35 @@ PERF_TEST_P( TestStereoCorrespSGBM, DISABLED_TooLongInDebug_SGBM, Combine(Values
     SANITY_CHECK(dst, .01, ERROR_RELATIVE);
 }
 
+typedef tuple<Size, int> SGBM_HHParams;
+typedef TestBaseWithParam<SGBM_HHParams> TestStereoCorrespSGBM_HH;
+
+#ifndef _DEBUG
+PERF_TEST_P( TestStereoCorrespSGBM_HH, SGBM_HH, Combine(Values(Size(1280,720),Size(640,480)), Values(128)) )
+#else
+PERF_TEST_P( TestStereoCorrespSGBM_HH, DISABLED_TooLongInDebug_SGBM_HH, Combine(Values(Size(1280,720),Size(640,480)), Values(128)) )
+#endif
+{
+    Size sz              = get<0>(GetParam());
+    int num_disparities  = get<1>(GetParam());
+
+    Mat src_left(sz, CV_8UC3);
+    Mat src_right(sz, CV_8UC3);
+    Mat dst(sz, CV_16S);
+
+    MakeArtificialExample(src_left,src_right);
+
+    int wsize = 3;
+    int P1 = 8*src_left.channels()*wsize*wsize;
+    TEST_CYCLE()
+    {
+        Ptr<StereoSGBM> sgbm = StereoSGBM::create(0,num_disparities,wsize,P1,4*P1,1,63,25,0,0,StereoSGBM::MODE_HH);
+        sgbm->compute(src_left,src_right,dst);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 typedef tuple<Size, int> BMParams;
 typedef TestBaseWithParam<BMParams> TestStereoCorrespBM;
 
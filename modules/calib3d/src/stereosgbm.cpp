@@ -962,6 +962,613 @@ static void computeDisparitySGBM( const Mat& img1, const Mat& img2,
     }
 }
 
+/*
+ Parallel version of computeDisparitySGBM() for MODE_SGBM and MODE_HH.
+
+ The rows are processed in tiles of tileRows rows. For every tile and every pass:
+  - the matching cost C is computed: the pixel costs and their horizontal sums are computed in parallel
+    for the rows, then the vertical sums are accumulated down the tile in parallel for the columns;
+  - the horizontal direction r=(-dx,0) is aggregated in parallel for the rows;
+  - the vertical and the diagonal directions r=(-1,-dy), (0,-dy), (1,-dy) are aggregated row by row,
+    in parallel for the columns;
+  - on the last pass the best disparity is selected in parallel for the rows (MODE_SGBM also aggregates
+    the r=(dx,0) direction at this step, like computeDisparitySGBM() does).
+
+ Each element of C, L_r and S is computed with the same operations in the same order as in
+ computeDisparitySGBM(), so the result does not depend on the tile size and the number of threads.
+
+ MODE_SGBM keeps C and S for a single tile only. MODE_HH keeps S for the whole image between the passes,
+ while C is computed again on the second pass starting from the C rows saved at the tile borders,
+ so the memory consumption is halved comparing to computeDisparitySGBM().
+*/
+class ParallelSGBM
+{
+public:
+    ParallelSGBM(const Mat& img1, const Mat& img2, Mat& disp1, const StereoSGBMParams& params);
+    void compute();
+
+private:
+    void calcHSum(int k, CostType* pixDiff, PixType* tempBuf) const;
+    void calcCost(int y0, int y1, const CostType* Cprev, const Range& xrange) const;
+    void aggregateHorizontal(int y, int dx, CostType* Lbuf) const;
+    void aggregateVertical(int y, uchar lrID, const Range& xrange) const;
+    void selectDisparity(int y, CostType* Lbuf, DispType* disp2ptr, CostType* disp2cost) const;
+    void updateHSum(int k1, int k2);
+    void clearLr();
+
+    inline CostType* getHSumBuf(int k) const
+    {
+        return hsumBuf + (k % hsumRows) * costWidth;
+    }
+    inline CostType* getCBuf(int y) const
+    {
+        return Cbuf + (y - tileY0) * costWidth;
+    }
+    inline CostType* getCBorderBuf(int tile) const
+    {
+        return Cborder + (fullDP ? tile : 0) * costWidth;
+    }
+    inline CostType* getSBuf(int y) const
+    {
+        return Sbuf + (fullDP ? y : y - tileY0) * costWidth;
+    }
+    // L_r(.,.) and min_k L_r(.,.) of the directions r=(-1,-dy), (0,-dy), (1,-dy) are stored for x=-1..width1.
+    // Lr[] has an additional leading block, so Lr(.)[-1] is always accessible
+    inline CostType* getLr(uchar id, int x, int dir) const
+    {
+        return Lr[id] + ((x + 1)*NR_VERT + dir + 1) * Dlra;
+    }
+    inline CostType* getMinLr(uchar id, int x, int dir) const
+    {
+        return minLr[id] + (x + 1)*NR_VERT + dir;
+    }
+
+    enum { NR_VERT = 3, TAB_OFS = 256*4, TAB_SIZE = 256 + TAB_OFS*2 };
+
+    const Mat& img1;
+    const Mat& img2;
+    Mat& disp1;
+
+    int minD, maxD, D, Da, Dlra;
+    int width, height, minX1, maxX1, width1;
+    int SW2, SH2, P1, P2;
+    int uniquenessRatio, disp12MaxDiff;
+    bool fullDP;
+    size_t costWidth;
+
+    int tileRows, ntiles, tileY0;
+    int hsumRows, hsumFirst, hsumLast;
+
+    PixType* clipTab;
+    CostType* hsumBuf;
+    CostType* Cbuf;
+    CostType* Cborder;
+    CostType* Sbuf;
+    CostType* Lr[2];
+    CostType* minLr[2];
+    utils::BufferArea area;
+};
+
+// the size of cost buffers of a tile in MODE_SGBM
+static const size_t SGBM_TILE_BUF_SIZE = (size_t)1 << 26;
+
+ParallelSGBM::ParallelSGBM(const Mat& _img1, const Mat& _img2, Mat& _disp1, const StereoSGBMParams& params)
+    : img1(_img1), img2(_img2), disp1(_disp1), tileY0(0), hsumFirst(0), hsumLast(-1),
+      clipTab(NULL), hsumBuf(NULL), Cbuf(NULL), Cborder(NULL), Sbuf(NULL)
+{
+    minD = params.minDisparity;
+    maxD = minD + params.numDisparities;
+    D = params.numDisparities;
+    Da = (int)alignSize(D, VTraits<v_int16>::vlanes());
+    Dlra = Da + VTraits<v_int16>::vlanes();
+    width = disp1.cols;
+    height = disp1.rows;
+    minX1 = std::max(maxD, 0);
+    maxX1 = width + std::min(minD, 0);
+    width1 = maxX1 - minX1;
+    SW2 = params.calcSADWindowSize().width/2;
+    SH2 = params.calcSADWindowSize().height/2;
+    P1 = params.P1 > 0 ? params.P1 : 2;
+    P2 = std::max(params.P2 > 0 ? params.P2 : 5, P1+1);
+    uniquenessRatio = params.uniquenessRatio >= 0 ? params.uniquenessRatio : 10;
+    disp12MaxDiff = params.disp12MaxDiff > 0 ? params.disp12MaxDiff : 1;
+    fullDP = params.isFullDP();
+    costWidth = (size_t)width1 * Da;
+
+    // C, S and the horizontal sums of a tile, but not less than a row per thread
+    tileRows = (int)(SGBM_TILE_BUF_SIZE / (costWidth * sizeof(CostType) * 3));
+    tileRows = std::min(std::max(tileRows, getNumThreads()), height);
+    ntiles = (height + tileRows - 1) / tileRows;
+    hsumRows = tileRows + SH2*2 + 1;
+
+    area.allocate(clipTab, TAB_SIZE, CV_SIMD_WIDTH);
+    area.allocate(hsumBuf, costWidth * hsumRows, CV_SIMD_WIDTH);
+    area.allocate(Cbuf, costWidth * tileRows, CV_SIMD_WIDTH);
+    area.allocate(Cborder, costWidth * (fullDP ? ntiles : 1), CV_SIMD_WIDTH);
+    area.allocate(Sbuf, costWidth * (fullDP ? height : tileRows), CV_SIMD_WIDTH);
+    for (int i = 0; i < 2; i++)
+    {
+        Lr[i] = NULL;
+        minLr[i] = NULL;
+        area.allocate(Lr[i], ((width1 + 2)*NR_VERT + 1) * Dlra, CV_SIMD_WIDTH);
+        area.allocate(minLr[i], (width1 + 2)*NR_VERT, CV_SIMD_WIDTH);
+    }
+    area.commit();
+
+    const int ftzero = std::max(params.preFilterCap, 15) | 1;
+    for (int i = 0; i < (int)TAB_SIZE; i++)
+        clipTab[i] = (PixType)(std::min(std::max(i - (int)TAB_OFS, -ftzero), ftzero) + ftzero);
+}
+
+// computes the pixel costs of the row k and their horizontal sums
+void ParallelSGBM::calcHSum(int k, CostType* pixDiff, PixType* tempBuf) const
+{
+    int x, d;
+    CostType* hsumAdd = getHSumBuf(k);
+    calcPixelCostBT( img1, img2, k, minD, maxD, pixDiff, tempBuf, clipTab + TAB_OFS );
+
+    memset(hsumAdd, 0, Da*sizeof(CostType));
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    v_int16 h_scale = vx_setall_s16((short)SW2 + 1);
+    for( d = 0; d < Da; d += VTraits<v_int16>::vlanes() )
+    {
+        v_int16 v_hsumAdd = v_mul(vx_load_aligned(pixDiff + d), h_scale);
+        for( x = Da; x <= SW2*Da; x += Da )
+            v_hsumAdd = v_add(v_hsumAdd, vx_load_aligned(pixDiff + x + d));
+        v_store_aligned(hsumAdd + d, v_hsumAdd);
+    }
+#else
+    for (d = 0; d < D; d++)
+    {
+        hsumAdd[d] = (CostType)(pixDiff[d] * (SW2 + 1));
+        for( x = Da; x <= SW2*Da; x += Da )
+            hsumAdd[d] = (CostType)(hsumAdd[d] + pixDiff[x + d]);
+    }
+#endif
+
+    // computeDisparitySGBM() sums up the rows of the first window in a different order
+    const bool firstWindow = k <= SH2;
+    for( x = Da; x < width1*Da; x += Da )
+    {
+        const CostType* pixAdd = pixDiff + std::min(x + SW2*Da, (width1-1)*Da);
+        const CostType* pixSub = pixDiff + std::max(x - (SW2+1)*Da, 0);
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        for( d = 0; d < Da; d += VTraits<v_int16>::vlanes() )
+        {
+            v_int16 hv = firstWindow ?
+                v_sub(v_add(vx_load_aligned(hsumAdd + x - Da + d), vx_load_aligned(pixAdd + d)), vx_load_aligned(pixSub + d)) :
+                v_add(v_sub(vx_load_aligned(hsumAdd + x - Da + d), vx_load_aligned(pixSub + d)), vx_load_aligned(pixAdd + d));
+            v_store_aligned(hsumAdd + x + d, hv);
+        }
+#else
+        CV_UNUSED(firstWindow);
+        for( d = 0; d < D; d++ )
+            hsumAdd[x + d] = (CostType)(hsumAdd[x - Da + d] + pixAdd[d] - pixSub[d]);
+#endif
+    }
+}
+
+// makes the horizontal sums of the rows k1..k2 available, reusing the rows computed for the previous tile
+void ParallelSGBM::updateHSum(int k1, int k2)
+{
+    CV_Assert(k2 - k1 < hsumRows);
+    std::vector<int> rows;
+    for (int k = k1; k <= k2; k++)
+    {
+        if (k < hsumFirst || k > hsumLast)
+            rows.push_back(k);
+    }
+    parallel_for_(Range(0, (int)rows.size()), [&](const Range& range)
+    {
+        CostType* pixDiff = NULL;
+        PixType* tempBuf = NULL;
+        utils::BufferArea aux_area;
+        aux_area.allocate(pixDiff, costWidth, CV_SIMD_WIDTH);
+        aux_area.allocate(tempBuf, width * (4 * img1.channels() + 2), CV_SIMD_WIDTH);
+        aux_area.commit();
+        for (int i = range.start; i < range.end; i++)
+            calcHSum(rows[i], pixDiff, tempBuf);
+    }, getNumThreads());
+    hsumFirst = k1;
+    hsumLast = k2;
+}
+
+// computes C for the rows y0..y1-1 of the current tile and for the columns of xrange,
+// Cprev is C of the row y0-1
+void ParallelSGBM::calcCost(int y0, int y1, const CostType* Cprev, const Range& xrange) const
+{
+    const int i0 = xrange.start*Da, i1 = xrange.end*Da;
+    for (int y = y0; y < y1; y++)
+    {
+        CostType* C = getCBuf(y);
+        int i = i0, d;
+        if (y == 0)
+        {
+            for (i = i0; i < i1; i++)
+                C[i] = (CostType)P2; // add P2 to every C(x,y). it saves a few operations in the inner loops
+            for (int k = 0; k <= SH2; k++)
+            {
+                const CostType* hsumAdd = getHSumBuf(std::min(k, height-1));
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+                v_int16 v_scale = vx_setall_s16(k == 0 ? (short)SH2 + 1 : 1);
+                for (i = i0; i < i1; i += VTraits<v_int16>::vlanes())
+                    v_store_aligned(C + i, v_add(vx_load_aligned(C + i), v_mul(vx_load_aligned(hsumAdd + i), v_scale)));
+#else
+                int scale = k == 0 ? SH2 + 1 : 1;
+                for (i = i0; i < i1; i++)
+                    C[i] = (CostType)(C[i] + hsumAdd[i] * scale);
+#endif
+            }
+            continue;
+        }
+
+        const CostType* Cp = y == y0 ? Cprev : getCBuf(y - 1);
+        const CostType* hsumAdd = getHSumBuf(std::min(y + SH2, height-1));
+        const CostType* hsumSub = getHSumBuf(std::max(y - SH2 - 1, 0));
+        if (i0 == 0 && y + SH2 < height)
+        {
+            // the first pixel of a new row is accumulated in a different order, see computeDisparitySGBM()
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+            for (d = 0; d < Da; d += VTraits<v_int16>::vlanes())
+                v_store_aligned(C + d, v_sub(v_add(vx_load_aligned(Cp + d), vx_load_aligned(hsumAdd + d)), vx_load_aligned(hsumSub + d)));
+#else
+            for (d = 0; d < D; d++)
+                C[d] = (CostType)(Cp[d] + hsumAdd[d] - hsumSub[d]);
+#endif
+            i = Da;
+        }
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        for (; i < i1; i += VTraits<v_int16>::vlanes())
+            v_store_aligned(C + i, v_add(v_sub(vx_load_aligned(Cp + i), vx_load_aligned(hsumSub + i)), vx_load_aligned(hsumAdd + i)));
+#else
+        for (; i < i1; i++)
+            C[i] = (CostType)(Cp[i] + hsumAdd[i] - hsumSub[i]);
+#endif
+    }
+}
+
+// aggregates the direction r=(-dx,0) of the row y and adds it to S
+void ParallelSGBM::aggregateHorizontal(int y, int dx, CostType* Lbuf) const
+{
+    const CostType MAX_COST = SHRT_MAX;
+    const CostType* C = getCBuf(y);
+    CostType* S = getSBuf(y);
+    CostType* Lr_p0 = Lbuf + Dlra;
+    CostType* Lr_p = Lbuf + Dlra*2;
+    int minLr_p0 = 0;
+    memset(Lr_p0, 0, Dlra*sizeof(CostType));
+    Lr_p0[-1] = Lr_p0[D] = Lr_p[-1] = Lr_p[D] = MAX_COST;
+
+    const int x1 = dx > 0 ? 0 : width1 - 1, x2 = dx > 0 ? width1 : -1;
+    for (int x = x1; x != x2; x += dx)
+    {
+        const int delta0 = P2 + minLr_p0;
+        const CostType* Cp = C + x*Da;
+        CostType* Sp = S + x*Da;
+        int d = 0, minL0 = MAX_COST;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        v_int16 _P1 = vx_setall_s16((short)P1);
+        v_int16 _delta0 = vx_setall_s16((short)delta0);
+        v_int16 _minL0 = vx_setall_s16((short)MAX_COST);
+        for( ; d <= D - VTraits<v_int16>::vlanes(); d += VTraits<v_int16>::vlanes() )
+        {
+            v_int16 L0 = v_add(v_sub(v_min(v_min(v_min(vx_load_aligned(Lr_p0 + d), v_add(vx_load(Lr_p0 + d - 1), _P1)), v_add(vx_load(Lr_p0 + d + 1), _P1)), _delta0), _delta0), vx_load_aligned(Cp + d));
+            v_store_aligned(Lr_p + d, L0);
+            _minL0 = v_min(_minL0, L0);
+            v_store_aligned(Sp + d, v_add(vx_load_aligned(Sp + d), L0));
+        }
+        minL0 = v_reduce_min(_minL0);
+#endif
+        for( ; d < D; d++ )
+        {
+            int L0 = Cp[d] + std::min((int)Lr_p0[d], std::min(Lr_p0[d-1] + P1, std::min(Lr_p0[d+1] + P1, delta0))) - delta0;
+            Lr_p[d] = (CostType)L0;
+            minL0 = std::min(minL0, L0);
+            Sp[d] = saturate_cast<CostType>(Sp[d] + L0);
+        }
+        minLr_p0 = minL0;
+        std::swap(Lr_p0, Lr_p);
+    }
+}
+
+// aggregates the directions r=(-1,-dy), (0,-dy), (1,-dy) of the row y for the columns of xrange and adds them to S,
+// Lr[1-lrID] keeps L_r of the previous row
+void ParallelSGBM::aggregateVertical(int y, uchar lrID, const Range& xrange) const
+{
+    const CostType MAX_COST = SHRT_MAX;
+    const CostType* C = getCBuf(y);
+    CostType* S = getSBuf(y);
+    for (int x = xrange.start; x < xrange.end; x++)
+    {
+        int delta1 = P2 + *getMinLr(1 - lrID, x - 1, 0);
+        int delta2 = P2 + *getMinLr(1 - lrID, x,     1);
+        int delta3 = P2 + *getMinLr(1 - lrID, x + 1, 2);
+
+        const CostType* Lr_p1 = getLr(1 - lrID, x - 1, 0);
+        const CostType* Lr_p2 = getLr(1 - lrID, x,     1);
+        const CostType* Lr_p3 = getLr(1 - lrID, x + 1, 2);
+
+        CostType* Lr_p = getLr(lrID, x, 0);
+        const CostType* Cp = C + x*Da;
+        CostType* Sp = S + x*Da;
+
+        CostType* minL = getMinLr(lrID, x, 0);
+        int d = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        v_int16 _P1 = vx_setall_s16((short)P1);
+
+        v_int16 _delta1 = vx_setall_s16((short)delta1);
+        v_int16 _delta2 = vx_setall_s16((short)delta2);
+        v_int16 _delta3 = vx_setall_s16((short)delta3);
+        v_int16 _minL1 = vx_setall_s16((short)MAX_COST);
+        v_int16 _minL2 = vx_setall_s16((short)MAX_COST);
+        v_int16 _minL3 = vx_setall_s16((short)MAX_COST);
+
+        for( ; d <= D - VTraits<v_int16>::vlanes(); d += VTraits<v_int16>::vlanes() )
+        {
+            v_int16 Cpd = vx_load_aligned(Cp + d);
+            v_int16 Spd = vx_load_aligned(Sp + d);
+            v_int16 L;
+
+            L = v_add(v_sub(v_min(v_min(v_min(vx_load_aligned(Lr_p1 + d), v_add(vx_load(Lr_p1 + d - 1), _P1)), v_add(vx_load(Lr_p1 + d + 1), _P1)), _delta1), _delta1), Cpd);
+            v_store_aligned(Lr_p + d, L);
+            _minL1 = v_min(_minL1, L);
+            Spd = v_add(Spd, L);
+
+            L = v_add(v_sub(v_min(v_min(v_min(vx_load_aligned(Lr_p2 + d), v_add(vx_load(Lr_p2 + d - 1), _P1)), v_add(vx_load(Lr_p2 + d + 1), _P1)), _delta2), _delta2), Cpd);
+            v_store_aligned(Lr_p + d + Dlra, L);
+            _minL2 = v_min(_minL2, L);
+            Spd = v_add(Spd, L);
+
+            L = v_add(v_sub(v_min(v_min(v_min(vx_load_aligned(Lr_p3 + d), v_add(vx_load(Lr_p3 + d - 1), _P1)), v_add(vx_load(Lr_p3 + d + 1), _P1)), _delta3), _delta3), Cpd);
+            v_store_aligned(Lr_p + d + Dlra*2, L);
+            _minL3 = v_min(_minL3, L);
+            Spd = v_add(Spd, L);
+
+            v_store_aligned(Sp + d, Spd);
+        }
+        minL[0] = v_reduce_min(_minL1);
+        minL[1] = v_reduce_min(_minL2);
+        minL[2] = v_reduce_min(_minL3);
+#else
+        minL[0] = MAX_COST;
+        minL[1] = MAX_COST;
+        minL[2] = MAX_COST;
+#endif
+        for( ; d < D; d++ )
+        {
+            int Cpd = Cp[d], L;
+            int Spd = Sp[d];
+
+            L = Cpd + std::min((int)Lr_p1[d], std::min(Lr_p1[d - 1] + P1, std::min(Lr_p1[d + 1] + P1, delta1))) - delta1;
+            Lr_p[d] = (CostType)L;
+            minL[0] = std::min(minL[0], (CostType)L);
+            Spd += L;
+
+            L = Cpd + std::min((int)Lr_p2[d], std::min(Lr_p2[d - 1] + P1, std::min(Lr_p2[d + 1] + P1, delta2))) - delta2;
+            Lr_p[d + Dlra] = (CostType)L;
+            minL[1] = std::min(minL[1], (CostType)L);
+            Spd += L;
+
+            L = Cpd + std::min((int)Lr_p3[d], std::min(Lr_p3[d - 1] + P1, std::min(Lr_p3[d + 1] + P1, delta3))) - delta3;
+            Lr_p[d + Dlra*2] = (CostType)L;
+            minL[2] = std::min(minL[2], (CostType)L);
+            Spd += L;
+
+            Sp[d] = saturate_cast<CostType>(Spd);
+        }
+    }
+}
+
+// finds the best disparity for every pixel of the row y and validates it
+void ParallelSGBM::selectDisparity(int y, CostType* Lbuf, DispType* disp2ptr, CostType* disp2cost) const
+{
+    const int DISP_SHIFT = StereoMatcher::DISP_SHIFT;
+    const int DISP_SCALE = (1 << DISP_SHIFT);
+    const CostType MAX_COST = SHRT_MAX;
+    const int INVALID_DISP = minD - 1, INVALID_DISP_SCALED = INVALID_DISP*DISP_SCALE;
+
+    if (!fullDP)
+        aggregateHorizontal(y, -1, Lbuf);
+
+    DispType* disp1ptr = disp1.ptr<DispType>(y);
+    const CostType* S = getSBuf(y);
+    int x = 0, d;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    v_int16 v_inv_dist = vx_setall_s16((DispType)INVALID_DISP_SCALED);
+    v_int16 v_max_cost = vx_setall_s16(MAX_COST);
+    for( ; x <= width - VTraits<v_int16>::vlanes(); x += VTraits<v_int16>::vlanes() )
+    {
+        v_store(disp1ptr + x, v_inv_dist);
+        v_store(disp2ptr + x, v_inv_dist);
+        v_store(disp2cost + x, v_max_cost);
+    }
+#endif
+    for( ; x < width; x++ )
+    {
+        disp1ptr[x] = disp2ptr[x] = (DispType)INVALID_DISP_SCALED;
+        disp2cost[x] = MAX_COST;
+    }
+
+    for( x = width1 - 1; x >= 0; x-- )
+    {
+        const CostType* Sp = S + x*Da;
+        CostType minS = MAX_COST;
+        short bestDisp = -1;
+
+        d = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        v_int16 _minS = vx_setall_s16(MAX_COST), _bestDisp = vx_setall_s16(-1);
+        for( ; d <= D - VTraits<v_int16>::vlanes(); d += VTraits<v_int16>::vlanes() )
+        {
+            v_int16 L0 = vx_load_aligned(Sp + d);
+            _bestDisp = v_select(v_gt(_minS, L0), vx_setall_s16((short)d), _bestDisp);
+            _minS = v_min( L0, _minS );
+        }
+        min_pos(_minS, _bestDisp, minS, bestDisp);
+#endif
+        for( ; d < D; d++ )
+        {
+            int Sval = Sp[d];
+            if( Sval < minS )
+            {
+                minS = (CostType)Sval;
+                bestDisp = (short)d;
+            }
+        }
+
+        for( d = 0; d < D; d++ )
+        {
+            if( Sp[d]*(100 - uniquenessRatio) < minS*100 && std::abs(bestDisp - d) > 1 )
+                break;
+        }
+        if( d < D )
+            continue;
+        d = bestDisp;
+        int _x2 = x + minX1 - d - minD;
+        if( disp2cost[_x2] > minS )
+        {
+            disp2cost[_x2] = (CostType)minS;
+            disp2ptr[_x2] = (DispType)(d + minD);
+        }
+
+        if( 0 < d && d < D-1 )
+        {
+            // do subpixel quadratic interpolation:
+            //   fit parabola into (x1=d-1, y1=Sp[d-1]), (x2=d, y2=Sp[d]), (x3=d+1, y3=Sp[d+1])
+            //   then find minimum of the parabola.
+            int denom2 = std::max(Sp[d-1] + Sp[d+1] - 2*Sp[d], 1);
+            d = d*DISP_SCALE + ((Sp[d-1] - Sp[d+1])*DISP_SCALE + denom2)/(denom2*2);
+        }
+        else
+            d *= DISP_SCALE;
+        disp1ptr[x + minX1] = (DispType)(d + minD*DISP_SCALE);
+    }
+
+    for( x = minX1; x < maxX1; x++ )
+    {
+        // we round the computed disparity both towards -inf and +inf and check
+        // if either of the corresponding disparities in disp2 is consistent.
+        // This is to give the computed disparity a chance to look valid if it is.
+        int d1 = disp1ptr[x];
+        if( d1 == INVALID_DISP_SCALED )
+            continue;
+        int _d = d1 >> DISP_SHIFT;
+        int d_ = (d1 + DISP_SCALE-1) >> DISP_SHIFT;
+        int _x = x - _d, x_ = x - d_;
+        if( 0 <= _x && _x < width && disp2ptr[_x] >= minD && std::abs(disp2ptr[_x] - _d) > disp12MaxDiff &&
+           0 <= x_ && x_ < width && disp2ptr[x_] >= minD && std::abs(disp2ptr[x_] - d_) > disp12MaxDiff )
+            disp1ptr[x] = (DispType)INVALID_DISP_SCALED;
+    }
+}
+
+void ParallelSGBM::clearLr()
+{
+    const CostType MAX_COST = SHRT_MAX;
+    for (int i = 0; i < 2; i++)
+    {
+        memset(Lr[i], 0, ((width1 + 2)*NR_VERT + 1) * Dlra * sizeof(CostType));
+        memset(minLr[i], 0, (width1 + 2)*NR_VERT * sizeof(CostType));
+        // L_r(.,-1) and L_r(.,D) are never computed
+        for (int x = -1; x <= width1; x++)
+        {
+            for (int dir = 0; dir < NR_VERT; dir++)
+            {
+                CostType* L = getLr((uchar)i, x, dir);
+                L[-1] = L[D] = MAX_COST;
+            }
+        }
+    }
+}
+
+void ParallelSGBM::compute()
+{
+    const int npasses = fullDP ? 2 : 1;
+    const double nstripes = getNumThreads();
+    // each thread processes a few columns of a row at least
+    const double nstripesX = std::max(width1 / 32, 1);
+
+    for( int pass = 1; pass <= npasses; pass++ )
+    {
+        const int dx = pass == 1 ? 1 : -1;
+        uchar lrID = 0;
+        clearLr();
+
+        for( int i = 0; i < ntiles; i++ )
+        {
+            const int tile = pass == 1 ? i : ntiles - 1 - i;
+            const int y0 = tile * tileRows, y1 = std::min(y0 + tileRows, height);
+            tileY0 = y0;
+
+            // on the second pass C is computed again. It requires the same rows of the horizontal sums
+            updateHSum(y0 == 0 ? 0 : std::max(y0 - SH2 - 1, 0), std::min(y1 - 1 + SH2, height - 1));
+            const CostType* Cprev = tile > 0 ? getCBorderBuf(tile) : NULL;
+            parallel_for_(Range(0, width1), [&](const Range& range)
+            {
+                calcCost(y0, y1, Cprev, range);
+            }, nstripesX);
+            if( pass == 1 && tile + 1 < ntiles )
+                memcpy(getCBorderBuf(tile + 1), getCBuf(y1 - 1), costWidth * sizeof(CostType));
+
+            parallel_for_(Range(y0, y1), [&](const Range& range)
+            {
+                CostType* Lbuf = NULL;
+                utils::BufferArea aux_area;
+                aux_area.allocate(Lbuf, Dlra * 3, CV_SIMD_WIDTH);
+                aux_area.commit();
+                for( int y = range.start; y < range.end; y++ )
+                {
+                    if( pass == 1 )
+                        memset(getSBuf(y), 0, costWidth * sizeof(CostType));
+                    aggregateHorizontal(y, dx, Lbuf);
+                }
+            }, nstripes);
+
+            for( int j = 0; j < y1 - y0; j++ )
+            {
+                const int y = pass == 1 ? y0 + j : y1 - 1 - j;
+                parallel_for_(Range(0, width1), [&](const Range& range)
+                {
+                    aggregateVertical(y, lrID, range);
+                }, nstripesX);
+                lrID = 1 - lrID; // now shift the cyclic buffers
+            }
+
+            if( pass == npasses )
+            {
+                parallel_for_(Range(y0, y1), [&](const Range& range)
+                {
+                    CostType* Lbuf = NULL;
+                    DispType* disp2ptr = NULL;
+                    CostType* disp2cost = NULL;
+                    utils::BufferArea aux_area;
+                    aux_area.allocate(Lbuf, Dlra * 3, CV_SIMD_WIDTH);
+                    aux_area.allocate(disp2ptr, width, CV_SIMD_WIDTH);
+                    aux_area.allocate(disp2cost, width, CV_SIMD_WIDTH);
+                    aux_area.commit();
+                    for( int y = range.start; y < range.end; y++ )
+                        selectDisparity(y, Lbuf, disp2ptr, disp2cost);
+                }, nstripes);
+            }
+        }
+    }
+}
+
+static void computeDisparitySGBMParallel( const Mat& img1, const Mat& img2,
+                                         Mat& disp1, const StereoSGBMParams& params )
+{
+    const int minD = params.minDisparity, maxD = minD + params.numDisparities;
+    const int width = disp1.cols;
+    if( std::max(maxD, 0) >= width + std::min(minD, 0) )
+    {
+        disp1 = Scalar::all((minD - 1)*StereoMatcher::DISP_SCALE);
+        return;
+    }
+
+    ParallelSGBM sgbm(img1, img2, disp1, params);
+    sgbm.compute();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 struct CalcVerticalSums: public ParallelLoopBody
 {
@@ -2219,6 +2826,9 @@ public:
             computeDisparity3WaySGBM<4>( left, right, disp, params );
         else if(params.mode==MODE_HH4)
             computeDisparitySGBM_HH4( left, right, disp, params );
+        else if( getNumThreads() > 1 )
+            // gives the same result as computeDisparitySGBM(), which is faster in a single thread
+            computeDisparitySGBMParallel( left, right, disp, params );
         else
             computeDisparitySGBM( left, right, disp, params );
 
@@ -942,4 +942,38 @@ TEST(Calib3d_StereoSGBM_HH4, regression)
     CV_Assert( countNonZero(diff)==0);
 }
 
+typedef testing::TestWithParam<int> Calib3d_StereoSGBM_Modes;
+
+TEST_P(Calib3d_StereoSGBM_Modes, parallel_determinism)
+{
+    const int mode = GetParam();
+    // textured scene with two depth layers
+    Mat right(480, 640, CV_8UC3), left;
+    RNG rng(6);
+    rng.fill(right, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+    GaussianBlur(right, right, Size(3, 3), 0);
+    Mat shifted(right.size(), right.type());
+    Mat M = (Mat_<double>(2, 3) << 1, 0, 16, 0, 1, 0);
+    warpAffine(right, left, M, right.size(), INTER_NEAREST, BORDER_REFLECT);
+    M.at<double>(0, 2) = 40;
+    warpAffine(right, shifted, M, right.size(), INTER_NEAREST, BORDER_REFLECT);
+    shifted(Rect(200, 150, 240, 180)).copyTo(left(Rect(200, 150, 240, 180)));
+
+    Ptr<StereoSGBM> sgbm = StereoSGBM::create(0, 64, 5, 8*3*25, 32*3*25, 1, 63, 10, 0, 0, mode);
+    Mat dispRef, disp;
+    const int nthreads = getNumThreads();
+    setNumThreads(1);
+    sgbm->compute(left, right, dispRef);
+    setNumThreads(std::max(nthreads, 4));  // the parallel implementation is used with 2+ threads only
+    sgbm->compute(left, right, disp);
+    setNumThreads(nthreads);
+
+    ASSERT_EQ(CV_16SC1, disp.type());
+    EXPECT_EQ(0, cvtest::norm(dispRef, disp, NORM_INF));
+    EXPECT_NEAR(16*StereoMatcher::DISP_SCALE, dispRef.at<short>(100, 320), StereoMatcher::DISP_SCALE);
+    EXPECT_NEAR(40*StereoMatcher::DISP_SCALE, dispRef.at<short>(240, 320), StereoMatcher::DISP_SCALE);
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Calib3d_StereoSGBM_Modes, testing::Values((int)StereoSGBM::MODE_SGBM, (int)StereoSGBM::MODE_HH));
+
 }} // namespace
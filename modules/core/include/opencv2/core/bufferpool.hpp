@@ -27,6 +27,12 @@ public:
     virtual size_t getMaxReservedSize() const = 0;
     virtual void setMaxReservedSize(size_t size) = 0;
     virtual void freeAllReservedBuffers() = 0;
+
+    //! number of allocations served from the reserved buffers (0 if the pool doesn't collect statistics)
+    virtual size_t getHits() const { return 0; }
+    //! number of allocations which required a new buffer (0 if the pool doesn't collect statistics)
+    virtual size_t getMisses() const { return 0; }
+    virtual void resetStatistics() { }
 };
 
 //! @}
@@ -2148,6 +2148,16 @@ public:
     MatAllocator* allocator;
     //! and the standard allocator
     static MatAllocator* getStdAllocator();
+    /** @brief Returns the allocator which keeps the released buffers for reuse.
+
+    The buffers are grouped into size classes and cached per thread, so repeated allocations of similar
+    sizes (e.g. temporary images of a processing pipeline) don't go to the system allocator. Buffers up
+    to 4Kb are not pooled. The pool is not used by default, enable it with
+    `Mat::setDefaultAllocator(Mat::getPoolAllocator())` or with OPENCV_CPU_BUFFERPOOL=1 environment variable.
+    The pool size is limited by OPENCV_CPU_BUFFERPOOL_LIMIT (128Mb by default) and can be controlled through
+    getBufferPoolController(), which also reports the hit/miss statistics.
+    */
+    static MatAllocator* getPoolAllocator();
     static MatAllocator* getDefaultAllocator();
     static void setDefaultAllocator(MatAllocator* allocator);
 
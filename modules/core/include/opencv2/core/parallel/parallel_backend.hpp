@@ -47,6 +47,13 @@ namespace cv { namespace parallel {
  * - disable backend: `OPENCV_PARALLEL_PRIORITY_<backend>=0`
  * - specify list of backends with high priority (>100000): `OPENCV_PARALLEL_PRIORITY_LIST=TBB,OPENMP`. Unknown backends are registered as new plugins.
  *
+ * ### Built-in work-stealing backend
+ *
+ * Builds which use the pthreads-based thread pool (no TBB or OpenMP) have the `WORKSTEALING` backend with
+ * the lowest priority. Unlike the legacy pool it runs nested `parallel_for_()` calls and concurrent calls
+ * from several application threads in parallel. It can be disabled with `OPENCV_PARALLEL_PRIORITY_WORKSTEALING=0`
+ * (the legacy pool is used then).
+ *
  */
 
 /** Interface for parallel_for backends implementations
@@ -45,4 +45,32 @@ PERF_TEST_P(MatDepth_tb, DISABLED_Allocation_Aligned,
     SANITY_CHECK_NOTHING();
 }
 
+typedef perf::TestBaseWithParam<tuple<Size, bool> > Allocation_Pool;
+
+PERF_TEST_P(Allocation_Pool, create_release,
+    testing::Combine(testing::Values(::perf::szVGA, ::perf::sz1080p, ::perf::sz2160p), testing::Bool()))
+{
+    const Size sz = get<0>(GetParam());
+    const bool usePool = get<1>(GetParam());
+    MatAllocator* allocator = usePool ? Mat::getPoolAllocator() : Mat::getStdAllocator();
+
+    declare.iterations(100);
+
+    TEST_CYCLE()
+    {
+        // temporaries of a typical pipeline: the sizes differ a bit from call to call
+        for (int i = 0; i < 16; ++i)
+        {
+            Mat m;
+            m.allocator = allocator;
+            m.create(sz.height - (i & 3), sz.width, CV_8UC3);
+            m.ptr(m.rows - 1)[0] = (uchar)i;  // touch the buffer
+        }
+    }
+
+    if (usePool)
+        allocator->getBufferPoolController()->freeAllReservedBuffers();
+    SANITY_CHECK_NOTHING();
+}
+
 }
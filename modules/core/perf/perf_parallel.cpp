@@ -0,0 +1,84 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "perf_precomp.hpp"
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+#include <thread>
+#endif
+
+namespace opencv_test
+{
+using namespace perf;
+
+// some arithmetic over a part of the matrix, ~ 1 usec per row of 1000 floats
+static void processRows(Mat& m, const Range& r)
+{
+    for (int i = r.start; i < r.end; i++)
+    {
+        float* row = m.ptr<float>(i);
+        for (int j = 0; j < m.cols; j++)
+            row[j] = std::sqrt(row[j] * row[j] + 1.f) * 0.5f;
+    }
+}
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+typedef TestBaseWithParam<int> ParallelCallers;
+
+// several application threads run independent parallel loops at the same time
+PERF_TEST_P(ParallelCallers, parallel_for_concurrent_callers, testing::Values(1, 2, 4, 8))
+{
+    const int nCallers = GetParam();
+    std::vector<Mat> data(nCallers);
+    for (int k = 0; k < nCallers; k++)
+    {
+        data[k].create(2000, 1000, CV_32FC1);
+        declare.in(data[k], WARMUP_RNG);
+    }
+
+    TEST_CYCLE()
+    {
+        std::vector<std::thread> callers;
+        for (int k = 0; k < nCallers; k++)
+        {
+            callers.push_back(std::thread([&data, k]()
+            {
+                for (int it = 0; it < 4; it++)
+                    parallel_for_(Range(0, data[k].rows), [&](const Range& r) { processRows(data[k], r); });
+            }));
+        }
+        for (size_t k = 0; k < callers.size(); k++)
+            callers[k].join();
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+#endif
+
+typedef TestBaseWithParam<int> ParallelOuterSize;
+
+// a parallel loop over a few large items, every item is processed by a parallel loop too
+PERF_TEST_P(ParallelOuterSize, parallel_for_nested, testing::Values(1, 2, 4, 16))
+{
+    const int nOuter = GetParam();
+    std::vector<Mat> data(nOuter);
+    for (int k = 0; k < nOuter; k++)
+    {
+        data[k].create(8000 / nOuter, 1000, CV_32FC1);
+        declare.in(data[k], WARMUP_RNG);
+    }
+
+    TEST_CYCLE()
+    {
+        parallel_for_(Range(0, nOuter), [&](const Range& outer)
+        {
+            for (int k = outer.start; k < outer.end; k++)
+                parallel_for_(Range(0, data[k].rows), [&](const Range& r) { processRows(data[k], r); });
+        });
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
@@ -5,6 +5,8 @@
 #include "precomp.hpp"
 #include "bufferpool.impl.hpp"
 
+#include <opencv2/core/utils/configuration.private.hpp>
+
 namespace cv {
 
 void MatAllocator::map(UMatData*, AccessFlag) const
@@ -179,7 +181,8 @@ public:
 static
 MatAllocator*& getDefaultAllocatorMatRef()
 {
-    static MatAllocator* g_matAllocator = Mat::getStdAllocator();
+    static MatAllocator* g_matAllocator = utils::getConfigurationParameterBool("OPENCV_CPU_BUFFERPOOL", false)
+            ? Mat::getPoolAllocator() : Mat::getStdAllocator();
     return g_matAllocator;
 }
 
@@ -0,0 +1,331 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "precomp.hpp"
+
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/logger.defines.hpp>
+#include <opencv2/core/utils/logger.hpp>
+#include <opencv2/core/utils/tls.hpp>
+
+#include <atomic>
+#include <set>
+
+/*
+ * Pooled allocator of Mat buffers
+ *
+ * Released buffers are kept for reuse instead of being returned to the system. The buffers are
+ * grouped into size classes: every power of two is divided into 4 classes, so a buffer is at most
+ * 25% larger than requested. Every thread has a small cache of released buffers, which is checked
+ * first and is not contended by other threads (except trimming of the pool), the rest is kept in
+ * the shared lists protected by a mutex.
+ *
+ * Small buffers (up to 4Kb) are allocated with fastMalloc() directly, the system allocator handles
+ * them efficiently.
+ */
+
+namespace cv {
+
+namespace {
+
+static const int POOL_MIN_SHIFT = 12;  // buffers up to 4Kb are not pooled
+static const int POOL_MAX_SHIFT = 47;
+static const int POOL_CLASSES_PER_SHIFT = 4;
+static const int POOL_NUM_CLASSES = (POOL_MAX_SHIFT - POOL_MIN_SHIFT) * POOL_CLASSES_PER_SHIFT;
+static const size_t POOL_THREAD_CACHE_BLOCKS = 2;  // per size class
+
+// returns -1 for the sizes which are not pooled
+static inline int getSizeClass(size_t size, size_t& capacity)
+{
+    if (size <= ((size_t)1 << POOL_MIN_SHIFT))
+        return -1;
+    int k = POOL_MIN_SHIFT;
+    while (k < POOL_MAX_SHIFT && ((size_t)1 << (k + 1)) < size)
+        k++;
+    if (k == POOL_MAX_SHIFT)
+        return -1;
+    // 2^k < size <= 2^(k+1)
+    size_t base = (size_t)1 << k, step = base / POOL_CLASSES_PER_SHIFT;
+    size_t n = (size - base + step - 1) / step;  // 1..POOL_CLASSES_PER_SHIFT
+    capacity = base + n * step;
+    return (k - POOL_MIN_SHIFT) * POOL_CLASSES_PER_SHIFT + (int)n - 1;
+}
+
+struct ThreadBufferCache
+{
+    Mutex mutex;  // is locked by other threads only when the pool is trimmed
+    std::vector<void*> blocks[POOL_NUM_CLASSES];
+};
+
+// keeps track of the caches of all threads, so they can be flushed by any thread
+class ThreadBufferCacheTLS : public TLSDataContainer
+{
+public:
+    ~ThreadBufferCacheTLS() { release(); }
+
+    ThreadBufferCache& getRef() const
+    {
+        ThreadBufferCache* ptr = (ThreadBufferCache*)getData();
+        CV_Assert(ptr);
+        return *ptr;
+    }
+
+    // calls fn(cache) for every live thread cache, the cache is locked
+    template<typename Fn> void forEach(Fn fn) const
+    {
+        AutoLock lock(mutex);
+        for (std::set<ThreadBufferCache*>::const_iterator it = caches.begin(); it != caches.end(); ++it)
+        {
+            AutoLock cacheLock((*it)->mutex);
+            fn(**it);
+        }
+    }
+
+protected:
+    void* createDataInstance() const CV_OVERRIDE
+    {
+        ThreadBufferCache* cache = new ThreadBufferCache();
+        AutoLock lock(mutex);
+        caches.insert(cache);
+        return cache;
+    }
+    void deleteDataInstance(void* pData) const CV_OVERRIDE;  // called on thread termination
+
+    mutable Mutex mutex;
+    mutable std::set<ThreadBufferCache*> caches;
+};
+
+class PoolMatAllocator CV_FINAL : public MatAllocator, public BufferPoolController
+{
+public:
+    PoolMatAllocator() :
+        reservedSize(0), maxReservedSize(0), hits(0), misses(0)
+    {
+        maxReservedSize = utils::getConfigurationParameterSizeT("OPENCV_CPU_BUFFERPOOL_LIMIT", (size_t)1 << 27);
+        CV_LOG_INFO(NULL, "core: Initializing Mat buffer pool with max capacity: " << maxReservedSize);
+    }
+
+    ~PoolMatAllocator() CV_OVERRIDE
+    {
+        // the instance is never destroyed (CV_SINGLETON_LAZY_INIT)
+    }
+
+    UMatData* allocate(int dims, const int* sizes, int type,
+                       void* data0, size_t* step, AccessFlag /*flags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for( int i = dims-1; i >= 0; i-- )
+        {
+            if( step )
+            {
+                if( data0 && step[i] != CV_AUTOSTEP )
+                {
+                    CV_Assert(total <= step[i]);
+                    total = step[i];
+                }
+                else
+                    step[i] = total;
+            }
+            total *= sizes[i];
+        }
+        uchar* data = data0 ? (uchar*)data0 : (uchar*)allocateBuffer(total);
+        UMatData* u = new UMatData(this);
+        u->data = u->origdata = data;
+        u->size = total;
+        if(data0)
+            u->flags |= UMatData::USER_ALLOCATED;
+
+        return u;
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        if(!u) return false;
+        return true;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if(!u)
+            return;
+
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        if( !(u->flags & UMatData::USER_ALLOCATED) )
+        {
+            releaseBuffer(u->origdata, u->size);
+            u->origdata = 0;
+        }
+        delete u;
+    }
+
+    BufferPoolController* getBufferPoolController(const char* id) const CV_OVERRIDE
+    {
+        CV_UNUSED(id);
+        return const_cast<PoolMatAllocator*>(this);
+    }
+
+    // BufferPoolController
+
+    size_t getReservedSize() const CV_OVERRIDE { return reservedSize; }
+    size_t getMaxReservedSize() const CV_OVERRIDE { return maxReservedSize; }
+    void setMaxReservedSize(size_t size) CV_OVERRIDE
+    {
+        size_t oldMaxReservedSize = maxReservedSize;
+        maxReservedSize = size;
+        if (size < oldMaxReservedSize)
+            trim(size);
+    }
+    void freeAllReservedBuffers() CV_OVERRIDE
+    {
+        trim(0);
+    }
+    size_t getHits() const CV_OVERRIDE { return hits; }
+    size_t getMisses() const CV_OVERRIDE { return misses; }
+    void resetStatistics() CV_OVERRIDE
+    {
+        hits = 0;
+        misses = 0;
+    }
+
+    // moves the buffers of the thread cache to the shared lists, the cache must be locked
+    void releaseThreadCache(ThreadBufferCache& cache) const
+    {
+        AutoLock lock(mutex);
+        for (int c = 0; c < POOL_NUM_CLASSES; c++)
+        {
+            std::vector<void*>& blocks = cache.blocks[c];
+            sharedBlocks[c].insert(sharedBlocks[c].end(), blocks.begin(), blocks.end());
+            blocks.clear();
+        }
+    }
+
+protected:
+    void* allocateBuffer(size_t size) const
+    {
+        size_t capacity = 0;
+        int c = getSizeClass(size, capacity);
+        if (c < 0)
+            return fastMalloc(size);
+
+        void* ptr = NULL;
+        ThreadBufferCache& cache = threadCache.getRef();
+        {
+            AutoLock cacheLock(cache.mutex);
+            if (!cache.blocks[c].empty())
+            {
+                ptr = cache.blocks[c].back();
+                cache.blocks[c].pop_back();
+            }
+        }
+        if (!ptr)
+        {
+            AutoLock lock(mutex);
+            if (!sharedBlocks[c].empty())
+            {
+                ptr = sharedBlocks[c].back();
+                sharedBlocks[c].pop_back();
+            }
+        }
+        if (ptr)
+        {
+            reservedSize -= capacity;
+            hits++;
+            return ptr;
+        }
+        misses++;
+        return fastMalloc(capacity);
+    }
+
+    void releaseBuffer(void* ptr, size_t size) const
+    {
+        size_t capacity = 0;
+        int c = getSizeClass(size, capacity);
+        size_t maxSize = maxReservedSize;
+        // don't let a single buffer occupy the most of the pool (the same policy as in OpenCL buffer pool)
+        if (c < 0 || capacity > maxSize / 8)
+        {
+            fastFree(ptr);
+            return;
+        }
+        if (reservedSize.fetch_add(capacity) + capacity > maxSize)
+        {
+            reservedSize -= capacity;
+            fastFree(ptr);
+            return;
+        }
+        ThreadBufferCache& cache = threadCache.getRef();
+        {
+            AutoLock cacheLock(cache.mutex);
+            if (cache.blocks[c].size() < POOL_THREAD_CACHE_BLOCKS)
+            {
+                cache.blocks[c].push_back(ptr);
+                return;
+            }
+        }
+        AutoLock lock(mutex);
+        sharedBlocks[c].push_back(ptr);
+    }
+
+    // releases the reserved buffers until their size fits the limit
+    void trim(size_t limit) const
+    {
+        threadCache.forEach([this](ThreadBufferCache& cache) { releaseThreadCache(cache); });
+        trimShared(limit);
+    }
+
+    void trimShared(size_t limit) const
+    {
+        AutoLock lock(mutex);
+        for (int c = POOL_NUM_CLASSES - 1; c >= 0 && reservedSize > limit; c--)
+        {
+            std::vector<void*>& blocks = sharedBlocks[c];
+            if (blocks.empty())
+                continue;
+            size_t capacity = 0;
+            size_t base = (size_t)1 << (POOL_MIN_SHIFT + c / POOL_CLASSES_PER_SHIFT);
+            capacity = base + (c % POOL_CLASSES_PER_SHIFT + 1) * (base / POOL_CLASSES_PER_SHIFT);
+            while (!blocks.empty() && reservedSize > limit)
+            {
+                fastFree(blocks.back());
+                blocks.pop_back();
+                reservedSize -= capacity;
+            }
+        }
+    }
+
+    mutable Mutex mutex;
+    mutable std::vector<void*> sharedBlocks[POOL_NUM_CLASSES];
+    mutable ThreadBufferCacheTLS threadCache;
+
+    mutable std::atomic<size_t> reservedSize;  // size of the released buffers kept in the pool
+    std::atomic<size_t> maxReservedSize;
+    mutable std::atomic<size_t> hits, misses;
+};
+
+static PoolMatAllocator& getPoolMatAllocator()
+{
+    CV_SINGLETON_LAZY_INIT_REF(PoolMatAllocator, new PoolMatAllocator())
+}
+
+void ThreadBufferCacheTLS::deleteDataInstance(void* pData) const
+{
+    ThreadBufferCache* cache = (ThreadBufferCache*)pData;
+    {
+        AutoLock lock(mutex);
+        caches.erase(cache);
+        AutoLock cacheLock(cache->mutex);
+        getPoolMatAllocator().releaseThreadCache(*cache);
+    }
+    delete cache;
+}
+
+} // namespace
+
+MatAllocator* Mat::getPoolAllocator()
+{
+    return &getPoolMatAllocator();
+}
+
+} // namespace cv
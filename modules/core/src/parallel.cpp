@@ -513,6 +513,18 @@ void parallel_for_(const cv::Range& range, const cv::ParallelLoopBody& body, dou
     if (range.empty())
         return;
 
+#ifdef OPENCV_PARALLEL_HAVE_WORKSTEALING
+    {
+        // the work-stealing pool schedules nested and concurrent calls itself
+        std::shared_ptr<ParallelForAPI>& api = getCurrentParallelForAPI();
+        if (api && isNestedParallelForSupported(*api))
+        {
+            parallel_for_impl(range, body, nstripes);
+            return;
+        }
+    }
+#endif
+
     static std::atomic<bool> flagNestedParallelFor(false);
     bool isNotNestedRegion = !flagNestedParallelFor.load();
     if (isNotNestedRegion)
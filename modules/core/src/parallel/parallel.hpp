@@ -22,6 +22,18 @@ std::shared_ptr<cv::parallel::ParallelForAPI> createParallelBackendTBB();
 std::shared_ptr<cv::parallel::ParallelForAPI> createParallelBackendOpenMP();
 #endif
 
+// Built-in work-stealing thread pool. It supersedes the legacy pthreads-based pool (parallel_impl.cpp),
+// so it is available in the same configurations only.
+#if defined(HAVE_PTHREADS_PF) && !defined(OPENCV_DISABLE_THREAD_SUPPORT) \
+    && !defined(HAVE_TBB) && !defined(HAVE_HPX) && !defined(HAVE_OPENMP) && !defined(_OPENMP) \
+    && !defined(__APPLE__) && !defined(WINRT) && !(defined _MSC_VER && _MSC_VER >= 1600)
+#define OPENCV_PARALLEL_HAVE_WORKSTEALING 1
+std::shared_ptr<cv::parallel::ParallelForAPI> createParallelBackendWorkStealing();
+
+// true if the backend runs nested and concurrent parallel_for_() calls in parallel
+bool isNestedParallelForSupported(const ParallelForAPI& api);
+#endif
+
 #endif  // BUILD_PLUGIN
 
 }}  // namespace
@@ -0,0 +1,367 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+#include "../precomp.hpp"
+
+#include "parallel.hpp"
+
+#ifdef OPENCV_PARALLEL_HAVE_WORKSTEALING
+
+#include "../parallel_impl.hpp"  // defaultNumberOfThreads()
+
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/logger.defines.hpp>
+#include <opencv2/core/utils/logger.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/*
+ * Work-stealing thread pool
+ *
+ * Every worker thread owns a deque of chunks (ranges of tasks of some job). The owner pushes and
+ * pops chunks at the back of its deque, other threads steal them from the front, so a thief gets
+ * the largest chunk available. A chunk is split in halves until it is small enough to be executed:
+ * the second half is pushed to the deque of the executing thread and becomes available for stealing.
+ *
+ * Threads which don't belong to the pool (application threads calling parallel_for_) use the shared
+ * deque in the same way, so several jobs from different threads run in the pool simultaneously.
+ * parallel_for_ called from a task body (nested call) pushes the new job to the deque of the current
+ * thread, idle workers steal its chunks as usual.
+ *
+ * A thread which waits for completion of its job executes the remaining chunks of this job only
+ * (own deque first, then stealing from the other deques), so tasks of unrelated jobs never run on
+ * top of the caller's stack.
+ */
+
+namespace cv { namespace parallel {
+
+namespace {
+
+static int CV_WORKSTEALING_ACTIVE_WAIT = (int)utils::getConfigurationParameterSizeT("OPENCV_PARALLEL_WORKSTEALING_ACTIVE_WAIT", 1000);  // iterations
+
+struct Job
+{
+    Job(int tasks_, ParallelForAPI::FN_parallel_for_body_cb_t body_, void* data_, int grain_) :
+        body(body_), data(data_), grain(grain_), pending(tasks_), pushes(0), waiters(0), done(false)
+    {}
+
+    // called by the thread which has executed `count` tasks of the job
+    void complete(int count)
+    {
+        if (pending.fetch_sub(count) == count)
+        {
+            // the caller may destroy the job as soon as the lock is released
+            std::lock_guard<std::mutex> lock(mutex);
+            done = true;
+            cond.notify_all();
+        }
+    }
+
+    // a new chunk of the job became available for the waiting thread
+    void notifyPush()
+    {
+        pushes++;
+        if (waiters.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            cond.notify_all();
+        }
+    }
+
+    const ParallelForAPI::FN_parallel_for_body_cb_t body;
+    void* const data;
+    const int grain;
+
+    std::atomic<int> pending;  // number of not completed tasks
+    std::atomic<unsigned> pushes;
+    std::atomic<int> waiters;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    bool done;  // guarded by mutex
+};
+
+struct Chunk
+{
+    Job* job;
+    int begin, end;
+};
+
+class ChunkDeque
+{
+public:
+    void push(const Chunk& chunk)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        chunks.push_back(chunk);
+    }
+
+    // takes the last chunk (of the given job, if job is not NULL)
+    bool pop(Chunk& chunk, const Job* job)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = chunks.size(); i > 0; i--)
+        {
+            if (!job || chunks[i - 1].job == job)
+            {
+                chunk = chunks[i - 1];
+                chunks.erase(chunks.begin() + (i - 1));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // takes the first chunk (of the given job, if job is not NULL)
+    bool steal(Chunk& chunk, const Job* job)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            if (!job || chunks[i].job == job)
+            {
+                chunk = chunks[i];
+                chunks.erase(chunks.begin() + i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::mutex mutex;
+    std::deque<Chunk> chunks;
+};
+
+// index of the current thread in the pool: 1..N-1 for the workers, 0 for the other threads
+static thread_local int t_workerIndex = 0;
+
+class WorkStealingParallelForBackend : public ParallelForAPI
+{
+public:
+    WorkStealingParallelForBackend() :
+        numThreads((int)defaultNumberOfThreads()), running(false), stop(false), epoch(0), sleeping(0)
+    {
+        CV_LOG_VERBOSE(NULL, 1, "core(parallel): work-stealing pool, threads=" << numThreads);
+    }
+
+    ~WorkStealingParallelForBackend() CV_OVERRIDE
+    {
+        stopWorkers();
+    }
+
+    void parallel_for(int tasks, FN_parallel_for_body_cb_t body_callback, void* callback_data) CV_OVERRIDE
+    {
+        if (tasks <= 0)
+            return;
+        if (tasks == 1 || numThreads <= 1)
+        {
+            body_callback(0, tasks, callback_data);
+            return;
+        }
+        startWorkers();
+
+        Job job(tasks, body_callback, callback_data, std::max(1, tasks / (4 * numThreads)));
+        ChunkDeque& deque = currentDeque();
+        deque.push(Chunk{ &job, 0, tasks });
+        wakeWorkers();
+
+        for (;;)
+        {
+            unsigned seen = job.pushes.load();
+            Chunk chunk = Chunk();
+            if (deque.pop(chunk, &job) || stealChunk(chunk, &job))
+            {
+                execute(chunk, deque);
+                continue;
+            }
+
+            // all chunks are taken by other threads: wait for their completion or for new chunks
+            std::unique_lock<std::mutex> lock(job.mutex);
+            if (job.done)
+                break;
+            job.waiters++;
+            job.cond.wait(lock, [&] { return job.done || job.pushes.load() != seen; });
+            job.waiters--;
+            if (job.done)
+                break;
+        }
+    }
+
+    int getThreadNum() const CV_OVERRIDE
+    {
+        return t_workerIndex;
+    }
+
+    int getNumThreads() const CV_OVERRIDE
+    {
+        return numThreads;
+    }
+
+    int setNumThreads(int nThreads) CV_OVERRIDE
+    {
+        int oldNumThreads = numThreads;
+        int newNumThreads = nThreads > 0 ? nThreads : (int)defaultNumberOfThreads();
+        if (newNumThreads != numThreads)
+        {
+            stopWorkers();  // workers are restarted by the next parallel_for() call
+            numThreads = newNumThreads;
+        }
+        return oldNumThreads;
+    }
+
+    const char* getName() const CV_OVERRIDE
+    {
+        return "workstealing";
+    }
+
+protected:
+    ChunkDeque& currentDeque()
+    {
+        // deques[0] is shared by the threads which don't belong to the pool
+        return *deques[t_workerIndex];
+    }
+
+    void execute(Chunk chunk, ChunkDeque& deque)
+    {
+        Job& job = *chunk.job;
+        while (chunk.end - chunk.begin > job.grain)
+        {
+            int middle = chunk.begin + (chunk.end - chunk.begin) / 2;
+            deque.push(Chunk{ &job, middle, chunk.end });
+            job.notifyPush();
+            wakeWorkers();
+            chunk.end = middle;
+        }
+        job.body(chunk.begin, chunk.end, job.data);
+        job.complete(chunk.end - chunk.begin);
+    }
+
+    bool stealChunk(Chunk& chunk, const Job* job)
+    {
+        int n = (int)deques.size();
+        for (int i = 1; i <= n; i++)
+        {
+            int victim = (t_workerIndex + i) % n;
+            if (victim != t_workerIndex && deques[victim]->steal(chunk, job))
+                return true;
+        }
+        return false;
+    }
+
+    void wakeWorkers()
+    {
+        epoch++;
+        if (sleeping.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            cond.notify_one();
+        }
+    }
+
+    void workerBody(int index)
+    {
+        (void)cv::utils::getThreadID(); // notify OpenCV about new thread
+        t_workerIndex = index;
+        ChunkDeque& deque = *deques[index];
+        while (!stop)
+        {
+            Chunk chunk = Chunk();
+            bool found = false;
+            for (int i = 0; i <= CV_WORKSTEALING_ACTIVE_WAIT && !stop; i++)
+            {
+                if (deque.pop(chunk, NULL) || stealChunk(chunk, NULL))
+                {
+                    found = true;
+                    break;
+                }
+                std::this_thread::yield();
+            }
+            if (found)
+            {
+                execute(chunk, deque);
+                continue;
+            }
+
+            unsigned seen = epoch.load();
+            if (stealChunk(chunk, NULL))
+            {
+                execute(chunk, deque);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            sleeping++;
+            cond.wait(lock, [&] { return stop || epoch.load() != seen; });
+            sleeping--;
+        }
+    }
+
+    void startWorkers()
+    {
+        if (running)
+            return;
+        std::lock_guard<std::mutex> lock(configMutex);
+        if (running)
+            return;
+        CV_LOG_VERBOSE(NULL, 1, "core(parallel): starting " << (numThreads - 1) << " worker threads");
+        stop = false;
+        deques.clear();
+        for (int i = 0; i < numThreads; i++)
+            deques.push_back(makePtr<ChunkDeque>());
+        std::vector<std::thread> threads;
+        for (int i = 1; i < numThreads; i++)
+            threads.push_back(std::thread(&WorkStealingParallelForBackend::workerBody, this, i));
+        workers.swap(threads);
+        running = true;
+    }
+
+    void stopWorkers()
+    {
+        std::lock_guard<std::mutex> configLock(configMutex);
+        if (!running)
+            return;
+        running = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+            cond.notify_all();
+        }
+        for (size_t i = 0; i < workers.size(); i++)
+            workers[i].join();
+        workers.clear();
+    }
+
+    int numThreads;
+
+    std::vector< Ptr<ChunkDeque> > deques;
+    std::vector<std::thread> workers;
+    std::mutex configMutex;  // guards start/stop of the workers
+    std::atomic<bool> running;
+
+    std::atomic<bool> stop;
+    std::atomic<unsigned> epoch;  // incremented on every new chunk
+    std::atomic<int> sleeping;    // number of sleeping workers
+    std::mutex mutex;
+    std::condition_variable cond;
+};
+
+} // namespace
+
+std::shared_ptr<ParallelForAPI> createParallelBackendWorkStealing()
+{
+    static std::shared_ptr<WorkStealingParallelForBackend> g_instance = std::make_shared<WorkStealingParallelForBackend>();
+    return g_instance;
+}
+
+bool isNestedParallelForSupported(const ParallelForAPI& api)
+{
+    return dynamic_cast<const WorkStealingParallelForBackend*>(&api) != NULL;
+}
+
+}}  // namespace
+
+#endif  // OPENCV_PARALLEL_HAVE_WORKSTEALING
@@ -41,6 +41,10 @@ std::vector<ParallelBackendInfo>& getBuiltinParallelBackendsInfo()
 #elif defined(PARALLEL_ENABLE_PLUGINS)
         DECLARE_DYNAMIC_BACKEND("OPENMP")  // TODO Intel OpenMP?
 #endif
+
+#ifdef OPENCV_PARALLEL_HAVE_WORKSTEALING
+        DECLARE_STATIC_BACKEND("WORKSTEALING", createParallelBackendWorkStealing)
+#endif
     };
     return g_backends;
 }
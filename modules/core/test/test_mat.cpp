@@ -2598,4 +2598,115 @@ TEST(Mat, Recreate1DMatWithSameMeta)
     EXPECT_NO_THROW(m.create(dims, depth));
 }
 
+TEST(Mat, PoolAllocator_reuse)
+{
+    MatAllocator* allocator = Mat::getPoolAllocator();
+    BufferPoolController* pool = allocator->getBufferPoolController();
+    ASSERT_TRUE(pool != NULL);
+    pool->freeAllReservedBuffers();
+    pool->resetStatistics();
+    EXPECT_EQ(0u, pool->getReservedSize());
+
+    const uchar* data = NULL;
+    {
+        Mat m;
+        m.allocator = allocator;
+        m.create(480, 640, CV_8UC3);
+        m.setTo(Scalar::all(1));
+        data = m.data;
+    }
+    EXPECT_EQ(0u, pool->getHits());
+    EXPECT_EQ(1u, pool->getMisses());
+    EXPECT_GE(pool->getReservedSize(), (size_t)480*640*3);
+    {
+        // slightly smaller buffer of the same size class
+        Mat m;
+        m.allocator = allocator;
+        m.create(478, 640, CV_8UC3);
+        EXPECT_EQ(data, m.data);
+        EXPECT_EQ(0u, pool->getReservedSize());
+    }
+    EXPECT_EQ(1u, pool->getHits());
+    EXPECT_EQ(1u, pool->getMisses());
+
+    {
+        // small buffers are not pooled
+        Mat m;
+        m.allocator = allocator;
+        m.create(8, 8, CV_8UC1);
+    }
+    EXPECT_EQ(1u, pool->getHits());
+    EXPECT_EQ(1u, pool->getMisses());
+
+    pool->freeAllReservedBuffers();
+    EXPECT_EQ(0u, pool->getReservedSize());
+    pool->resetStatistics();
+}
+
+TEST(Mat, PoolAllocator_maxReservedSize)
+{
+    MatAllocator* allocator = Mat::getPoolAllocator();
+    BufferPoolController* pool = allocator->getBufferPoolController();
+    const size_t oldMaxReservedSize = pool->getMaxReservedSize();
+    pool->freeAllReservedBuffers();
+
+    pool->setMaxReservedSize(1 << 20);
+    EXPECT_EQ((size_t)1 << 20, pool->getMaxReservedSize());
+    {
+        std::vector<Mat> mats(16);
+        for (size_t i = 0; i < mats.size(); i++)
+        {
+            mats[i].allocator = allocator;
+            mats[i].create(256, 256, CV_8UC1);
+        }
+        Mat big;
+        big.allocator = allocator;
+        big.create(1024, 1024, CV_8UC1);  // is larger than 1/8 of the pool
+    }
+    EXPECT_LE(pool->getReservedSize(), (size_t)1 << 20);
+    EXPECT_GT(pool->getReservedSize(), 0u);
+
+    pool->setMaxReservedSize(1 << 17);
+    EXPECT_LE(pool->getReservedSize(), (size_t)1 << 17);
+
+    pool->setMaxReservedSize(oldMaxReservedSize);
+    pool->freeAllReservedBuffers();
+    EXPECT_EQ(0u, pool->getReservedSize());
+    pool->resetStatistics();
+}
+
+TEST(Mat, PoolAllocator_parallel)
+{
+    MatAllocator* allocator = Mat::getPoolAllocator();
+    BufferPoolController* pool = allocator->getBufferPoolController();
+    pool->freeAllReservedBuffers();
+    pool->resetStatistics();
+
+    Mat results(1, 64, CV_32SC1, Scalar::all(0));
+    parallel_for_(Range(0, results.cols), [&](const Range& r)
+    {
+        for (int i = r.start; i < r.end; i++)
+        {
+            Mat a, b;
+            a.allocator = b.allocator = allocator;
+            for (int iter = 0; iter < 10; iter++)
+            {
+                a.create(100 + i, 200, CV_8UC1);
+                a.setTo(Scalar::all(i));
+                b.create(50 + iter, 300, CV_16UC1);
+                b.setTo(Scalar::all(iter));
+                if (countNonZero(a != i) == 0 && countNonZero(b != iter) == 0)
+                    results.at<int>(i)++;
+                a.release();
+                b.release();
+            }
+        }
+    });
+    EXPECT_EQ(0, countNonZero(results != 10));
+    EXPECT_GT(pool->getHits(), 0u);
+
+    pool->freeAllReservedBuffers();
+    pool->resetStatistics();
+}
+
 }} // namespace
@@ -304,6 +304,64 @@ TEST(Core_Parallel, propagate_fp_denormals_ignore_hint)
     }
 }
 
+TEST(Core_Parallel, nested_parallel_for)
+{
+    Mat counts(32, 100, CV_32SC1, Scalar::all(0));
+    parallel_for_(Range(0, counts.rows), [&](const Range& r)
+    {
+        for (int i = r.start; i < r.end; i++)
+        {
+            int* row = counts.ptr<int>(i);
+            parallel_for_(Range(0, counts.cols), [&](const Range& c)
+            {
+                for (int j = c.start; j < c.end; j++)
+                    row[j]++;
+            });
+        }
+    });
+    EXPECT_EQ(0, cvtest::norm(counts, Mat(counts.size(), CV_32SC1, Scalar::all(1)), NORM_INF));
+}
+
+TEST(Core_Parallel, nested_parallel_for_propagate_exceptions)
+{
+    Mat dst(100, 100, CV_8SC1, Scalar::all(0));
+    EXPECT_THROW({
+        parallel_for_(Range(0, 8), [&](const Range& r)
+        {
+            for (int i = r.start; i < r.end; i++)
+                parallel_for_(Range(0, dst.rows), ThrowErrorParallelLoopBody(dst, i == 5 ? dst.rows / 2 : -1));
+        });
+    }, cv::Exception);
+}
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+TEST(Core_Parallel, concurrent_callers)
+{
+    const int nCallers = 4, nIterations = 20;
+    std::vector<Mat> dst(nCallers);
+    std::vector<std::thread> callers;
+    for (int k = 0; k < nCallers; k++)
+    {
+        dst[k] = Mat(1000, 64, CV_32SC1, Scalar::all(0));
+        callers.push_back(std::thread([&dst, k]()
+        {
+            for (int it = 0; it < nIterations; it++)
+            {
+                parallel_for_(Range(0, dst[k].rows), [&](const Range& r)
+                {
+                    for (int i = r.start; i < r.end; i++)
+                        dst[k].row(i) += Scalar::all(1);
+                });
+            }
+        }));
+    }
+    for (size_t k = 0; k < callers.size(); k++)
+        callers[k].join();
+    for (int k = 0; k < nCallers; k++)
+        EXPECT_EQ(0, cvtest::norm(dst[k], Mat(dst[k].size(), CV_32SC1, Scalar::all(nIterations)), NORM_INF)) << "caller=" << k;
+}
+#endif
+
 TEST(Core_Version, consistency)
 {
     // this test verifies that OpenCV version loaded in runtime
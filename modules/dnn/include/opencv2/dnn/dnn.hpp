@@ -104,7 +104,7 @@ CV__DNN_INLINE_NS_BEGIN
         DNN_TARGET_CUDA_FP16,
         DNN_TARGET_HDDL,
         DNN_TARGET_NPU,
-        DNN_TARGET_CPU_FP16, // Only the ARM platform is supported. Low precision computing, accelerate model inference.
+        DNN_TARGET_CPU_FP16, // ARM: low precision computing, accelerate model inference. x86 with AVX2 and F16C: FP16 weights of convolution, InnerProduct and Gemm layers, FP32 computing.
     };
 
     /**
@@ -874,6 +874,17 @@ CV__DNN_INLINE_NS_BEGIN
         */
         CV_WRAP void enableWinograd(bool useWinograd);
 
+        /** @brief Enables or disables concurrent execution of independent layers (branches of the network).
+         * The layers which neither depend on the outputs of each other nor share memory run in parallel,
+         * it reduces the latency of multi-branch networks with small layers. The nested parallel regions
+         * share the threads with "workstealing" parallel framework only, with other frameworks the heavy
+         * layers are executed one by one to keep their own parallelism.
+         * Supported by DNN_BACKEND_OPENCV on DNN_TARGET_CPU and DNN_TARGET_CPU_FP16 only. If a layer reallocates
+         * its outputs during forward() (dynamic shapes), the layers are executed one by one until the input shapes change.
+         * @param enable true to enable the concurrent execution. The default is false.
+         */
+        CV_WRAP void enableParallelBranches(bool enable);
+
         /** @brief Returns overall time for inference and timings (in ticks) for layers.
          *
          * Indexes in returned vector correspond to layers ids. Some layers can be fused with others,
@@ -5,6 +5,7 @@
 #include "precomp.hpp"
 
 #include <opencv2/imgproc.hpp>
+#include <opencv2/core/hal/intrin.hpp>
 #include <opencv2/core/utils/logger.hpp>
 
 
@@ -126,6 +127,362 @@ Mat blobFromImagesWithParams(InputArrayOfArrays images, const Image2BlobParams&
     return blob;
 }
 
+namespace {
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+static inline void v_store_normalized(float* dst, const v_float32& v, const v_float32& m, const v_float32& s)
+{
+    v_store(dst, v_mul(v_sub(v, m), s));
+}
+
+static inline void v_store_normalized(float* dst, const v_uint8& v, const v_float32& m, const v_float32& s)
+{
+    const int nlanes = VTraits<v_float32>::vlanes();
+    v_uint16 w0, w1;
+    v_uint32 d0, d1, d2, d3;
+    v_expand(v, w0, w1);
+    v_expand(w0, d0, d1);
+    v_expand(w1, d2, d3);
+    v_store(dst,              v_mul(v_sub(v_cvt_f32(v_reinterpret_as_s32(d0)), m), s));
+    v_store(dst + nlanes,     v_mul(v_sub(v_cvt_f32(v_reinterpret_as_s32(d1)), m), s));
+    v_store(dst + nlanes * 2, v_mul(v_sub(v_cvt_f32(v_reinterpret_as_s32(d2)), m), s));
+    v_store(dst + nlanes * 3, v_mul(v_sub(v_cvt_f32(v_reinterpret_as_s32(d3)), m), s));
+}
+
+template<typename T> struct Image2BlobVec;
+template<> struct Image2BlobVec<uchar> { typedef v_uint8 vtype; };
+template<> struct Image2BlobVec<float> { typedef v_float32 vtype; };
+
+// Planar (NCHW) part of the row conversion: interleaved pixels are split into channel planes
+// with the mean subtraction and scaling applied on the fly.
+template<typename T>
+static int image2BlobRowPlanarVec(const T* src, float** dst, int width, int cn, const float* mean, const float* scale)
+{
+    typedef typename Image2BlobVec<T>::vtype vtype;
+    const int nlanes = VTraits<vtype>::vlanes();
+    const v_float32 m0 = vx_setall_f32(mean[0]), s0 = vx_setall_f32(scale[0]);
+    int x = 0;
+    if (cn == 1)
+    {
+        for (; x <= width - nlanes; x += nlanes)
+            v_store_normalized(dst[0] + x, vx_load(src + x), m0, s0);
+    }
+    else if (cn == 3)
+    {
+        const v_float32 m1 = vx_setall_f32(mean[1]), s1 = vx_setall_f32(scale[1]);
+        const v_float32 m2 = vx_setall_f32(mean[2]), s2 = vx_setall_f32(scale[2]);
+        for (; x <= width - nlanes; x += nlanes)
+        {
+            vtype a, b, c;
+            v_load_deinterleave(src + x * 3, a, b, c);
+            v_store_normalized(dst[0] + x, a, m0, s0);
+            v_store_normalized(dst[1] + x, b, m1, s1);
+            v_store_normalized(dst[2] + x, c, m2, s2);
+        }
+    }
+    else if (cn == 4)
+    {
+        const v_float32 m1 = vx_setall_f32(mean[1]), s1 = vx_setall_f32(scale[1]);
+        const v_float32 m2 = vx_setall_f32(mean[2]), s2 = vx_setall_f32(scale[2]);
+        const v_float32 m3 = vx_setall_f32(mean[3]), s3 = vx_setall_f32(scale[3]);
+        for (; x <= width - nlanes; x += nlanes)
+        {
+            vtype a, b, c, d;
+            v_load_deinterleave(src + x * 4, a, b, c, d);
+            v_store_normalized(dst[0] + x, a, m0, s0);
+            v_store_normalized(dst[1] + x, b, m1, s1);
+            v_store_normalized(dst[2] + x, c, m2, s2);
+            v_store_normalized(dst[3] + x, d, m3, s3);
+        }
+    }
+    return x;
+}
+#endif
+
+// Writes image rows into the blob in a single pass: mean subtraction, scaling, R/B swapping,
+// border filling for the letterbox mode and NCHW/NHWC layout conversion are done together
+// instead of separate convertTo/subtract/multiply/split passes over every image.
+template<typename T, typename DT>
+class Image2BlobInvoker : public ParallelLoopBody
+{
+public:
+    Image2BlobInvoker(const std::vector<Mat>& images_, const std::vector<Point>& offsets_, Mat& blob_,
+                      bool nchw_, const int* dstch_, const float* mean_, const float* scale_, const float* border_) :
+        images(images_), offsets(offsets_), blob(blob_), nchw(nchw_)
+    {
+        cn = images[0].channels();
+        height = nchw ? blob.size[2] : blob.size[1];
+        width = nchw ? blob.size[3] : blob.size[2];
+        for (int c = 0; c < cn; c++)
+        {
+            dstch[c] = dstch_[c];
+            mean[c] = mean_[c];
+            scale[c] = scale_[c];
+            border[c] = border_[c];
+        }
+    }
+
+    virtual void operator()(const Range& r) const CV_OVERRIDE
+    {
+        DT* dst[4];
+        for (int idx = r.start; idx < r.end; idx++)
+        {
+            int i = idx / height, y = idx % height;
+            const Mat& image = images[i];
+            Point ofs = offsets[i];
+            int dstep = nchw ? 1 : cn;
+            for (int c = 0; c < cn; c++)
+                dst[c] = nchw ? blob.ptr<DT>(i, dstch[c], y) : blob.ptr<DT>(i, y) + dstch[c];
+
+            int sy = y - ofs.y;
+            if (sy < 0 || sy >= image.rows)
+            {
+                fillBorder(dst, dstep, 0, width);
+                continue;
+            }
+            int x0 = std::max(ofs.x, 0), x1 = std::min(ofs.x + image.cols, width);
+            fillBorder(dst, dstep, 0, x0);
+            convertRow(image.ptr<T>(sy) + (x0 - ofs.x) * cn, dst, dstep, x0, x1);
+            fillBorder(dst, dstep, x1, width);
+        }
+    }
+
+private:
+    void fillBorder(DT** dst, int dstep, int x0, int x1) const
+    {
+        for (int c = 0; c < cn; c++)
+        {
+            DT v = saturate_cast<DT>(border[c]);
+            for (int x = x0; x < x1; x++)
+                dst[c][x * dstep] = v;
+        }
+    }
+
+    void convertRow(const T* src, DT** dst, int dstep, int x0, int x1) const
+    {
+        int x = x0;
+        if (std::is_same<DT, float>::value)
+        {
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+            if (nchw)
+            {
+                float* fdst[4];
+                for (int c = 0; c < cn; c++)
+                    fdst[c] = (float*)dst[c] + x0;
+                x += image2BlobRowPlanarVec<T>(src, fdst, x1 - x0, cn, mean, scale);
+            }
+#endif
+            for (; x < x1; x++)
+            {
+                const T* S = src + (x - x0) * cn;
+                for (int c = 0; c < cn; c++)
+                    dst[c][x * dstep] = (DT)(((float)S[c] - mean[c]) * scale[c]);
+            }
+        }
+        else
+        {
+            for (; x < x1; x++)
+            {
+                const T* S = src + (x - x0) * cn;
+                for (int c = 0; c < cn; c++)
+                    dst[c][x * dstep] = saturate_cast<DT>(S[c]);
+            }
+        }
+    }
+
+    const std::vector<Mat>& images;
+    const std::vector<Point>& offsets;
+    Mat& blob;
+    bool nchw;
+    int cn, width, height;
+    int dstch[4];
+    float mean[4], scale[4], border[4];
+};
+
+// Resizes the images to the blob geometry. Images of the same size share one resize plan
+// and a batch is resized image-by-image in parallel.
+class Image2BlobResizeInvoker : public ParallelLoopBody
+{
+public:
+    Image2BlobResizeInvoker(const std::vector<Mat>& src_, std::vector<Mat>& dst_, const std::vector<ResizePlan>& plans_) :
+        src(src_), dst(dst_), plans(plans_) {}
+
+    virtual void operator()(const Range& r) const CV_OVERRIDE
+    {
+        for (int i = r.start; i < r.end; i++)
+        {
+            if (!plans[i].empty())
+                plans[i].apply(src[i], dst[i]);
+        }
+    }
+
+private:
+    const std::vector<Mat>& src;
+    std::vector<Mat>& dst;
+    const std::vector<ResizePlan>& plans;
+};
+
+typedef void (*Image2BlobFunc)(const std::vector<Mat>& images, const std::vector<Point>& offsets, Mat& blob,
+                               bool nchw, const int* dstch, const float* mean, const float* scale, const float* border);
+
+template<typename T, typename DT>
+void image2Blob(const std::vector<Mat>& images, const std::vector<Point>& offsets, Mat& blob,
+                bool nchw, const int* dstch, const float* mean, const float* scale, const float* border)
+{
+    int height = nchw ? blob.size[2] : blob.size[1];
+    int width = nchw ? blob.size[3] : blob.size[2];
+    Image2BlobInvoker<T, DT> invoker(images, offsets, blob, nchw, dstch, mean, scale, border);
+    parallel_for_(Range(0, (int)images.size() * height), invoker,
+                  (double)images.size() * height * width * images[0].channels() / (1 << 16));
+}
+
+// Fused CPU implementation of blobFromImagesWithParams().
+// Returns false if the combination of parameters is not handled, so the generic path is used.
+bool blobFromImagesWithParamsFused(InputArrayOfArrays images_, Mat& blob_, const Image2BlobParams& param)
+{
+    CV_TRACE_FUNCTION();
+
+    std::vector<Mat> images;
+    getVector(images_, images);
+    if (images.empty())
+        return false;
+
+    const int depth = images[0].depth(), nch = images[0].channels();
+    const bool nchw = param.datalayout == DNN_LAYOUT_NCHW;
+    if (!nchw && param.datalayout != DNN_LAYOUT_NHWC)
+        return false;
+    if (!((depth == CV_8U && (param.ddepth == CV_8U || param.ddepth == CV_32F)) ||
+          (depth == CV_32F && param.ddepth == CV_32F)))
+        return false;
+    if (nchw ? (nch != 1 && nch != 3 && nch != 4) : (nch < 1 || nch > 4))
+        return false;
+    if (param.ddepth == CV_8U && (param.scalefactor != Scalar::all(1.0) || param.mean != Scalar()))
+        return false;
+    for (size_t i = 0; i < images.size(); i++)
+    {
+        if (images[i].dims != 2 || images[i].type() != images[0].type() || images[i].empty())
+            return false;
+    }
+
+    Scalar scalefactor = param.scalefactor;
+    Scalar mean = param.mean;
+    int dstch[4] = { 0, 1, 2, 3 };
+    if (param.swapRB)
+    {
+        if (nch > 2)
+        {
+            std::swap(mean[0], mean[2]);
+            std::swap(scalefactor[0], scalefactor[2]);
+            std::swap(dstch[0], dstch[2]);
+        }
+        else
+        {
+            CV_LOG_WARNING(NULL, "Red/blue color swapping requires at least three image channels.");
+        }
+    }
+
+    size_t nimages = images.size();
+    Size size = param.size;
+    if (size == Size())
+        size = images[0].size();
+
+    std::vector<ResizePlan> plans(nimages);
+    std::vector<Rect> crops(nimages);
+    std::vector<Point> offsets(nimages);
+    bool needResize = false;
+    for (size_t i = 0; i < nimages; i++)
+    {
+        Size imgSize = images[i].size();
+        crops[i] = Rect(Point(), imgSize);
+        if (size == imgSize)
+            continue;
+
+        Size dsize, planSize;
+        double fx = 0, fy = 0;
+        if (param.paddingmode == DNN_PMODE_CROP_CENTER)
+        {
+            float resizeFactor = std::max(size.width / (float)imgSize.width,
+                                          size.height / (float)imgSize.height);
+            // the scale factor is passed to the resize as is, same as resize(img, img, Size(), f, f)
+            fx = fy = resizeFactor;
+            dsize = Size(saturate_cast<int>(imgSize.width * fx), saturate_cast<int>(imgSize.height * fy));
+            crops[i] = Rect(Point(0.5 * (dsize.width - size.width),
+                                  0.5 * (dsize.height - size.height)),
+                            size);
+        }
+        else if (param.paddingmode == DNN_PMODE_LETTERBOX)
+        {
+            float resizeFactor = std::min(size.width / (float)imgSize.width,
+                                          size.height / (float)imgSize.height);
+            dsize = Size(int(imgSize.width * resizeFactor), int(imgSize.height * resizeFactor));
+            offsets[i] = Point((size.width - dsize.width) / 2, (size.height - dsize.height) / 2);
+            crops[i] = Rect(Point(), dsize);
+            planSize = dsize;
+        }
+        else
+        {
+            dsize = planSize = size;
+            crops[i] = Rect(Point(), dsize);
+        }
+
+        if (dsize == imgSize)
+            continue;
+        if (i > 0 && !plans[i - 1].empty() && plans[i - 1].srcSize() == imgSize)
+            plans[i] = plans[i - 1];
+        else
+            plans[i] = ResizePlan(imgSize, images[i].type(), planSize, fx, fy, INTER_LINEAR);
+        needResize = true;
+    }
+
+    if (needResize)
+    {
+        std::vector<Mat> resized(nimages);
+        for (size_t i = 0; i < nimages; i++)
+            if (plans[i].empty())
+                resized[i] = images[i];
+        if (nimages > 1)
+            parallel_for_(Range(0, (int)nimages), Image2BlobResizeInvoker(images, resized, plans));
+        else
+            Image2BlobResizeInvoker(images, resized, plans)(Range(0, 1));
+        images.swap(resized);
+    }
+
+    for (size_t i = 0; i < nimages; i++)
+    {
+        images[i] = images[i](crops[i]);
+        if (param.paddingmode != DNN_PMODE_LETTERBOX)
+            CV_Assert(images[i].size() == size);
+    }
+
+    float fmean[4], fscale[4], fborder[4];
+    for (int c = 0; c < nch; c++)
+    {
+        fmean[c] = (float)mean[c];
+        fscale[c] = (float)scalefactor[c];
+        // copyMakeBorder() saturates the border value to the image depth before the conversion
+        float b = depth == CV_8U ? (float)saturate_cast<uchar>(param.borderValue[c]) : (float)param.borderValue[c];
+        fborder[c] = param.ddepth == CV_32F ? (b - fmean[c]) * fscale[c] : b;
+    }
+
+    if (nchw)
+    {
+        int sz[] = { (int)nimages, nch, size.height, size.width };
+        blob_.create(4, sz, param.ddepth);
+    }
+    else
+    {
+        int sz[] = { (int)nimages, size.height, size.width, nch };
+        blob_.create(4, sz, param.ddepth);
+    }
+
+    Image2BlobFunc func = depth == CV_32F ? image2Blob<float, float> :
+                          param.ddepth == CV_32F ? image2Blob<uchar, float> : image2Blob<uchar, uchar>;
+    func(images, offsets, blob_, nchw, dstch, fmean, fscale, fborder);
+    return true;
+}
+
+}  // namespace
+
 template<class Tmat>
 void blobFromImagesWithParamsImpl(InputArrayOfArrays images_, Tmat& blob_, const Image2BlobParams& param)
 {
@@ -309,12 +666,14 @@ void blobFromImagesWithParams(InputArrayOfArrays images, OutputArray blob, const
     } else if (images.kind() == _InputArray::STD_VECTOR_MAT) {
         if(blob.kind() == _InputArray::UMAT) {
             Mat m = blob.getUMatRef().getMat(ACCESS_WRITE);
-            blobFromImagesWithParamsImpl<cv::Mat>(images, m, param);
+            if (!blobFromImagesWithParamsFused(images, m, param))
+                blobFromImagesWithParamsImpl<cv::Mat>(images, m, param);
             m.copyTo(blob);
             return;
         } else if(blob.kind() == _InputArray::MAT) {
             Mat& m = blob.getMatRef();
-            blobFromImagesWithParamsImpl<cv::Mat>(images, m, param);
+            if (!blobFromImagesWithParamsFused(images, m, param))
+                blobFromImagesWithParamsImpl<cv::Mat>(images, m, param);
             return;
         }
     }
@@ -343,13 +702,15 @@ void blobFromImageWithParams(InputArray image, OutputArray blob, const Image2Blo
         if(blob.kind() == _InputArray::UMAT) {
             Mat m = blob.getUMatRef().getMat(ACCESS_RW);
             std::vector<Mat> images(1, image.getMat());
-            blobFromImagesWithParamsImpl<cv::Mat>(images, m, param);
+            if (!blobFromImagesWithParamsFused(images, m, param))
+                blobFromImagesWithParamsImpl<cv::Mat>(images, m, param);
             m.copyTo(blob);
             return;
         } else if(blob.kind() == _InputArray::MAT) {
             Mat& m = blob.getMatRef();
             std::vector<Mat> images(1, image.getMat());
-            blobFromImagesWithParamsImpl<cv::Mat>(images, m, param);
+            if (!blobFromImagesWithParamsFused(images, m, param))
+                blobFromImagesWithParamsImpl<cv::Mat>(images, m, param);
             return;
         }
     }
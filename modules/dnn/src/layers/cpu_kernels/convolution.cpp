@@ -14,6 +14,7 @@
 
 #include "conv_block.simd.hpp"
 #include "layers/cpu_kernels/conv_block.simd_declarations.hpp" // defines CV_CPU_DISPATCH_MODES_ALL=AVX2,...,BASELINE based on CMakeLists.txt content
+#include "opencv2/core/hal/hal.hpp"
 #include <opencv2/core/utils/logger.hpp>
 
 namespace cv { namespace dnn {
@@ -192,6 +193,14 @@ Ptr<FastConv> initFastConv(
     }
 #endif
 
+    conv->useFP16Weights = false;
+#if CV_TRY_AVX2
+    // There is no FP16 arithmetic on x86, but the weights can be kept in FP16 and converted on the fly.
+    // It halves the memory footprint and the bandwidth of the weights, the accuracy is the same as on ARM.
+    if (_useFP16 && conv->conv_type == CONV_TYPE_GENERIC && conv->useAVX2 && checkHardwareSupport(CPU_FP16))
+        conv->useFP16Weights = true;
+#endif
+
     float *srcWeights = (float *)weightsMat.data;
     if (conv->conv_type == CONV_TYPE_DEPTHWISE || conv->conv_type == CONV_TYPE_DEPTHWISE_REMAIN)
     {
@@ -376,6 +385,11 @@ Ptr<FastConv> initFastConv(
         }
         else
 #endif
+        if (conv->useFP16Weights)
+        {
+            conv->weightsBuf_FP16.resize(nweights + VEC_ALIGN);
+        }
+        else
         {
             conv->weightsBuf.resize(nweights + VEC_ALIGN);
             weightsPtr = conv->getWeights();
@@ -414,6 +428,38 @@ Ptr<FastConv> initFastConv(
         }
         else
 #endif
+        if (conv->useFP16Weights)
+        {
+            // the same layout as FP32 weights, so the FP32 micro-kernels are used with the converted weights.
+            hfloat* weightsPtr_FP16 = conv->getWeightsFP16();
+            parallel_for_(Range(0, ngroups * numStripsMR), [&](const Range& r0){
+            for (int gsi = r0.start; gsi < r0.end; gsi++)
+            {
+                int g = gsi / numStripsMR;
+                int si = gsi - g * numStripsMR;
+
+                int startK = si * CONV_MR_FP32;
+                CV_Assert(startK < Kg_aligned);
+
+                hfloat* packed_wptr = weightsPtr_FP16 + DkHkWkCg * (startK + g * Kg_aligned);
+                int dk = Kg - startK < CONV_MR_FP32 ? Kg - startK : CONV_MR_FP32; // check if we need zero padding.
+
+                int k_idx = g*Kg + startK;
+                for(int hwd = 0; hwd < Hk*Wk*Dk; hwd++)
+                {
+                    for(int c = 0; c < Cg; c++, packed_wptr += CONV_MR_FP32)
+                    {
+                        const float* wptr = srcWeights + wstep * k_idx + c*Hk*Wk*Dk + hwd;
+                        int k = 0;
+                        for(; k < dk; k++, wptr += wstep)
+                            packed_wptr[k] = hfloat(*wptr);
+                        for(; k < CONV_MR_FP32; k++)
+                            packed_wptr[k] = hfloat(0.f);
+                    }
+                }
+            }});
+        }
+        else
         {
             parallel_for_(Range(0, ngroups * numStripsMR), [&](const Range& r0){
             for (int gsi = r0.start; gsi < r0.end; gsi++)
@@ -1260,6 +1306,8 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
         esz = sizeof(__fp16);
     }
 #endif
+    // size of the packed weights, the inputs and the outputs are FP32 when only the weights are FP16
+    const int wesz = conv->useFP16Weights ? (int)sizeof(hfloat) : esz;
 
     int MAX_STRIPES = conv->conv_type == CONV_TYPE_DEPTHWISE_REMAIN ? 1 : (56 + CONV_NR - 1)/CONV_NR;
 
@@ -1289,7 +1337,10 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
     size_t stripesize = alignSize(CONV_NR * ksize * Cg, VEC_ALIGN);
     size_t cbufsize = alignSize(CONV_NR * K_BLOCK_SIZE * MAX_STRIPES, VEC_ALIGN);
 
-    size_t taskbufsize = cbufsize * sizeof(float );
+    // FP16 weights of the current (K_BLOCK_SIZE x C_BLOCK_SIZE) block converted to FP32
+    size_t wbufsize = conv->useFP16Weights ? alignSize(K_BLOCK_SIZE * C_BLOCK_SIZE, VEC_ALIGN) : 0;
+
+    size_t taskbufsize = (cbufsize + wbufsize) * sizeof(float );
 
     if (!separateIm2col)
         taskbufsize += MAX_STRIPES * stripesize * esz;
@@ -1372,7 +1423,8 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
     for (int task_id = r0.start; task_id < r0.end; task_id++)
     {
         float * cbuf_task = (float *)(inpbuf_all + taskbufsize * task_id);
-        char * inpbuf_task = (char*)(cbuf_task + cbufsize);
+        float * wbuf_task = cbuf_task + cbufsize;
+        char * inpbuf_task = (char*)(wbuf_task + wbufsize);
 
         int ngs0 = (int)((size_t)nsubtasks * task_id / ntasks);
         int ngs1 = (int)((size_t)nsubtasks * (task_id+1) / ntasks);
@@ -1432,6 +1484,12 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
                 }
                 else
 #endif
+                if (conv->useFP16Weights)
+                {
+                    CV_Assert(!conv->weightsBuf_FP16.empty());
+                    weights = (char *)conv->getWeightsFP16();
+                }
+                else
                 {
                     CV_Assert(!conv->weightsBuf.empty());
                     weights = (char *)conv->getWeights();
@@ -1489,7 +1547,7 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
                 }
 
                 CV_Assert(weights);
-                weights += g * Kg_aligned * DkHkWkCg * esz;
+                weights += g * Kg_aligned * DkHkWkCg * wesz;
 
                 const float *biasptr = conv->biasBuf.data() + Kg * g;
                 int ldc = nstripes * CONV_NR;
@@ -1502,6 +1560,17 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
                     for (int c0 = 0; c0 < DkHkWkCg; c0 += C_BLOCK_SIZE)
                     {
                         int c1 = c0 + C_BLOCK_SIZE < DkHkWkCg ? c0 + C_BLOCK_SIZE : DkHkWkCg;
+                        const char *wptr0 = weights + (k0_block * DkHkWkCg + c0 * CONV_MR) * wesz;
+                        size_t wstep = DkHkWkCg * CONV_MR * wesz;
+                        if (conv->useFP16Weights)
+                        {
+                            // convert the block of weights once, it is reused by all the stripes
+                            int npanel = (c1 - c0) * CONV_MR;
+                            for (int k = k0_block; k < k1_block; k += CONV_MR, wptr0 += wstep)
+                                hal::cvt16f32f((const hfloat *)wptr0, wbuf_task + (k - k0_block) * (c1 - c0), npanel);
+                            wptr0 = (const char *)wbuf_task;
+                            wstep = npanel * sizeof(float);
+                        }
                         const char *inptr = separateIm2col ? inpbuf_all_0 + (ng * stripes_per_plane0 + zyx0 / CONV_NR) * stripesize * esz :
                                             inpbuf_task;
                         inptr += (c0 * CONV_NR) * esz;
@@ -1509,11 +1578,11 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
                         {
                             const int outLen = std::min(out_width - stripe * CONV_NR, CONV_NR);
 
-                            char *wptr = weights + (k0_block * DkHkWkCg + c0 * CONV_MR) * esz;
+                            const char *wptr = wptr0;
                             float *cptr = cbuf_task + stripe * CONV_NR;
                             hfloat* cptr_f16 = (hfloat*)cbuf_task + stripe*CONV_NR;
                             for (int k = k0_block; k < k1_block; k += CONV_MR,
-                                    wptr += DkHkWkCg * CONV_MR * esz, cptr += CONV_MR * ldc, cptr_f16 += CONV_MR * ldc)
+                                    wptr += wstep, cptr += CONV_MR * ldc, cptr_f16 += CONV_MR * ldc)
                             {
 #if CV_TRY_AVX2
                                 if (conv->useAVX2)
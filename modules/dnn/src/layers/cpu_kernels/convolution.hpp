@@ -70,6 +70,7 @@ struct FastConv
     int conv_type;
     int conv_dim;  // Flag for conv1d, conv2d, or conv3d.
     bool useFP16 = false; // Only ARMv8 is supported.
+    bool useFP16Weights = false; // x86: FP32 computations with the generic weights stored in FP16 (F16C).
 #if CV_SIMD128
     bool useSIMD128 = true;
 #else
@@ -225,6 +225,43 @@ void fastGemm(bool trans_a, int M, int N, int K,
     }
 }
 
+void fastGemm(bool trans_a, int M, int N, int K,
+              float alpha, const float *A, int lda,
+              const hfloat *packed_B, float beta,
+              float *C, int ldc, FastGemmOpt &opt) {
+    const char *a = (const char *)A;
+    char *c = (char *)C;
+
+    int lda0 = lda, lda1 = 1;
+    if (trans_a) {
+        std::swap(lda0, lda1);
+    }
+
+#if CV_TRY_NEON
+    if (opt.use_neon) {
+        opt_NEON::fastGemmKernel(M, N, K, alpha, a, lda0, lda1, packed_B, beta, c, ldc, opt.multi_thread);
+    } else
+#endif
+#if CV_TRY_AVX2
+    if (opt.use_avx2) {
+        opt_AVX2::fastGemmKernel(M, N, K, alpha, a, lda0, lda1, packed_B, beta, c, ldc, opt.multi_thread);
+    } else
+#endif
+#if CV_TRY_AVX
+    if (opt.use_avx) {
+        opt_AVX::fastGemmKernel(M, N, K, alpha, a, lda0, lda1, packed_B, beta, c, ldc, opt.multi_thread);
+    } else
+#endif
+#if CV_TRY_LASX
+    if (opt.use_lasx) {
+        opt_LASX::fastGemmKernel(M, N, K, alpha, a, lda0, lda1, packed_B, beta, c, ldc, opt.multi_thread);
+    } else
+#endif
+    {
+        CV_Error(Error::StsNotImplemented, "fastGemm: FP16 packed B requires SIMD kernels");
+    }
+}
+
 void fastGemm(bool trans_a, bool trans_b, int ma, int na, int mb, int nb,
               float alpha, const float *A, int lda0, int lda1, const float *B, int ldb0, int ldb1,
               float beta, float *C, int ldc, FastGemmOpt &opt) {
@@ -203,14 +203,14 @@ public:
     class FullyConnected : public ParallelLoopBody
     {
     public:
-        FullyConnected() : srcMat(0), weights(0), biasMat(0), activ(0), dstMat(0), nstripes(0), useAVX(false), useAVX2(false), useAVX512(false), useRVV(false), useLASX(false) {}
+        FullyConnected() : srcMat(0), weights(0), biasMat(0), activ(0), dstMat(0), nstripes(0), useFP16Weights(false), useAVX(false), useAVX2(false), useAVX512(false), useRVV(false), useLASX(false) {}
 
         static void run(const Mat& srcMat, const Mat& weights, const Mat& biasMat,
                         Mat& dstMat, const ActivationLayer* activ, int nstripes)
         {
             CV_Assert( srcMat.dims == 2 && srcMat.cols == weights.cols &&
                        dstMat.rows == srcMat.rows && dstMat.cols == weights.rows &&
-                       srcMat.type() == weights.type() && weights.type() == dstMat.type() &&
+                       (srcMat.type() == weights.type() || weights.type() == CV_16F) && srcMat.type() == dstMat.type() &&
                        srcMat.type() == CV_32F &&
                        (biasMat.empty() || (biasMat.type() == srcMat.type() &&
                                            biasMat.isContinuous() && (int)biasMat.total() == dstMat.cols)) );
@@ -228,6 +228,8 @@ public:
             p.useAVX512 = CV_CPU_HAS_SUPPORT_AVX512_SKX;
             p.useRVV = checkHardwareSupport(CPU_RVV);
             p.useLASX = checkHardwareSupport(CPU_LASX);
+            p.useFP16Weights = weights.type() == CV_16F;
+            CV_Assert(!p.useFP16Weights || (CV_TRY_AVX2 && p.useAVX2));
 
             parallel_for_(Range(0, nstripes), p, nstripes);
         }
@@ -262,6 +264,11 @@ public:
 
                 memcpy(sptr, sptr_, vecsize*sizeof(sptr[0]));
 
+            #if CV_TRY_AVX2
+                if( useFP16Weights )
+                    opt_AVX2::fastGEMM1T_W16( sptr, weights->ptr<hfloat>(delta), wstep, biasptr, dptr, nw, vecsize_aligned);
+                else
+            #endif
             #if CV_TRY_AVX512_SKX
                 if( useAVX512 )
                     opt_AVX512_SKX::fastGEMM1T( sptr, wptr, wstep, biasptr, dptr, nw, vecsize_aligned);
@@ -337,6 +344,7 @@ public:
         const ActivationLayer* activ;
         Mat* dstMat;
         int nstripes;
+        bool useFP16Weights;
         bool useAVX;
         bool useAVX2;
         bool useAVX512;
@@ -344,14 +352,17 @@ public:
         bool useLASX;
     };
 
-#ifdef HAVE_OPENCL
     virtual void finalize(InputArrayOfArrays, OutputArrayOfArrays) CV_OVERRIDE
     {
+#ifdef HAVE_OPENCL
         innerProductOp.release();
         umat_blobs.clear();
         half_blobs.clear();
+#endif
+        weightsMat_FP16.release();
     }
 
+#ifdef HAVE_OPENCL
     bool forward_ocl(InputArrayOfArrays inps, OutputArrayOfArrays outs, InputArrayOfArrays internals)
     {
         std::vector<UMat> inputs;
@@ -520,6 +531,16 @@ public:
 
         if (!blobs.empty())
         {
+#if CV_TRY_AVX2
+            // x86 DNN_TARGET_CPU_FP16: FP16 weights (with the same zero padding), converted on the fly with F16C
+            if (preferableTarget == DNN_TARGET_CPU_FP16 && weightsMat_FP16.empty() &&
+                checkHardwareSupport(CPU_AVX2) && checkHardwareSupport(CPU_FP16))
+            {
+                Mat weightsBuf(weightsMat.rows, (int)weightsMat.step1(), weightsMat.type(), weightsMat.data, weightsMat.step);
+                weightsBuf.convertTo(weightsMat_FP16, CV_16F);
+                weightsMat_FP16 = weightsMat_FP16.colRange(0, weightsMat.cols);
+            }
+#endif
             int inp1Dim = input[0].dims;
             if (isMatMul)
             {
@@ -535,7 +556,7 @@ public:
                     Mat srcMat = srcMatTmp.row(n).reshape(1, outerSize);
                     Mat dstMat = dstMatTmp.row(n).reshape(1, outerSize);
                     rowStart = (rowStart + rowMatMul) % weightsMat.rows;
-                    Mat weiMat = weightsMat.rowRange(rowStart, rowStart + rowMatMul);
+                    Mat weiMat = (weightsMat_FP16.empty() ? weightsMat : weightsMat_FP16).rowRange(rowStart, rowStart + rowMatMul);
 
                     const int nstripes = getNumThreads();
                     FullyConnected::run(srcMat, weiMat, biasMat, dstMat, activ.get(), nstripes);
@@ -552,7 +573,7 @@ public:
                     Mat dstMat = output[i].reshape(1, outerSize);
 
                     const int nstripes = getNumThreads();
-                    FullyConnected::run(srcMat, weightsMat, biasMat, dstMat, activ.get(), nstripes);
+                    FullyConnected::run(srcMat, weightsMat_FP16.empty() ? weightsMat : weightsMat_FP16, biasMat, dstMat, activ.get(), nstripes);
                 }
             }
         }
@@ -938,6 +959,7 @@ public:
 
     bool bias;
     Mat weightsMat, biasMat, oriMat;
+    Mat weightsMat_FP16; // DNN_TARGET_CPU_FP16 on x86
     bool transA, transB;
     bool isMatMul = false;
     Ptr<ActivationLayer> activ;
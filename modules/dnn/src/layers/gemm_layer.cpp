@@ -17,6 +17,7 @@ using namespace cv::dnn::cuda4dnn;
 
 #include <opencv2/dnn/shape_utils.hpp>
 #include "cpu_kernels/fast_gemm.hpp"
+#include "opencv2/core/hal/hal.hpp"
 
 namespace cv { namespace dnn {
 
@@ -147,6 +148,8 @@ public:
         opt.init();
 
         // pack B if it is const
+        packed_B.clear();
+        packed_B_FP16.clear();
         if (const_B) {
             fastGemmPackB(blobs[0], packed_B, trans_b, opt);
         }
@@ -207,7 +210,20 @@ public:
             std::memset(ptr_y, 0, total * sizeof(float));
         }
 
-        if (const_B) {
+#if CV_TRY_AVX2
+        // x86 DNN_TARGET_CPU_FP16: FP16 weights with the same layout, converted back to FP32 block by block (F16C)
+        if (const_B && preferableTarget == DNN_TARGET_CPU_FP16 && packed_B_FP16.empty() &&
+            opt.use_avx2 && checkHardwareSupport(CPU_FP16)) {
+            CV_CheckGT(packed_B.size(), static_cast<size_t>(0), "DNN/Gemm: constant B is not pre-packed");
+            packed_B_FP16.resize(packed_B.size());
+            hal::cvt32f16f(packed_B.data(), packed_B_FP16.data(), (int)packed_B.size());
+            std::vector<float>().swap(packed_B);
+        }
+#endif
+
+        if (const_B && !packed_B_FP16.empty()) {
+            fastGemm(trans_a, M, N, K, alpha, A.ptr<const float>(), na, packed_B_FP16.data(), 1.f, Y.ptr<float>(), N, opt);
+        } else if (const_B) {
             CV_CheckGT(packed_B.size(), static_cast<size_t>(0), "DNN/Gemm: constant B is not pre-packed");
             fastGemm(trans_a, M, N, K, alpha, A.ptr<const float>(), na, packed_B.data(), 1.f, Y.ptr<float>(), N, opt);
         } else {
@@ -369,6 +385,7 @@ private:
     bool const_C;
     bool have_bias;
     std::vector<float> packed_B;
+    std::vector<hfloat> packed_B_FP16; // DNN_TARGET_CPU_FP16 on x86
     std::vector<float> broadcast_C;
     int real_ndims_C;
     FastGemmOpt opt;
@@ -59,6 +59,8 @@ Net::Impl::Impl()
     preferableTarget = DNN_TARGET_CPU;
     hasDynamicShapes = false;
     useWinograd = true;
+    parallelBranches = false;
+    layerBlobsReallocated = false;
 }
 
 
@@ -92,6 +94,9 @@ void Net::Impl::clear()
     }
     netWasAllocated = false;
     layersTimings.clear();
+    layerWaves.clear();
+    layerWavesBlobs.clear();
+    layerBlobsReallocated = false;
 }
 
 
@@ -221,6 +226,9 @@ void Net::Impl::setUpNet(const std::vector<LayerPin>& blobsToKeep_)
             dumpNetworkToFile();
         }
     }
+
+    if (parallelBranches && layerWaves.empty())
+        buildLayerWaves();
 }
 
 
@@ -872,17 +880,39 @@ void Net::Impl::forwardToLayer(LayerData& ld, bool clearFlags)
     if (ld.flag)
         return;
 
-    // forward parents
-    for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end() && (it->second.id < ld.id); ++it)
+    // the blobs have been reallocated after setUpNet(), e.g. by setInput() with another type
+    if (!layerWaves.empty() && isLayerWavesOutdated())
+        buildLayerWaves();
+
+    bool sequential = layerWaves.empty();
+    // forward parents and itself, independent layers run concurrently
+    for (size_t i = 0; i < layerWaves.size() && !sequential; i++)
+        sequential = !forwardLayerWave(layerWaves[i], ld.id);
+
+    if (sequential && !layerWaves.empty())
     {
-        LayerData& ld = it->second;
-        if (ld.flag)
-            continue;
-        forwardLayer(ld);
+        // a layer with dynamic shapes has reallocated its blobs: the memory dependencies of the waves
+        // are not known anymore, the layers are executed one by one
+        layerBlobsReallocated = true;
+        layerWaves.clear();
+        layerWavesBlobs.clear();
     }
 
-    // forward itself
-    forwardLayer(ld);
+    if (sequential)
+    {
+        // forward parents
+        for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end() && (it->second.id < ld.id); ++it)
+        {
+            LayerData& ld = it->second;
+            if (ld.flag)
+                continue;
+            forwardLayer(ld);
+        }
+
+        // forward itself
+        if (!ld.flag)
+            forwardLayer(ld);
+    }
 
 #ifdef HAVE_CUDA
     if (preferableBackend == DNN_BACKEND_CUDA)
@@ -66,6 +66,12 @@ struct Net::Impl : public detail::NetImplBase
     bool fusion;
     bool isAsync;  // FIXIT: drop
     bool useWinograd;
+    bool parallelBranches;
+    // Layer ids split into waves of mutually independent layers, see buildLayerWaves().
+    // Empty when the layers are executed one by one.
+    std::vector<std::vector<int> > layerWaves;
+    std::map<int, std::vector<const uchar*> > layerWavesBlobs;  // blob pointers the waves are built for
+    bool layerBlobsReallocated;  // a layer has reallocated its blobs in forward(), the waves are not used
     std::vector<int64> layersTimings;
 
 
@@ -215,6 +221,11 @@ struct Net::Impl : public detail::NetImplBase
 
     virtual void fuseLayers(const std::vector<LayerPin>& blobsToKeep_);
     void enableWinograd(bool useWinograd_);
+    void enableParallelBranches(bool enable);
+    void buildLayerWaves();
+    bool isLayerWavesOutdated();
+    bool isLayerWavesOutdated(const std::vector<int>& layerIds);
+    bool forwardLayerWave(const std::vector<int>& wave, int maxLayerId);
 
     void allocateLayers(const std::vector<LayerPin>& blobsToKeep_);
 
@@ -245,8 +245,16 @@ void Net::Impl::setPreferableTarget(int targetId)
 #if !defined(__arm64__) || !__arm64__
         if (targetId == DNN_TARGET_CPU_FP16)
         {
-            CV_LOG_WARNING(NULL, "DNN: fall back to DNN_TARGET_CPU. Only ARM v8 CPU is supported by DNN_TARGET_CPU_FP16.");
-            targetId = DNN_TARGET_CPU;
+#if CV_TRY_AVX2
+            const bool haveCPU_FP16 = checkHardwareSupport(CPU_AVX2) && checkHardwareSupport(CPU_FP16);
+#else
+            const bool haveCPU_FP16 = false;
+#endif
+            if (!haveCPU_FP16)
+            {
+                CV_LOG_WARNING(NULL, "DNN: fall back to DNN_TARGET_CPU. Only ARM v8 and x86 CPUs with AVX2 and F16C are supported by DNN_TARGET_CPU_FP16.");
+                targetId = DNN_TARGET_CPU;
+            }
         }
 #endif
 
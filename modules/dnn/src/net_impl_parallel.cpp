@@ -0,0 +1,260 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+#include <opencv2/core/private.hpp>
+
+#include "net_impl.hpp"
+
+namespace cv {
+namespace dnn {
+CV__DNN_INLINE_NS_BEGIN
+
+
+/*
+ * Inter-layer parallelism
+ *
+ * The layers are split into waves: a layer is placed into the wave next to the last wave of the layers
+ * it depends on. A layer depends on the previous (by id) layers whose outputs it consumes and on the
+ * previous layers which use the same memory: BlobManager reuses the buffers released by the previous
+ * layers, in-place layers write into their inputs, fused layers write into the buffers of their
+ * consumers. So the layers of a wave are independent and run concurrently with parallel_for_().
+ *
+ * The memory dependencies are computed for the blobs allocated by setUpNet(). The layers with dynamic
+ * shapes may reallocate their outputs in forward(): then the rest of the pass and the next passes run
+ * layer by layer, until the net is set up again for new input shapes.
+ *
+ * Nested parallel_for_() calls share the thread pool of the "workstealing" parallel framework. Other
+ * frameworks execute nested calls sequentially, so the heavy layers are placed into separate waves to
+ * keep their own parallelism, and only the light ones run concurrently.
+ */
+
+// FLOPs of a layer which is worth to be parallelized inside
+static const int64 HEAVY_LAYER_FLOPS = 10000000;
+
+namespace {
+
+struct MemRange
+{
+    const uchar* begin;
+    const uchar* end;
+};
+
+static void addMemRange(std::vector<MemRange>& ranges, const Mat& m)
+{
+    if (!m.empty())
+        ranges.push_back(MemRange{m.data, m.dataend});
+}
+
+static bool intersects(const std::vector<MemRange>& a, const std::vector<MemRange>& b)
+{
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        for (size_t j = 0; j < b.size(); j++)
+        {
+            if (a[i].begin < b[j].end && b[j].begin < a[i].end)
+                return true;
+        }
+    }
+    return false;
+}
+
+// data pointers of all the blobs of a layer, a change means that the memory ranges of the waves are outdated
+static void getBlobPointers(const LayerData& ld, std::vector<const uchar*>& ptrs)
+{
+    ptrs.clear();
+    for (size_t i = 0; i < ld.inputBlobs.size(); i++)
+    {
+        if (ld.inputBlobs[i])
+        {
+            ptrs.push_back(ld.inputBlobs[i]->data);
+            ptrs.push_back(ld.inputBlobs[i]->dataend);
+        }
+    }
+    for (size_t i = 0; i < ld.outputBlobs.size(); i++)
+    {
+        ptrs.push_back(ld.outputBlobs[i].data);
+        ptrs.push_back(ld.outputBlobs[i].dataend);
+    }
+    for (size_t i = 0; i < ld.internals.size(); i++)
+    {
+        ptrs.push_back(ld.internals[i].data);
+        ptrs.push_back(ld.internals[i].dataend);
+    }
+}
+
+static bool isNestedParallelForSupported()
+{
+    const char* framework = currentParallelFramework();
+    return framework && std::string(framework) == "workstealing";
+}
+
+}  // namespace
+
+
+void Net::Impl::enableParallelBranches(bool enable)
+{
+    if (parallelBranches != enable)
+    {
+        parallelBranches = enable;
+        layerWaves.clear();  // rebuilt by setUpNet()
+        layerWavesBlobs.clear();
+    }
+}
+
+
+void Net::Impl::buildLayerWaves()
+{
+    CV_TRACE_FUNCTION();
+
+    layerWaves.clear();
+    layerWavesBlobs.clear();
+    if (layerBlobsReallocated || preferableBackend != DNN_BACKEND_OPENCV || !IS_DNN_CPU_TARGET(preferableTarget) || getNumThreads() <= 1)
+        return;
+
+    const bool nested = isNestedParallelForSupported();
+    std::vector<LayerData*> lds;
+    std::vector<std::vector<MemRange> > reads, writes;
+    std::vector<int> waveIdx;
+    std::map<int, int> idToIdx;
+    std::vector<bool> heavy;
+    for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        LayerData& ld = it->second;
+        const int idx = (int)lds.size();
+        lds.push_back(&ld);
+        idToIdx[ld.id] = idx;
+
+        getBlobPointers(ld, layerWavesBlobs[ld.id]);
+
+        std::vector<MemRange> r, w;
+        std::vector<MatShape> inpShapes, outShapes;
+        for (size_t i = 0; i < ld.inputBlobs.size(); i++)
+        {
+            if (!ld.inputBlobs[i])
+                continue;
+            addMemRange(r, *ld.inputBlobs[i]);
+            inpShapes.push_back(shape(*ld.inputBlobs[i]));
+        }
+        for (size_t i = 0; i < ld.outputBlobs.size(); i++)
+        {
+            addMemRange(w, ld.outputBlobs[i]);
+            outShapes.push_back(shape(ld.outputBlobs[i]));
+        }
+        for (size_t i = 0; i < ld.internals.size(); i++)
+            addMemRange(w, ld.internals[i]);
+
+        int wave = 0;
+        for (size_t i = 0; i < ld.inputBlobsId.size(); i++)
+        {
+            std::map<int, int>::const_iterator src = idToIdx.find(ld.inputBlobsId[i].lid);
+            if (src != idToIdx.end())
+                wave = std::max(wave, waveIdx[src->second] + 1);
+        }
+        for (int j = 0; j < idx; j++)
+        {
+            if (waveIdx[j] >= wave &&
+                (intersects(writes[j], r) || intersects(writes[j], w) || intersects(reads[j], w)))
+                wave = waveIdx[j] + 1;
+        }
+        reads.push_back(r);
+        writes.push_back(w);
+        waveIdx.push_back(wave);
+
+        bool isHeavy = false;
+        if (!nested && !ld.skip && ld.layerInstance)
+            isHeavy = ld.layerInstance->getFLOPS(inpShapes, outShapes) >= HEAVY_LAYER_FLOPS;
+        heavy.push_back(isHeavy);
+
+        if ((int)layerWaves.size() <= wave)
+            layerWaves.resize(wave + 1);
+        layerWaves[wave].push_back(ld.id);
+    }
+
+    if (!nested)
+    {
+        // heavy layers of a wave run one by one with all threads, then the light ones run concurrently
+        std::vector<std::vector<int> > waves;
+        for (size_t i = 0; i < layerWaves.size(); i++)
+        {
+            const std::vector<int>& wave = layerWaves[i];
+            std::vector<int> light;
+            for (size_t j = 0; j < wave.size(); j++)
+            {
+                if (heavy[idToIdx[wave[j]]] && wave.size() > 1)
+                    waves.push_back(std::vector<int>(1, wave[j]));
+                else
+                    light.push_back(wave[j]);
+            }
+            if (!light.empty())
+                waves.push_back(light);
+        }
+        layerWaves.swap(waves);
+    }
+
+    CV_LOG_DEBUG(NULL, "DNN: " << layers.size() << " layers are scheduled in " << layerWaves.size() << " waves");
+    fprintf(stderr, "DBG %d waves\n", (int)layerWaves.size());
+}
+
+
+bool Net::Impl::isLayerWavesOutdated(const std::vector<int>& layerIds)
+{
+    std::vector<const uchar*> ptrs;
+    for (size_t i = 0; i < layerIds.size(); i++)
+    {
+        std::map<int, std::vector<const uchar*> >::const_iterator it = layerWavesBlobs.find(layerIds[i]);
+        if (it == layerWavesBlobs.end())
+            return true;
+        getBlobPointers(layers[layerIds[i]], ptrs);
+        if (ptrs != it->second)
+            return true;
+    }
+    return false;
+}
+
+
+bool Net::Impl::isLayerWavesOutdated()
+{
+    std::vector<int> layerIds;
+    for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); ++it)
+        layerIds.push_back(it->first);
+    return isLayerWavesOutdated(layerIds);
+}
+
+
+bool Net::Impl::forwardLayerWave(const std::vector<int>& wave, int maxLayerId)
+{
+    std::vector<LayerData*> pending;
+    for (size_t i = 0; i < wave.size(); i++)
+    {
+        if (wave[i] > maxLayerId)
+            continue;
+        LayerData& ld = layers[wave[i]];
+        if (!ld.flag)
+            pending.push_back(&ld);
+    }
+
+    if (pending.size() == 1)
+    {
+        forwardLayer(*pending[0]);
+    }
+    else if (pending.size() > 1)
+    {
+        parallel_for_(Range(0, (int)pending.size()), [&](const Range& r)
+        {
+            for (int i = r.start; i < r.end; i++)
+                forwardLayer(*pending[i]);
+        }, (double)pending.size());
+    }
+
+    // a layer has reallocated its blobs, the memory dependencies of the next waves are not valid anymore
+    std::vector<int> pendingIds;
+    for (size_t i = 0; i < pending.size(); i++)
+        pendingIds.push_back(pending[i]->id);
+    return !isLayerWavesOutdated(pendingIds);
+}
+
+
+CV__DNN_INLINE_NS_END
+}}  // namespace cv::dnn
@@ -64,6 +64,9 @@ private:
         bool haveBackendCPU_FP16 = false;
 #if defined(__arm64__) && __arm64__
         haveBackendCPU_FP16 = true;
+#elif CV_TRY_AVX2
+        // x86: convolution weights are stored in FP16, computations are done in FP32
+        haveBackendCPU_FP16 = checkHardwareSupport(CPU_AVX2) && checkHardwareSupport(CPU_FP16);
 #endif
 
         if (haveBackendOpenVINO && openvino::checkTarget(DNN_TARGET_CPU))
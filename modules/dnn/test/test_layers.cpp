@@ -1283,6 +1283,108 @@ TEST_P(Layer_Test_DWconv_Prelu, Accuracy)
 }
 INSTANTIATE_TEST_CASE_P(/**/, Layer_Test_DWconv_Prelu, Combine(Values(3, 6), Values(3, 6)));
 
+// Generic convolution (weights packing, K and output tails) on DNN_TARGET_CPU_FP16 vs DNN_TARGET_CPU
+typedef TestWithParam<tuple<int, int> > Layer_Test_Convolution_CPU_FP16;
+TEST_P(Layer_Test_Convolution_CPU_FP16, Accuracy)
+{
+    std::vector<Target> targets = getAvailableTargets(DNN_BACKEND_OPENCV);
+    if (std::find(targets.begin(), targets.end(), DNN_TARGET_CPU_FP16) == targets.end())
+        throw SkipTestException("DNN_TARGET_CPU_FP16 is not supported");
+
+    const int num_output = get<0>(GetParam());
+    const int kernel = get<1>(GetParam());
+    const int num_input = 21;
+
+    LayerParams lp;
+    lp.name = "conv";
+    lp.type = "Convolution";
+    lp.set("kernel_size", kernel);
+    lp.set("num_output", num_output);
+    lp.set("pad", kernel / 2);
+    lp.set("bias_term", true);
+
+    int weightsShape[] = {num_output, num_input, kernel, kernel};
+    Mat weights(4, weightsShape, CV_32F), bias(1, num_output, CV_32F);
+    randu(weights, -1.0f, 1.0f);
+    randu(bias, -1.0f, 1.0f);
+    lp.blobs.push_back(weights);
+    lp.blobs.push_back(bias);
+
+    int inpShape[] = {1, num_input, 17, 23};
+    Mat input(4, inpShape, CV_32F);
+    randu(input, -1.0f, 1.0f);
+
+    Mat ref, out;
+    for (int i = 0; i < 2; i++)
+    {
+        Net net;
+        net.addLayerToPrev(lp.name, lp.type, lp);
+        net.setPreferableBackend(DNN_BACKEND_OPENCV);
+        net.setPreferableTarget(i == 0 ? DNN_TARGET_CPU : DNN_TARGET_CPU_FP16);
+        net.enableWinograd(false);
+        net.setInput(input);
+        (i == 0 ? ref : out) = net.forward().clone();
+    }
+    // FP16 weights have 11 significant bits, the sums have up to 21*kernel*kernel terms
+    normAssert(ref, out, "", 4e-3 * kernel, 2e-2 * kernel);
+}
+INSTANTIATE_TEST_CASE_P(/**/, Layer_Test_Convolution_CPU_FP16, Combine(Values(3, 8, 30), Values(1, 3)));
+
+// FP16 weights of InnerProduct (fastGEMM1T) and Gemm with constant B (fast_gemm) on DNN_TARGET_CPU_FP16 vs DNN_TARGET_CPU
+typedef TestWithParam<tuple<std::string, int, int> > Layer_Test_FullyConnected_CPU_FP16;
+TEST_P(Layer_Test_FullyConnected_CPU_FP16, Accuracy)
+{
+    std::vector<Target> targets = getAvailableTargets(DNN_BACKEND_OPENCV);
+    if (std::find(targets.begin(), targets.end(), DNN_TARGET_CPU_FP16) == targets.end())
+        throw SkipTestException("DNN_TARGET_CPU_FP16 is not supported");
+
+    const std::string type = get<0>(GetParam());
+    const int batch = get<1>(GetParam());
+    const int num_input = get<2>(GetParam());
+    const int num_output = 37;
+
+    Mat weights(num_output, num_input, CV_32F), bias(1, num_output, CV_32F);
+    randu(weights, -1.0f, 1.0f);
+    randu(bias, -1.0f, 1.0f);
+
+    LayerParams lp;
+    lp.name = "fc";
+    lp.type = type;
+    if (type == "Gemm")
+    {
+        lp.set("transB", true);
+        lp.set("constB", true);
+        lp.set("constC", true);
+        lp.set("have_bias", true);
+        lp.set("real_ndims_C", 2);
+    }
+    else
+    {
+        lp.set("num_output", num_output);
+        lp.set("bias_term", true);
+    }
+    lp.blobs.push_back(weights);
+    lp.blobs.push_back(bias);
+
+    Mat input(batch, num_input, CV_32F);
+    randu(input, -1.0f, 1.0f);
+
+    Mat ref, out;
+    for (int i = 0; i < 2; i++)
+    {
+        Net net;
+        net.addLayerToPrev(lp.name, lp.type, lp);
+        net.setPreferableBackend(DNN_BACKEND_OPENCV);
+        net.setPreferableTarget(i == 0 ? DNN_TARGET_CPU : DNN_TARGET_CPU_FP16);
+        net.setInput(input);
+        (i == 0 ? ref : out) = net.forward().clone();
+    }
+    // FP16 weights have 11 significant bits, the sums have num_input terms
+    normAssert(ref, out, "", 4e-5 * num_input, 2e-4 * num_input);
+}
+INSTANTIATE_TEST_CASE_P(/**/, Layer_Test_FullyConnected_CPU_FP16, Combine(
+    Values("InnerProduct", "Gemm"), Values(1, 5, 40), Values(8, 100, 300)));
+
 #ifdef HAVE_INF_ENGINE
 // Using Intel's Model Optimizer generate .xml and .bin files:
 // ./ModelOptimizer -w /path/to/caffemodel -d /path/to/prototxt \
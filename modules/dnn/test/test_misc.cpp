@@ -242,6 +242,101 @@ TEST(blobFromImagesWithParams_4ch, multi_image)
     EXPECT_EQ(0, cvtest::norm(2 * blob0, blob1, NORM_INF));
 }
 
+typedef testing::TestWithParam<tuple<int, int, int, bool, int> > blobFromImagesWithParams_fused;
+TEST_P(blobFromImagesWithParams_fused, accuracy)
+{
+    const int type = get<0>(GetParam());
+    const DataLayout layout = (DataLayout)get<1>(GetParam());
+    const ImagePaddingMode paddingMode = (ImagePaddingMode)get<2>(GetParam());
+    const bool swapRB = get<3>(GetParam());
+    const int ddepth = get<4>(GetParam());
+    const int cn = CV_MAT_CN(type);
+    if (ddepth == CV_8U && CV_MAT_DEPTH(type) != CV_8U)
+        throw SkipTestException("");
+
+    Image2BlobParams param;
+    param.size = Size(64, 48);
+    param.swapRB = swapRB;
+    param.datalayout = layout;
+    param.paddingmode = paddingMode;
+    param.ddepth = ddepth;
+    param.borderValue = Scalar(5, 300, -7, 11);
+    if (ddepth == CV_32F)
+    {
+        param.mean = Scalar(10.5, 20.25, 30, 40);
+        param.scalefactor = Scalar(0.5, 0.25, 2, 1.5);
+    }
+
+    std::vector<Mat> images;
+    Size sizes[] = { Size(113, 71), Size(113, 71), Size(64, 48), Size(31, 97) };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        Mat img(sizes[i], type);
+        randu(img, 0, 255);
+        images.push_back(img);
+    }
+
+    Mat blob = blobFromImagesWithParams(images, param);
+
+    // reference: resize, pad/crop, convert, normalize and reorder each image separately
+    Scalar mean = param.mean, scale = param.scalefactor;
+    if (swapRB && cn > 2)
+    {
+        std::swap(mean[0], mean[2]);
+        std::swap(scale[0], scale[2]);
+    }
+    for (size_t i = 0; i < images.size(); i++)
+    {
+        Mat img = images[i];
+        Size imgSize = img.size();
+        if (imgSize != param.size)
+        {
+            if (paddingMode == DNN_PMODE_CROP_CENTER)
+            {
+                float f = std::max(param.size.width / (float)imgSize.width, param.size.height / (float)imgSize.height);
+                resize(img, img, Size(), f, f, INTER_LINEAR);
+                img = img(Rect(Point(0.5 * (img.cols - param.size.width), 0.5 * (img.rows - param.size.height)), param.size));
+            }
+            else if (paddingMode == DNN_PMODE_LETTERBOX)
+            {
+                float f = std::min(param.size.width / (float)imgSize.width, param.size.height / (float)imgSize.height);
+                int rh = int(imgSize.height * f), rw = int(imgSize.width * f);
+                resize(img, img, Size(rw, rh), 0, 0, INTER_LINEAR);
+                int top = (param.size.height - rh) / 2, left = (param.size.width - rw) / 2;
+                cv::copyMakeBorder(img, img, top, param.size.height - top - rh, left, param.size.width - left - rw,
+                                   BORDER_CONSTANT, param.borderValue);
+            }
+            else
+                resize(img, img, param.size, 0, 0, INTER_LINEAR);
+        }
+        img.convertTo(img, ddepth);
+        subtract(img, mean, img);
+        cv::multiply(img, scale, img);
+
+        std::vector<Mat> ch;
+        split(img, ch);
+        if (swapRB && cn > 2)
+            std::swap(ch[0], ch[2]);
+        for (int c = 0; c < cn; c++)
+        {
+            Mat plane;
+            if (layout == DNN_LAYOUT_NCHW)
+                plane = Mat(param.size, ddepth, blob.ptr(i, c));
+            else
+                extractChannel(Mat(param.size, CV_MAKETYPE(ddepth, cn), blob.ptr(i)), plane, c);
+            EXPECT_EQ(0, cvtest::norm(ch[c], plane, NORM_INF)) << "image " << i << " channel " << c;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, blobFromImagesWithParams_fused, Combine(
+    Values(CV_8UC1, CV_8UC3, CV_8UC4, CV_32FC3),
+    Values((int)DNN_LAYOUT_NCHW, (int)DNN_LAYOUT_NHWC),
+    Values((int)DNN_PMODE_NULL, (int)DNN_PMODE_CROP_CENTER, (int)DNN_PMODE_LETTERBOX),
+    testing::Bool(),
+    Values(CV_32F, CV_8U)
+));
+
 TEST(readNet, Regression)
 {
     Net net = readNet(findDataFile("dnn/squeezenet_v1.1.prototxt"),
@@ -615,6 +710,168 @@ TEST(Net, forwardAndRetrieve)
     normAssert(outBlobs[0][1], inp.rowRange(2, 4), "second part");
 }
 
+static LayerParams getConvParams(const std::string& name, int inpCn, int outCn, int kernel)
+{
+    LayerParams lp;
+    lp.name = name;
+    lp.type = "Convolution";
+    lp.set("kernel_size", kernel);
+    lp.set("num_output", outCn);
+    lp.set("pad", kernel / 2);
+    lp.set("bias_term", true);
+    int weightsShape[] = {outCn, inpCn, kernel, kernel};
+    Mat weights(4, weightsShape, CV_32F), bias(1, outCn, CV_32F);
+    randu(weights, -0.5f, 0.5f);
+    randu(bias, -0.5f, 0.5f);
+    lp.blobs.push_back(weights);
+    lp.blobs.push_back(bias);
+    return lp;
+}
+
+TEST(Net, parallelBranches)
+{
+    // data -> conv1x1 -> ReLU --+
+    //      -> conv5x5 ----------+-> Concat -> conv1x1 -> Eltwise(sum) -> ReLU
+    //      -> MaxPool ----------+                          ^
+    //      -> conv3x3 -------------------------------------+
+    Net net;
+    LayerParams conv1 = getConvParams("conv1", 8, 8, 1);
+    LayerParams conv2 = getConvParams("conv2", 8, 32, 5);
+    LayerParams conv3 = getConvParams("conv3", 48, 16, 1);
+    LayerParams conv4 = getConvParams("conv4", 8, 16, 3);
+    LayerParams relu, pool, concat, sum;
+    relu.type = "ReLU";
+    pool.type = "Pooling";
+    pool.set("pool", "max");
+    pool.set("kernel_size", 3);
+    pool.set("stride", 1);
+    pool.set("pad", 1);
+    concat.type = "Concat";
+    sum.type = "Eltwise";
+    sum.set("operation", "sum");
+
+    int conv1Id = net.addLayer(conv1.name, conv1.type, conv1);
+    int relu1Id = net.addLayer("relu1", relu.type, relu);
+    int conv2Id = net.addLayer(conv2.name, conv2.type, conv2);
+    int poolId = net.addLayer("pool", pool.type, pool);
+    int concatId = net.addLayer("concat", concat.type, concat);
+    int conv3Id = net.addLayer(conv3.name, conv3.type, conv3);
+    int conv4Id = net.addLayer(conv4.name, conv4.type, conv4);
+    int sumId = net.addLayer("sum", sum.type, sum);
+    int relu2Id = net.addLayer("relu2", relu.type, relu);
+    net.connect(0, 0, conv1Id, 0);
+    net.connect(conv1Id, 0, relu1Id, 0);
+    net.connect(0, 0, conv2Id, 0);
+    net.connect(0, 0, poolId, 0);
+    net.connect(relu1Id, 0, concatId, 0);
+    net.connect(conv2Id, 0, concatId, 1);
+    net.connect(poolId, 0, concatId, 2);
+    net.connect(concatId, 0, conv3Id, 0);
+    net.connect(0, 0, conv4Id, 0);
+    net.connect(conv3Id, 0, sumId, 0);
+    net.connect(conv4Id, 0, sumId, 1);
+    net.connect(sumId, 0, relu2Id, 0);
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+
+    int inpShape[] = {1, 8, 40, 30};
+    Mat inp(4, inpShape, CV_32F);
+    randu(inp, -1.0f, 1.0f);
+
+    std::vector<String> outNames;
+    outNames.push_back("relu2");
+    outNames.push_back("concat");
+    std::vector<Mat> ref, out;
+    net.setInput(inp);
+    net.forward(ref, outNames);
+    ref[0] = ref[0].clone();
+    ref[1] = ref[1].clone();
+
+    const int nthreads = getNumThreads();
+    setNumThreads(std::max(nthreads, 4));  // the layers run concurrently with 2+ threads only
+    net.enableParallelBranches(true);
+    for (int i = 0; i < 3; i++)
+    {
+        net.setInput(inp);
+        net.forward(out, outNames);
+        ASSERT_EQ(ref.size(), out.size());
+        normAssert(ref[0], out[0], "output");
+        normAssert(ref[1], out[1], "concat");
+    }
+
+    net.enableFusion(false);
+    net.setInput(inp);
+    net.forward(out, outNames);
+    normAssert(ref[0], out[0], "output, no fusion");
+    normAssert(ref[1], out[1], "concat, no fusion");
+    setNumThreads(nthreads);
+}
+
+// Allocates a new output buffer on every forward() like the layers with dynamic shapes do
+class ReallocatingCustomLayer CV_FINAL : public Layer
+{
+public:
+    ReallocatingCustomLayer(const LayerParams &params) : Layer(params) {}
+
+    static Ptr<Layer> create(LayerParams& params)
+    {
+        return Ptr<Layer>(new ReallocatingCustomLayer(params));
+    }
+
+    void forward(InputArrayOfArrays inputs_arr, OutputArrayOfArrays outputs_arr, OutputArrayOfArrays) CV_OVERRIDE
+    {
+        std::vector<Mat> inputs;
+        inputs_arr.getMatVector(inputs);
+        Mat out;
+        inputs[0].convertTo(out, -1, 2.0);
+        outputs_arr.getMatRef(0) = out;
+    }
+};
+
+TEST(Net, parallelBranches_reallocated_outputs)
+{
+    CV_DNN_REGISTER_LAYER_CLASS(ReallocatingCustomType, ReallocatingCustomLayer);
+
+    // data -> custom -> conv1x1 --+
+    //      -> conv3x3 ------------+-> Eltwise(sum)
+    Net net;
+    LayerParams conv1 = getConvParams("conv1", 8, 16, 1);
+    LayerParams conv2 = getConvParams("conv2", 8, 16, 3);
+    LayerParams custom, sum;
+    custom.type = "ReallocatingCustomType";
+    sum.type = "Eltwise";
+    sum.set("operation", "sum");
+
+    int customId = net.addLayer("custom", custom.type, custom);
+    int conv1Id = net.addLayer(conv1.name, conv1.type, conv1);
+    int conv2Id = net.addLayer(conv2.name, conv2.type, conv2);
+    int sumId = net.addLayer("sum", sum.type, sum);
+    net.connect(0, 0, customId, 0);
+    net.connect(customId, 0, conv1Id, 0);
+    net.connect(0, 0, conv2Id, 0);
+    net.connect(conv1Id, 0, sumId, 0);
+    net.connect(conv2Id, 0, sumId, 1);
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+
+    int inpShape[] = {1, 8, 20, 30};
+    Mat inp(4, inpShape, CV_32F);
+    randu(inp, -1.0f, 1.0f);
+
+    net.setInput(inp);
+    Mat ref = net.forward().clone();
+
+    const int nthreads = getNumThreads();
+    setNumThreads(std::max(nthreads, 4));  // the layers run concurrently with 2+ threads only
+    net.enableParallelBranches(true);
+    for (int i = 0; i < 3; i++)
+    {
+        net.setInput(inp);
+        Mat out = net.forward();
+        normAssert(ref, out, cv::format("iteration %d", i).c_str());
+    }
+    setNumThreads(nthreads);
+    LayerFactory::unregisterLayer("ReallocatingCustomType");
+}
+
 #ifdef HAVE_INF_ENGINE
 static const std::chrono::milliseconds async_timeout(10000);
 
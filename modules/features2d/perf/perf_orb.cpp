@@ -0,0 +1,34 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+#include "perf_precomp.hpp"
+#include "opencv2/imgproc.hpp"
+
+namespace opencv_test
+{
+using namespace perf;
+
+typedef TestBaseWithParam<Size> ORB_Size;
+
+PERF_TEST_P(ORB_Size, detectAndCompute, testing::Values(szVGA, sz1080p, sz2160p))
+{
+    const Size sz = GetParam();
+    // textured frame: smooth noise
+    Mat img(sz, CV_8UC1);
+    RNG rng(12345);
+    rng.fill(img, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+    GaussianBlur(img, img, Size(7, 7), 0);
+
+    Ptr<ORB> orb = ORB::create(2000);
+    declare.in(img);
+    vector<KeyPoint> points;
+    Mat descriptors;
+
+    TEST_CYCLE() orb->detectAndCompute(img, noArray(), points, descriptors);
+
+    EXPECT_GT(points.size(), 1000u);
+    EXPECT_EQ((size_t)descriptors.rows, points.size());
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
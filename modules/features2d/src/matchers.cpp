@@ -1450,13 +1450,7 @@ void FlannBasedMatcher::radiusMatchImpl( InputArray _queryDescriptors, std::vect
     const int count = mergedDescriptors.size(); // TODO do count as param?
     Mat indices( queryDescriptors.rows, count, CV_32SC1, Scalar::all(-1) );
     Mat dists( queryDescriptors.rows, count, CV_32FC1, Scalar::all(-1) );
-    for( int qIdx = 0; qIdx < queryDescriptors.rows; qIdx++ )
-    {
-        Mat queryDescriptorsRow = queryDescriptors.row(qIdx);
-        Mat indicesRow = indices.row(qIdx);
-        Mat distsRow = dists.row(qIdx);
-        flannIndex->radiusSearch( queryDescriptorsRow, indicesRow, distsRow, maxDistance*maxDistance, count, *searchParams );
-    }
+    flannIndex->radiusSearch( queryDescriptors, indices, dists, maxDistance*maxDistance, count, *searchParams );
 
     convertToDMatches( mergedDescriptors, indices, dists, matches );
 }
@@ -135,7 +135,7 @@ HarrisResponses(const Mat& img, const std::vector<Rect>& layerinfo,
     CV_CheckGT(blockSize, 0, "");
     CV_CheckLE(blockSize*blockSize, 2048, "");
 
-    size_t ptidx, ptsize = pts.size();
+    size_t ptsize = pts.size();
 
     const uchar* ptr00 = img.ptr<uchar>();
     size_t size_t_step = img.step;
@@ -153,27 +153,30 @@ HarrisResponses(const Mat& img, const std::vector<Rect>& layerinfo,
         for( int j = 0; j < blockSize; j++ )
             ofs[i*blockSize + j] = (int)(i*step + j);
 
-    for( ptidx = 0; ptidx < ptsize; ptidx++ )
+    parallel_for_(Range(0, (int)ptsize), [&](const Range& range)
     {
-        int x0 = cvRound(pts[ptidx].pt.x);
-        int y0 = cvRound(pts[ptidx].pt.y);
-        int z = pts[ptidx].octave;
+        for( int ptidx = range.start; ptidx < range.end; ptidx++ )
+        {
+            int x0 = cvRound(pts[ptidx].pt.x);
+            int y0 = cvRound(pts[ptidx].pt.y);
+            int z = pts[ptidx].octave;
 
-        const uchar* ptr0 = ptr00 + (y0 - r + layerinfo[z].y)*size_t_step + (x0 - r + layerinfo[z].x);
-        int a = 0, b = 0, c = 0;
+            const uchar* ptr0 = ptr00 + (y0 - r + layerinfo[z].y)*size_t_step + (x0 - r + layerinfo[z].x);
+            int a = 0, b = 0, c = 0;
 
-        for( int k = 0; k < blockSize*blockSize; k++ )
-        {
-            const uchar* ptr = ptr0 + ofs[k];
-            int Ix = (ptr[1] - ptr[-1])*2 + (ptr[-step+1] - ptr[-step-1]) + (ptr[step+1] - ptr[step-1]);
-            int Iy = (ptr[step] - ptr[-step])*2 + (ptr[step-1] - ptr[-step-1]) + (ptr[step+1] - ptr[-step+1]);
-            a += Ix*Ix;
-            b += Iy*Iy;
-            c += Ix*Iy;
+            for( int k = 0; k < blockSize*blockSize; k++ )
+            {
+                const uchar* ptr = ptr0 + ofs[k];
+                int Ix = (ptr[1] - ptr[-1])*2 + (ptr[-step+1] - ptr[-step-1]) + (ptr[step+1] - ptr[step-1]);
+                int Iy = (ptr[step] - ptr[-step])*2 + (ptr[step-1] - ptr[-step-1]) + (ptr[step+1] - ptr[-step+1]);
+                a += Ix*Ix;
+                b += Iy*Iy;
+                c += Ix*Iy;
+            }
+            pts[ptidx].response = ((float)a * b - (float)c * c -
+                                   harris_k * ((float)a + b) * ((float)a + b))*scale_sq_sq;
         }
-        pts[ptidx].response = ((float)a * b - (float)c * c -
-                               harris_k * ((float)a + b) * ((float)a + b))*scale_sq_sq;
-    }
+    }, ptsize/256.);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,36 +185,39 @@ static void ICAngles(const Mat& img, const std::vector<Rect>& layerinfo,
                      std::vector<KeyPoint>& pts, const std::vector<int> & u_max, int half_k)
 {
     int step = (int)img.step1();
-    size_t ptidx, ptsize = pts.size();
+    size_t ptsize = pts.size();
 
-    for( ptidx = 0; ptidx < ptsize; ptidx++ )
+    parallel_for_(Range(0, (int)ptsize), [&](const Range& range)
     {
-        const Rect& layer = layerinfo[pts[ptidx].octave];
-        const uchar* center = &img.at<uchar>(cvRound(pts[ptidx].pt.y) + layer.y, cvRound(pts[ptidx].pt.x) + layer.x);
+        for( int ptidx = range.start; ptidx < range.end; ptidx++ )
+        {
+            const Rect& layer = layerinfo[pts[ptidx].octave];
+            const uchar* center = &img.at<uchar>(cvRound(pts[ptidx].pt.y) + layer.y, cvRound(pts[ptidx].pt.x) + layer.x);
 
-        int m_01 = 0, m_10 = 0;
+            int m_01 = 0, m_10 = 0;
 
-        // Treat the center line differently, v=0
-        for (int u = -half_k; u <= half_k; ++u)
-            m_10 += u * center[u];
+            // Treat the center line differently, v=0
+            for (int u = -half_k; u <= half_k; ++u)
+                m_10 += u * center[u];
 
-        // Go line by line in the circular patch
-        for (int v = 1; v <= half_k; ++v)
-        {
-            // Proceed over the two lines
-            int v_sum = 0;
-            int d = u_max[v];
-            for (int u = -d; u <= d; ++u)
+            // Go line by line in the circular patch
+            for (int v = 1; v <= half_k; ++v)
             {
-                int val_plus = center[u + v*step], val_minus = center[u - v*step];
-                v_sum += (val_plus - val_minus);
-                m_10 += u * (val_plus + val_minus);
+                // Proceed over the two lines
+                int v_sum = 0;
+                int d = u_max[v];
+                for (int u = -d; u <= d; ++u)
+                {
+                    int val_plus = center[u + v*step], val_minus = center[u - v*step];
+                    v_sum += (val_plus - val_minus);
+                    m_10 += u * (val_plus + val_minus);
+                }
+                m_01 += v * v_sum;
             }
-            m_01 += v * v_sum;
-        }
 
-        pts[ptidx].angle = fastAtan2((float)m_01, (float)m_10);
-    }
+            pts[ptidx].angle = fastAtan2((float)m_01, (float)m_10);
+        }
+    }, ptsize/256.);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,131 +228,134 @@ computeOrbDescriptors( const Mat& imagePyramid, const std::vector<Rect>& layerIn
                        Mat& descriptors, const std::vector<Point>& _pattern, int dsize, int wta_k )
 {
     int step = (int)imagePyramid.step;
-    int j, i, nkeypoints = (int)keypoints.size();
+    int nkeypoints = (int)keypoints.size();
 
-    for( j = 0; j < nkeypoints; j++ )
+    parallel_for_(Range(0, nkeypoints), [&](const Range& range)
     {
-        const KeyPoint& kpt = keypoints[j];
-        const Rect& layer = layerInfo[kpt.octave];
-        float scale = 1.f/layerScale[kpt.octave];
-        float angle = kpt.angle;
-
-        angle *= (float)(CV_PI/180.f);
-        float a = (float)cos(angle), b = (float)sin(angle);
-
-        const uchar* center = &imagePyramid.at<uchar>(cvRound(kpt.pt.y*scale) + layer.y,
-                                                      cvRound(kpt.pt.x*scale) + layer.x);
-        float x, y;
-        int ix, iy;
-        const Point* pattern = &_pattern[0];
-        uchar* desc = descriptors.ptr<uchar>(j);
-
-    #if 1
-        #define GET_VALUE(idx) \
-               (x = pattern[idx].x*a - pattern[idx].y*b, \
+        for( int j = range.start; j < range.end; j++ )
+        {
+            const KeyPoint& kpt = keypoints[j];
+            const Rect& layer = layerInfo[kpt.octave];
+            float scale = 1.f/layerScale[kpt.octave];
+            float angle = kpt.angle;
+
+            angle *= (float)(CV_PI/180.f);
+            float a = (float)cos(angle), b = (float)sin(angle);
+
+            const uchar* center = &imagePyramid.at<uchar>(cvRound(kpt.pt.y*scale) + layer.y,
+                                                          cvRound(kpt.pt.x*scale) + layer.x);
+            float x, y;
+            int i, ix, iy;
+            const Point* pattern = &_pattern[0];
+            uchar* desc = descriptors.ptr<uchar>(j);
+
+        #if 1
+            #define GET_VALUE(idx) \
+                   (x = pattern[idx].x*a - pattern[idx].y*b, \
+                    y = pattern[idx].x*b + pattern[idx].y*a, \
+                    ix = cvRound(x), \
+                    iy = cvRound(y), \
+                    *(center + iy*step + ix) )
+        #else
+            #define GET_VALUE(idx) \
+                (x = pattern[idx].x*a - pattern[idx].y*b, \
                 y = pattern[idx].x*b + pattern[idx].y*a, \
-                ix = cvRound(x), \
-                iy = cvRound(y), \
-                *(center + iy*step + ix) )
-    #else
-        #define GET_VALUE(idx) \
-            (x = pattern[idx].x*a - pattern[idx].y*b, \
-            y = pattern[idx].x*b + pattern[idx].y*a, \
-            ix = cvFloor(x), iy = cvFloor(y), \
-            x -= ix, y -= iy, \
-            cvRound(center[iy*step + ix]*(1-x)*(1-y) + center[(iy+1)*step + ix]*(1-x)*y + \
-                    center[iy*step + ix+1]*x*(1-y) + center[(iy+1)*step + ix+1]*x*y))
-    #endif
+                ix = cvFloor(x), iy = cvFloor(y), \
+                x -= ix, y -= iy, \
+                cvRound(center[iy*step + ix]*(1-x)*(1-y) + center[(iy+1)*step + ix]*(1-x)*y + \
+                        center[iy*step + ix+1]*x*(1-y) + center[(iy+1)*step + ix+1]*x*y))
+        #endif
 
-        if( wta_k == 2 )
-        {
-            for (i = 0; i < dsize; ++i, pattern += 16)
+            if( wta_k == 2 )
             {
-                int t0, t1, val;
-                t0 = GET_VALUE(0); t1 = GET_VALUE(1);
-                val = t0 < t1;
-                t0 = GET_VALUE(2); t1 = GET_VALUE(3);
-                val |= (t0 < t1) << 1;
-                t0 = GET_VALUE(4); t1 = GET_VALUE(5);
-                val |= (t0 < t1) << 2;
-                t0 = GET_VALUE(6); t1 = GET_VALUE(7);
-                val |= (t0 < t1) << 3;
-                t0 = GET_VALUE(8); t1 = GET_VALUE(9);
-                val |= (t0 < t1) << 4;
-                t0 = GET_VALUE(10); t1 = GET_VALUE(11);
-                val |= (t0 < t1) << 5;
-                t0 = GET_VALUE(12); t1 = GET_VALUE(13);
-                val |= (t0 < t1) << 6;
-                t0 = GET_VALUE(14); t1 = GET_VALUE(15);
-                val |= (t0 < t1) << 7;
-
-                desc[i] = (uchar)val;
+                for (i = 0; i < dsize; ++i, pattern += 16)
+                {
+                    int t0, t1, val;
+                    t0 = GET_VALUE(0); t1 = GET_VALUE(1);
+                    val = t0 < t1;
+                    t0 = GET_VALUE(2); t1 = GET_VALUE(3);
+                    val |= (t0 < t1) << 1;
+                    t0 = GET_VALUE(4); t1 = GET_VALUE(5);
+                    val |= (t0 < t1) << 2;
+                    t0 = GET_VALUE(6); t1 = GET_VALUE(7);
+                    val |= (t0 < t1) << 3;
+                    t0 = GET_VALUE(8); t1 = GET_VALUE(9);
+                    val |= (t0 < t1) << 4;
+                    t0 = GET_VALUE(10); t1 = GET_VALUE(11);
+                    val |= (t0 < t1) << 5;
+                    t0 = GET_VALUE(12); t1 = GET_VALUE(13);
+                    val |= (t0 < t1) << 6;
+                    t0 = GET_VALUE(14); t1 = GET_VALUE(15);
+                    val |= (t0 < t1) << 7;
+
+                    desc[i] = (uchar)val;
+                }
             }
-        }
-        else if( wta_k == 3 )
-        {
-            for (i = 0; i < dsize; ++i, pattern += 12)
+            else if( wta_k == 3 )
             {
-                int t0, t1, t2, val;
-                t0 = GET_VALUE(0); t1 = GET_VALUE(1); t2 = GET_VALUE(2);
-                val = t2 > t1 ? (t2 > t0 ? 2 : 0) : (t1 > t0);
+                for (i = 0; i < dsize; ++i, pattern += 12)
+                {
+                    int t0, t1, t2, val;
+                    t0 = GET_VALUE(0); t1 = GET_VALUE(1); t2 = GET_VALUE(2);
+                    val = t2 > t1 ? (t2 > t0 ? 2 : 0) : (t1 > t0);
 
-                t0 = GET_VALUE(3); t1 = GET_VALUE(4); t2 = GET_VALUE(5);
-                val |= (t2 > t1 ? (t2 > t0 ? 2 : 0) : (t1 > t0)) << 2;
+                    t0 = GET_VALUE(3); t1 = GET_VALUE(4); t2 = GET_VALUE(5);
+                    val |= (t2 > t1 ? (t2 > t0 ? 2 : 0) : (t1 > t0)) << 2;
 
-                t0 = GET_VALUE(6); t1 = GET_VALUE(7); t2 = GET_VALUE(8);
-                val |= (t2 > t1 ? (t2 > t0 ? 2 : 0) : (t1 > t0)) << 4;
+                    t0 = GET_VALUE(6); t1 = GET_VALUE(7); t2 = GET_VALUE(8);
+                    val |= (t2 > t1 ? (t2 > t0 ? 2 : 0) : (t1 > t0)) << 4;
 
-                t0 = GET_VALUE(9); t1 = GET_VALUE(10); t2 = GET_VALUE(11);
-                val |= (t2 > t1 ? (t2 > t0 ? 2 : 0) : (t1 > t0)) << 6;
+                    t0 = GET_VALUE(9); t1 = GET_VALUE(10); t2 = GET_VALUE(11);
+                    val |= (t2 > t1 ? (t2 > t0 ? 2 : 0) : (t1 > t0)) << 6;
 
-                desc[i] = (uchar)val;
+                    desc[i] = (uchar)val;
+                }
             }
-        }
-        else if( wta_k == 4 )
-        {
-            for (i = 0; i < dsize; ++i, pattern += 16)
+            else if( wta_k == 4 )
             {
-                int t0, t1, t2, t3, u, v, k, val;
-                t0 = GET_VALUE(0); t1 = GET_VALUE(1);
-                t2 = GET_VALUE(2); t3 = GET_VALUE(3);
-                u = 0, v = 2;
-                if( t1 > t0 ) t0 = t1, u = 1;
-                if( t3 > t2 ) t2 = t3, v = 3;
-                k = t0 > t2 ? u : v;
-                val = k;
-
-                t0 = GET_VALUE(4); t1 = GET_VALUE(5);
-                t2 = GET_VALUE(6); t3 = GET_VALUE(7);
-                u = 0, v = 2;
-                if( t1 > t0 ) t0 = t1, u = 1;
-                if( t3 > t2 ) t2 = t3, v = 3;
-                k = t0 > t2 ? u : v;
-                val |= k << 2;
-
-                t0 = GET_VALUE(8); t1 = GET_VALUE(9);
-                t2 = GET_VALUE(10); t3 = GET_VALUE(11);
-                u = 0, v = 2;
-                if( t1 > t0 ) t0 = t1, u = 1;
-                if( t3 > t2 ) t2 = t3, v = 3;
-                k = t0 > t2 ? u : v;
-                val |= k << 4;
-
-                t0 = GET_VALUE(12); t1 = GET_VALUE(13);
-                t2 = GET_VALUE(14); t3 = GET_VALUE(15);
-                u = 0, v = 2;
-                if( t1 > t0 ) t0 = t1, u = 1;
-                if( t3 > t2 ) t2 = t3, v = 3;
-                k = t0 > t2 ? u : v;
-                val |= k << 6;
-
-                desc[i] = (uchar)val;
+                for (i = 0; i < dsize; ++i, pattern += 16)
+                {
+                    int t0, t1, t2, t3, u, v, k, val;
+                    t0 = GET_VALUE(0); t1 = GET_VALUE(1);
+                    t2 = GET_VALUE(2); t3 = GET_VALUE(3);
+                    u = 0, v = 2;
+                    if( t1 > t0 ) t0 = t1, u = 1;
+                    if( t3 > t2 ) t2 = t3, v = 3;
+                    k = t0 > t2 ? u : v;
+                    val = k;
+
+                    t0 = GET_VALUE(4); t1 = GET_VALUE(5);
+                    t2 = GET_VALUE(6); t3 = GET_VALUE(7);
+                    u = 0, v = 2;
+                    if( t1 > t0 ) t0 = t1, u = 1;
+                    if( t3 > t2 ) t2 = t3, v = 3;
+                    k = t0 > t2 ? u : v;
+                    val |= k << 2;
+
+                    t0 = GET_VALUE(8); t1 = GET_VALUE(9);
+                    t2 = GET_VALUE(10); t3 = GET_VALUE(11);
+                    u = 0, v = 2;
+                    if( t1 > t0 ) t0 = t1, u = 1;
+                    if( t3 > t2 ) t2 = t3, v = 3;
+                    k = t0 > t2 ? u : v;
+                    val |= k << 4;
+
+                    t0 = GET_VALUE(12); t1 = GET_VALUE(13);
+                    t2 = GET_VALUE(14); t3 = GET_VALUE(15);
+                    u = 0, v = 2;
+                    if( t1 > t0 ) t0 = t1, u = 1;
+                    if( t3 > t2 ) t2 = t3, v = 3;
+                    k = t0 > t2 ? u : v;
+                    val |= k << 6;
+
+                    desc[i] = (uchar)val;
+                }
             }
+            else
+                CV_Error( Error::StsBadSize, "Wrong wta_k. It can be only 2, 3 or 4." );
+            #undef GET_VALUE
         }
-        else
-            CV_Error( Error::StsBadSize, "Wrong wta_k. It can be only 2, 3 or 4." );
-        #undef GET_VALUE
-    }
+    }, nkeypoints/256.);
 }
 
 
@@ -880,20 +889,57 @@ static void computeKeyPoints(const Mat& imagePyramid,
     std::vector<int> counters(nlevels);
     keypoints.reserve(nfeaturesPerLevel[0]*2);
 
+    // FAST (with non-maximum suppression) depends on a small neighbourhood only, so the levels are split
+    // into horizontal stripes detected in parallel. A stripe is extended by FAST radius + 1 row for the
+    // suppression, the keypoints of the extension are dropped. The stripes are merged in the row order,
+    // so the keypoints are exactly the same as from the detection on the whole level.
+    const int FAST_STRIPE_ROWS = 128, FAST_STRIPE_BORDER = 4;
+    std::vector<Vec3i> stripes;  // level, first row, last row + 1
     for( level = 0; level < nlevels; level++ )
     {
-        int featuresNum = nfeaturesPerLevel[level];
-        Mat img = imagePyramid(layerInfo[level]);
-        Mat mask = maskPyramid.empty() ? Mat() : maskPyramid(layerInfo[level]);
+        for( int y = 0; y < layerInfo[level].height; y += FAST_STRIPE_ROWS )
+            stripes.push_back(Vec3i(level, y, std::min(y + FAST_STRIPE_ROWS, layerInfo[level].height)));
+    }
+    std::vector<std::vector<KeyPoint> > stripeKeypoints(stripes.size());
 
+    parallel_for_(Range(0, (int)stripes.size()), [&](const Range& range)
+    {
         // Detect FAST features, 20 is a good threshold
-        {
         Ptr<FastFeatureDetector> fd = FastFeatureDetector::create(fastThreshold, true);
-        fd->detect(img, keypoints, mask);
+        for( int s = range.start; s < range.end; s++ )
+        {
+            const Rect& linfo = layerInfo[stripes[s][0]];
+            int y0 = std::max(stripes[s][1] - FAST_STRIPE_BORDER, 0);
+            int y1 = std::min(stripes[s][2] + FAST_STRIPE_BORDER, linfo.height);
+            Rect roi(linfo.x, linfo.y + y0, linfo.width, y1 - y0);
+            std::vector<KeyPoint>& kpts = stripeKeypoints[s];
+            fd->detect(imagePyramid(roi), kpts, maskPyramid.empty() ? Mat() : maskPyramid(roi));
+
+            size_t n = 0;
+            for( size_t k = 0; k < kpts.size(); k++ )
+            {
+                float y = kpts[k].pt.y + y0;
+                if( stripes[s][1] <= y && y < stripes[s][2] )
+                {
+                    kpts[n] = kpts[k];
+                    kpts[n++].pt.y = y;
+                }
+            }
+            kpts.resize(n);
         }
+    });
+
+    size_t stripeIdx = 0;
+    for( level = 0; level < nlevels; level++ )
+    {
+        int featuresNum = nfeaturesPerLevel[level];
+
+        keypoints.clear();
+        for( ; stripeIdx < stripes.size() && stripes[stripeIdx][0] == level; stripeIdx++ )
+            std::copy(stripeKeypoints[stripeIdx].begin(), stripeKeypoints[stripeIdx].end(), std::back_inserter(keypoints));
 
         // Remove keypoints very close to the border
-        KeyPointsFilter::runByImageBorder(keypoints, img.size(), edgeThreshold);
+        KeyPointsFilter::runByImageBorder(keypoints, layerInfo[level].size(), edgeThreshold);
 
         // Keep more points than necessary as FAST does not give amazing corners
         KeyPointsFilter::retainBest(keypoints, scoreType == ORB_Impl::HARRIS_SCORE ? 2 * featuresNum : featuresNum);
@@ -141,6 +141,90 @@ TEST(Features2D_ORB, regression_16197)
     ASSERT_NO_THROW(orbPtr->detectAndCompute(img, noArray(), kps, fv));
 }
 
+TEST(Features2D_ORB, parallel_determinism)
+{
+    // larger than a single detection stripe on the first pyramid levels
+    Mat img(720, 1280, CV_8UC1);
+    RNG rng(20211);
+    rng.fill(img, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+    cv::GaussianBlur(img, img, Size(5, 5), 0);
+
+    Mat mask(img.size(), CV_8UC1, Scalar(0));
+    Point poly[] = {Point(100, 20), Point(1200, 50), Point(1000, 700), Point(10, 500)};
+    fillConvexPoly(mask, poly, int(sizeof(poly) / sizeof(poly[0])), Scalar(255));
+
+    for (int scoreType = ORB::HARRIS_SCORE; scoreType <= ORB::FAST_SCORE; scoreType++)
+    {
+        SCOPED_TRACE(scoreType);
+        Ptr<ORB> orb = ORB::create(5000, 1.2f, 8, 31, 0, 2, (ORB::ScoreType)scoreType);
+
+        const int nthreads = getNumThreads();
+        std::vector<KeyPoint> kpRef, kp;
+        Mat descRef, desc;
+        setNumThreads(1);
+        orb->detectAndCompute(img, mask, kpRef, descRef);
+        setNumThreads(std::max(nthreads, 4));  // several stripes and keypoint ranges run concurrently
+        orb->detectAndCompute(img, mask, kp, desc);
+        setNumThreads(nthreads);
+
+        ASSERT_GT(kpRef.size(), 1000u);
+        ASSERT_EQ(kpRef.size(), kp.size());
+        for (size_t i = 0; i < kp.size(); i++)
+        {
+            ASSERT_EQ(kpRef[i].pt, kp[i].pt) << "i=" << i;
+            ASSERT_EQ(kpRef[i].response, kp[i].response) << "i=" << i;
+            ASSERT_EQ(kpRef[i].angle, kp[i].angle) << "i=" << i;
+            ASSERT_EQ(kpRef[i].octave, kp[i].octave) << "i=" << i;
+        }
+        EXPECT_EQ(0, cvtest::norm(descRef, desc, NORM_L1));
+    }
+}
+
+TEST(Features2D_ORB, striped_FAST)
+{
+    // ORB detects FAST corners on 128-row stripes of the pyramid levels extended by 4 rows,
+    // it must give the same keypoints as FAST on the whole level
+    const int stripeRows = 128, stripeBorder = 4, border = 32;
+    Mat img(720, 1280, CV_8UC1);
+    RNG rng(20211);
+    rng.fill(img, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+    cv::GaussianBlur(img, img, Size(5, 5), 0);
+
+    // a level is a ROI of the pyramid buffer, as in ORB
+    Mat buf, maskBuf(img.rows + 2 * border, img.cols + 2 * border, CV_8UC1, Scalar(0));
+    cv::copyMakeBorder(img, buf, border, border, border, border, BORDER_REFLECT_101);
+    const Rect levelRect(border, border, img.cols, img.rows);
+    Mat level = buf(levelRect), mask = maskBuf(levelRect);
+    Point poly[] = {Point(100, 20), Point(1200, 50), Point(1000, 700), Point(10, 500)};
+    fillConvexPoly(mask, poly, int(sizeof(poly) / sizeof(poly[0])), Scalar(255));
+
+    Ptr<FastFeatureDetector> fd = FastFeatureDetector::create(20, true);
+    std::vector<KeyPoint> ref, kp;
+    fd->detect(level, ref, mask);
+
+    for (int y = 0; y < level.rows; y += stripeRows)
+    {
+        const int y1 = std::min(y + stripeRows, level.rows);
+        const Range rows(std::max(y - stripeBorder, 0), std::min(y1 + stripeBorder, level.rows));
+        std::vector<KeyPoint> stripeKp;
+        fd->detect(level.rowRange(rows), stripeKp, mask.rowRange(rows));
+        for (size_t i = 0; i < stripeKp.size(); i++)
+        {
+            stripeKp[i].pt.y += rows.start;
+            if (y <= stripeKp[i].pt.y && stripeKp[i].pt.y < y1)
+                kp.push_back(stripeKp[i]);
+        }
+    }
+
+    ASSERT_GT(ref.size(), 1000u);
+    ASSERT_EQ(ref.size(), kp.size());
+    for (size_t i = 0; i < kp.size(); i++)
+    {
+        ASSERT_EQ(ref[i].pt, kp[i].pt) << "i=" << i;
+        ASSERT_EQ(ref[i].response, kp[i].response) << "i=" << i;
+    }
+}
+
 // https://github.com/opencv/opencv-python/issues/537
 BIGDATA_TEST(Features2D_ORB, regression_opencv_python_537)  // memory usage: ~3 Gb
 {
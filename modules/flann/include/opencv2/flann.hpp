@@ -311,6 +311,11 @@ public:
         @param params SearchParams
 
         This function returns the number of nearest neighbors found.
+
+        The overload taking Mat accepts several query points, one per row, and searches them in parallel.
+        The neighbors of a query are stored in the corresponding rows of indices and dists, the unused
+        elements of the rows are set to -1 and to the maximum distance value. In this case the function
+        returns the maximum number of neighbors found for a query.
         */
         int radiusSearch(const std::vector<ElementType>& query, std::vector<int>& indices,
                          std::vector<DistanceType>& dists, DistanceType radius, const ::cvflann::SearchParams& params);
@@ -96,9 +96,6 @@ public:
         for (size_t i = 0; i < size_; ++i) {
             vind_[i] = int(i);
         }
-
-        mean_ = new DistanceType[veclen_];
-        var_ = new DistanceType[veclen_];
     }
 
 
@@ -113,8 +110,6 @@ public:
         if (tree_roots_!=NULL) {
             delete[] tree_roots_;
         }
-        delete[] mean_;
-        delete[] var_;
     }
 
     /**
@@ -122,17 +117,29 @@ public:
      */
     void buildIndex() CV_OVERRIDE
     {
-        /* Construct the randomized trees. */
+        tree_pools_.resize(trees_);
         for (int i = 0; i < trees_; i++) {
-            /* Randomize the order of vectors to allow for unbiased sampling. */
+            tree_pools_[i] = cv::makePtr<PooledAllocator>();
+        }
+
 #ifndef OPENCV_FLANN_USE_STD_RAND
-            cv::randShuffle(vind_);
+        /* Construct the randomized trees in parallel. Every tree gets its own random
+           generator, so the result does not depend on the number of threads. */
+        std::vector<uint64> seeds(trees_);
+        for (int i = 0; i < trees_; i++) {
+            seeds[i] = cv::theRNG().next();
+        }
+        cv::parallel_for_(cv::Range(0, trees_), BuildTreeInvoker(this, seeds));
 #else
+        /* Construct the randomized trees. */
+        for (int i = 0; i < trees_; i++) {
+            /* Randomize the order of vectors to allow for unbiased sampling. */
             std::random_shuffle(vind_.begin(), vind_.end());
-#endif
 
-            tree_roots_[i] = divideTree(&vind_[0], int(size_) );
+            std::vector<DistanceType> mean(veclen_), var(veclen_);
+            tree_roots_[i] = divideTree(&vind_[0], int(size_), *tree_pools_[i], &mean[0], &var[0]);
         }
+#endif
     }
 
 
@@ -189,7 +196,11 @@ public:
      */
     int usedMemory() const CV_OVERRIDE
     {
-        return int(pool_.usedMemory+pool_.wastedMemory+dataset_.rows*sizeof(int));  // pool memory and vind array memory
+        int memory = int(pool_.usedMemory+pool_.wastedMemory+dataset_.rows*sizeof(int));  // pool memory and vind array memory
+        for (size_t i = 0; i < tree_pools_.size(); ++i) {
+            memory += tree_pools_[i]->usedMemory+tree_pools_[i]->wastedMemory;
+        }
+        return memory;
     }
 
     /**
@@ -244,6 +255,36 @@ private:
     typedef BranchSt* Branch;
 
 
+#ifndef OPENCV_FLANN_USE_STD_RAND
+    class BuildTreeInvoker : public cv::ParallelLoopBody
+    {
+    public:
+        BuildTreeInvoker(KDTreeIndex* index, const std::vector<uint64>& seeds)
+            : index_(index), seeds_(seeds)
+        {
+        }
+
+        void operator()(const cv::Range& range) const CV_OVERRIDE
+        {
+            std::vector<DistanceType> mean(index_->veclen_), var(index_->veclen_);
+            std::vector<int> ind;
+            for (int i = range.start; i < range.end; ++i) {
+                cv::RNG rng(seeds_[i]);
+                /* Randomize the order of vectors to allow for unbiased sampling. */
+                ind = index_->vind_;
+                cv::randShuffle(ind, 1., &rng);
+                index_->tree_roots_[i] = index_->divideTree(&ind[0], int(index_->size_), *index_->tree_pools_[i],
+                                                            &mean[0], &var[0]);
+            }
+        }
+
+    private:
+        KDTreeIndex* index_;
+        const std::vector<uint64>& seeds_;
+    };
+#endif
+
+
 
     void save_tree(FILE* stream, NodePtr tree)
     {
@@ -279,9 +320,9 @@ private:
      *                  first = index of the first vector
      *                  last = index of the last vector
      */
-    NodePtr divideTree(int* ind, int count)
+    NodePtr divideTree(int* ind, int count, PooledAllocator& pool, DistanceType* mean, DistanceType* var)
     {
-        NodePtr node = pool_.allocate<Node>(); // allocate memory
+        NodePtr node = pool.allocate<Node>(); // allocate memory
 
         /* If too few exemplars remain, then make this a leaf node. */
         if ( count == 1) {
@@ -292,12 +333,12 @@ private:
             int idx;
             int cutfeat;
             DistanceType cutval;
-            meanSplit(ind, count, idx, cutfeat, cutval);
+            meanSplit(ind, count, idx, cutfeat, cutval, mean, var);
 
             node->divfeat = cutfeat;
             node->divval = cutval;
-            node->child1 = divideTree(ind, idx);
-            node->child2 = divideTree(ind+idx, count-idx);
+            node->child1 = divideTree(ind, idx, pool, mean, var);
+            node->child2 = divideTree(ind+idx, count-idx, pool, mean, var);
         }
 
         return node;
@@ -309,10 +350,10 @@ private:
      * Make a random choice among those with the highest variance, and use
      * its variance as the threshold value.
      */
-    void meanSplit(int* ind, int count, int& index, int& cutfeat, DistanceType& cutval)
+    void meanSplit(int* ind, int count, int& index, int& cutfeat, DistanceType& cutval, DistanceType* mean, DistanceType* var)
     {
-        memset(mean_,0,veclen_*sizeof(DistanceType));
-        memset(var_,0,veclen_*sizeof(DistanceType));
+        memset(mean,0,veclen_*sizeof(DistanceType));
+        memset(var,0,veclen_*sizeof(DistanceType));
 
         /* Compute mean values.  Only the first SAMPLE_MEAN values need to be
             sampled to get a good estimate.
@@ -321,24 +362,24 @@ private:
         for (int j = 0; j < cnt; ++j) {
             ElementType* v = dataset_[ind[j]];
             for (size_t k=0; k<veclen_; ++k) {
-                mean_[k] += v[k];
+                mean[k] += v[k];
             }
         }
         for (size_t k=0; k<veclen_; ++k) {
-            mean_[k] /= cnt;
+            mean[k] /= cnt;
         }
 
         /* Compute variances (no need to divide by count). */
         for (int j = 0; j < cnt; ++j) {
             ElementType* v = dataset_[ind[j]];
             for (size_t k=0; k<veclen_; ++k) {
-                DistanceType dist = v[k] - mean_[k];
-                var_[k] += dist * dist;
+                DistanceType dist = v[k] - mean[k];
+                var[k] += dist * dist;
             }
         }
         /* Select one of the highest variance indices at random. */
-        cutfeat = selectDivision(var_);
-        cutval = mean_[cutfeat];
+        cutfeat = selectDivision(var);
+        cutval = mean[cutfeat];
 
         int lim1, lim2;
         planeSplit(ind, count, cutfeat, cutval, lim1, lim2);
@@ -606,10 +647,6 @@ private:
     size_t veclen_;
 
 
-    DistanceType* mean_;
-    DistanceType* var_;
-
-
     /**
      * Array of k-d trees used to find neighbours.
      */
@@ -624,6 +661,12 @@ private:
      */
     PooledAllocator pool_;
 
+    /**
+     * Pooled memory allocators of the trees constructed by buildIndex(),
+     * one per tree, so that the trees can be constructed in parallel.
+     */
+    std::vector<cv::Ptr<PooledAllocator> > tree_pools_;
+
     Distance distance_;
 
 
@@ -218,11 +218,10 @@ public:
         CV_Assert(int(indices.cols) >= knn);
         CV_Assert(int(dists.cols) >= knn);
 
-        KNNSimpleResultSet<DistanceType> resultSet(knn);
-        for (size_t i = 0; i < queries.rows; i++) {
-            resultSet.init(indices[i], dists[i]);
-            findNeighbors(resultSet, queries[i], params);
-        }
+        // the queries are processed in parallel, each stripe uses its own result set
+        cv::parallel_for_(cv::Range(0, (int)queries.rows),
+                          KNNSearchInvoker(this, queries, indices, dists, knn, params),
+                          cv::getNumThreads() * 4.);
     }
 
     IndexParams getParameters() const CV_OVERRIDE
@@ -285,6 +284,32 @@ private:
     typedef BranchSt* Branch;
 
 
+    class KNNSearchInvoker : public cv::ParallelLoopBody
+    {
+    public:
+        KNNSearchInvoker(KDTreeSingleIndex* index, const Matrix<ElementType>& queries, Matrix<int>& indices,
+                         Matrix<DistanceType>& dists, int knn, const SearchParams& params)
+            : index_(index), queries_(queries), indices_(indices), dists_(dists), knn_(knn), params_(params)
+        {
+        }
+
+        void operator()(const cv::Range& range) const CV_OVERRIDE
+        {
+            KNNSimpleResultSet<DistanceType> resultSet(knn_);
+            for (int i = range.start; i < range.end; i++) {
+                resultSet.init(indices_[i], dists_[i]);
+                index_->findNeighbors(resultSet, queries_[i], params_);
+            }
+        }
+
+    private:
+        KDTreeSingleIndex* index_;
+        const Matrix<ElementType>& queries_;
+        Matrix<int>& indices_;
+        Matrix<DistanceType>& dists_;
+        int knn_;
+        const SearchParams& params_;
+    };
 
 
     void save_tree(FILE* stream, NodePtr tree)
@@ -201,15 +201,10 @@ public:
         CV_Assert(int(dists.cols) >= knn);
 
 
-        KNNUniqueResultSet<DistanceType> resultSet(knn);
-        for (size_t i = 0; i < queries.rows; i++) {
-            resultSet.clear();
-            std::fill_n(indices[i], knn, -1);
-            std::fill_n(dists[i], knn, std::numeric_limits<DistanceType>::max());
-            findNeighbors(resultSet, queries[i], params);
-            if (get_param(params,"sorted",true)) resultSet.sortAndCopy(indices[i], dists[i], knn);
-            else resultSet.copy(indices[i], dists[i], knn);
-        }
+        // the queries are processed in parallel, each stripe uses its own result set
+        cv::parallel_for_(cv::Range(0, (int)queries.rows),
+                          KNNSearchInvoker(this, queries, indices, dists, knn, params),
+                          cv::getNumThreads() * 4.);
     }
 
 
@@ -228,6 +223,39 @@ public:
     }
 
 private:
+    class KNNSearchInvoker : public cv::ParallelLoopBody
+    {
+    public:
+        KNNSearchInvoker(LshIndex* index, const Matrix<ElementType>& queries, Matrix<int>& indices,
+                         Matrix<DistanceType>& dists, int knn, const SearchParams& params)
+            : index_(index), queries_(queries), indices_(indices), dists_(dists), knn_(knn), params_(params)
+        {
+            sorted_ = get_param(params_,"sorted",true);
+        }
+
+        void operator()(const cv::Range& range) const CV_OVERRIDE
+        {
+            KNNUniqueResultSet<DistanceType> resultSet(knn_);
+            for (int i = range.start; i < range.end; i++) {
+                resultSet.clear();
+                std::fill_n(indices_[i], knn_, -1);
+                std::fill_n(dists_[i], knn_, std::numeric_limits<DistanceType>::max());
+                index_->findNeighbors(resultSet, queries_[i], params_);
+                if (sorted_) resultSet.sortAndCopy(indices_[i], dists_[i], knn_);
+                else resultSet.copy(indices_[i], dists_[i], knn_);
+            }
+        }
+
+    private:
+        LshIndex* index_;
+        const Matrix<ElementType>& queries_;
+        Matrix<int>& indices_;
+        Matrix<DistanceType>& dists_;
+        int knn_;
+        const SearchParams& params_;
+        bool sorted_;
+    };
+
     /** Defines the comparator on score and index
      */
     typedef std::pair<float, unsigned int> ScoreIndexPair;
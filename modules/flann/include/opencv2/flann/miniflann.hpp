@@ -158,6 +158,13 @@ public:
     CV_WRAP virtual void knnSearch(InputArray query, OutputArray indices,
                    OutputArray dists, int knn, const SearchParams& params=SearchParams());
 
+    /** @brief Finds the neighbors within the given radius of the query points.
+
+    The query points are stored one per row and searched in parallel. Row i of indices and dists
+    receives up to maxResults neighbors of query i, the unused elements are set to -1 and to the
+    maximum distance value. Returns the maximum number of neighbors found for a query (the number
+    of neighbors of the query if there is only one).
+     */
     CV_WRAP virtual int radiusSearch(InputArray query, OutputArray indices,
                              OutputArray dists, double radius, int maxResults,
                              const SearchParams& params=SearchParams());
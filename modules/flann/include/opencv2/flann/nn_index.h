@@ -31,6 +31,10 @@
 #ifndef OPENCV_FLANN_NNINDEX_H
 #define OPENCV_FLANN_NNINDEX_H
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 #include "matrix.h"
 #include "result_set.h"
 #include "params.h"
@@ -74,59 +78,43 @@ public:
         CV_Assert(int(indices.cols) >= knn);
         CV_Assert(int(dists.cols) >= knn);
 
-#if 0
-        KNNResultSet<DistanceType> resultSet(knn);
-        for (size_t i = 0; i < queries.rows; i++) {
-            resultSet.init(indices[i], dists[i]);
-            findNeighbors(resultSet, queries[i], params);
-        }
-#else
-        KNNUniqueResultSet<DistanceType> resultSet(knn);
-        for (size_t i = 0; i < queries.rows; i++) {
-            resultSet.clear();
-            findNeighbors(resultSet, queries[i], params);
-            if (get_param(params,"sorted",true)) resultSet.sortAndCopy(indices[i], dists[i], knn);
-            else resultSet.copy(indices[i], dists[i], knn);
-        }
-#endif
+        // the queries are processed in parallel, each stripe uses its own result set
+        cv::parallel_for_(cv::Range(0, (int)queries.rows),
+                          KNNSearchInvoker(this, queries, indices, dists, knn, params),
+                          cv::getNumThreads() * 4.);
     }
 
     /**
      * \brief Perform radius search
-     * \param[in] query The query point
-     * \param[out] indices The indinces of the neighbors found within the given radius
-     * \param[out] dists The distances to the nearest neighbors found
+     * \param[in] query The query points, one per row
+     * \param[out] indices The indices of the neighbors found within the given radius, one row per query.
+     *             The unused elements of a row are set to -1
+     * \param[out] dists The distances to the nearest neighbors found, one row per query.
+     *             The unused elements of a row are set to the maximum distance value
      * \param[in] radius The radius used for search
      * \param[in] params Search parameters
-     * \returns Number of neighbors found
+     * \returns Number of neighbors found. If there are several queries, the maximum number of
+     *          neighbors found for a query
+     *
+     * \note Several queries are searched in parallel. Before, only a single query was accepted and
+     *       -1 was returned for several ones. The rows of indices and dists are now always filled
+     *       completely, with -1 and the maximum distance value after the neighbors found.
      */
     virtual int radiusSearch(const Matrix<ElementType>& query, Matrix<int>& indices, Matrix<DistanceType>& dists, float radius, const SearchParams& params)
     {
-        if (query.rows != 1) {
-            fprintf(stderr, "I can only search one feature at a time for range search\n");
-            return -1;
-        }
         CV_Assert(query.cols == veclen());
         CV_Assert(indices.cols == dists.cols);
-
-        int n = 0;
-        int* indices_ptr = NULL;
-        DistanceType* dists_ptr = NULL;
         if (indices.cols > 0) {
-            n = (int)indices.cols;
-            indices_ptr = indices[0];
-            dists_ptr = dists[0];
+            CV_Assert(indices.rows >= query.rows);
+            CV_Assert(dists.rows >= query.rows);
         }
 
-        RadiusUniqueResultSet<DistanceType> resultSet((DistanceType)radius);
-        resultSet.clear();
-        findNeighbors(resultSet, query[0], params);
-        if (n>0) {
-            if (get_param(params,"sorted",true)) resultSet.sortAndCopy(indices_ptr, dists_ptr, n);
-            else resultSet.copy(indices_ptr, dists_ptr, n);
-        }
+        std::vector<int> counts(query.rows, 0);
+        cv::parallel_for_(cv::Range(0, (int)query.rows),
+                          RadiusSearchInvoker(this, query, indices, dists, radius, params, counts),
+                          cv::getNumThreads() * 4.);
 
-        return (int)resultSet.size();
+        return counts.empty() ? 0 : *std::max_element(counts.begin(), counts.end());
     }
 
     /**
@@ -171,6 +159,79 @@ public:
      * \brief Method that searches for nearest-neighbours
      */
     virtual void findNeighbors(ResultSet<DistanceType>& result, const ElementType* vec, const SearchParams& searchParams) = 0;
+
+private:
+
+    class KNNSearchInvoker : public cv::ParallelLoopBody
+    {
+    public:
+        KNNSearchInvoker(NNIndex* index, const Matrix<ElementType>& queries, Matrix<int>& indices,
+                         Matrix<DistanceType>& dists, int knn, const SearchParams& params)
+            : index_(index), queries_(queries), indices_(indices), dists_(dists), knn_(knn), params_(params)
+        {
+            sorted_ = get_param(params_,"sorted",true);
+        }
+
+        void operator()(const cv::Range& range) const CV_OVERRIDE
+        {
+            KNNUniqueResultSet<DistanceType> resultSet(knn_);
+            for (int i = range.start; i < range.end; i++) {
+                resultSet.clear();
+                index_->findNeighbors(resultSet, queries_[i], params_);
+                if (sorted_) resultSet.sortAndCopy(indices_[i], dists_[i], knn_);
+                else resultSet.copy(indices_[i], dists_[i], knn_);
+            }
+        }
+
+    private:
+        NNIndex* index_;
+        const Matrix<ElementType>& queries_;
+        Matrix<int>& indices_;
+        Matrix<DistanceType>& dists_;
+        int knn_;
+        const SearchParams& params_;
+        bool sorted_;
+    };
+
+    class RadiusSearchInvoker : public cv::ParallelLoopBody
+    {
+    public:
+        RadiusSearchInvoker(NNIndex* index, const Matrix<ElementType>& queries, Matrix<int>& indices,
+                            Matrix<DistanceType>& dists, float radius, const SearchParams& params,
+                            std::vector<int>& counts)
+            : index_(index), queries_(queries), indices_(indices), dists_(dists), radius_(radius),
+              params_(params), counts_(counts)
+        {
+            sorted_ = get_param(params_,"sorted",true);
+        }
+
+        void operator()(const cv::Range& range) const CV_OVERRIDE
+        {
+            const int n = (int)indices_.cols;
+            RadiusUniqueResultSet<DistanceType> resultSet((DistanceType)radius_);
+            for (int i = range.start; i < range.end; i++) {
+                resultSet.clear();
+                index_->findNeighbors(resultSet, queries_[i], params_);
+                if (n > 0) {
+                    std::fill_n(indices_[i], n, -1);
+                    std::fill_n(dists_[i], n, std::numeric_limits<DistanceType>::max());
+                    if (sorted_) resultSet.sortAndCopy(indices_[i], dists_[i], n);
+                    else resultSet.copy(indices_[i], dists_[i], n);
+                }
+                counts_[i] = (int)resultSet.size();
+            }
+        }
+
+    private:
+        NNIndex* index_;
+        const Matrix<ElementType>& queries_;
+        Matrix<int>& indices_;
+        Matrix<DistanceType>& dists_;
+        float radius_;
+        const SearchParams& params_;
+        std::vector<int>& counts_;
+        bool sorted_;
+    };
 };
 
 }
@@ -0,0 +1,95 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+#include "perf_precomp.hpp"
+
+namespace opencv_test
+{
+using namespace perf;
+
+static const int TRAIN_SIZE = 100000;
+static const int QUERY_SIZE = 10000;
+
+static Mat makeFeatures(int rows, int cols, int type, uint64 seed)
+{
+    Mat features(rows, cols, type);
+    RNG rng(seed);
+    rng.fill(features, RNG::UNIFORM, Scalar::all(0), Scalar::all(type == CV_8U ? 256 : 1));
+    return features;
+}
+
+typedef TestBaseWithParam<int> Flann_KDTree;
+
+PERF_TEST_P(Flann_KDTree, build, testing::Values(1, 4, 8))
+{
+    const int trees = GetParam();
+    Mat train = makeFeatures(TRAIN_SIZE, 64, CV_32F, 1);
+    declare.in(train);
+
+    TEST_CYCLE()
+    {
+        flann::Index index(train, flann::KDTreeIndexParams(trees));
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Flann_KDTree, knnSearch, testing::Values(1, 4, 8))
+{
+    const int trees = GetParam();
+    Mat train = makeFeatures(TRAIN_SIZE, 64, CV_32F, 1);
+    Mat query = makeFeatures(QUERY_SIZE, 64, CV_32F, 2);
+    flann::Index index(train, flann::KDTreeIndexParams(trees));
+    Mat indices, dists;
+    declare.in(query);
+
+    TEST_CYCLE() index.knnSearch(query, indices, dists, 2, flann::SearchParams(64));
+
+    ASSERT_EQ(QUERY_SIZE, indices.rows);
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST(Flann_KDTree, radiusSearch)
+{
+    Mat train = makeFeatures(TRAIN_SIZE, 8, CV_32F, 1);
+    Mat query = makeFeatures(QUERY_SIZE, 8, CV_32F, 2);
+    flann::Index index(train, flann::KDTreeIndexParams(4));
+    Mat indices, dists;
+    declare.in(query);
+
+    TEST_CYCLE() index.radiusSearch(query, indices, dists, 0.05, 16, flann::SearchParams(64));
+
+    ASSERT_EQ(QUERY_SIZE, indices.rows);
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST(Flann_KMeans, knnSearch)
+{
+    Mat train = makeFeatures(TRAIN_SIZE, 64, CV_32F, 1);
+    Mat query = makeFeatures(QUERY_SIZE, 64, CV_32F, 2);
+    flann::Index index(train, flann::KMeansIndexParams(32, 5));
+    Mat indices, dists;
+    declare.in(query);
+
+    TEST_CYCLE() index.knnSearch(query, indices, dists, 2, flann::SearchParams(64));
+
+    ASSERT_EQ(QUERY_SIZE, indices.rows);
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST(Flann_Lsh, knnSearch)
+{
+    // ORB-like binary descriptors
+    Mat train = makeFeatures(TRAIN_SIZE, 32, CV_8U, 1);
+    Mat query = makeFeatures(QUERY_SIZE, 32, CV_8U, 2);
+    flann::Index index(train, flann::LshIndexParams(6, 12, 1), cvflann::FLANN_DIST_HAMMING);
+    Mat indices, dists;
+    declare.in(query);
+
+    TEST_CYCLE() index.knnSearch(query, indices, dists, 2);
+
+    ASSERT_EQ(QUERY_SIZE, indices.rows);
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+#include "test_precomp.hpp"
+
+namespace opencv_test { namespace {
+
+class Flann_Search : public testing::Test
+{
+protected:
+    void SetUp() CV_OVERRIDE
+    {
+        nthreads = getNumThreads();
+        RNG& rng = TS::ptr()->get_rng();
+        train.create(5000, 16, CV_32F);
+        rng.fill(train, RNG::UNIFORM, Scalar::all(0), Scalar::all(1));
+        query.create(500, 16, CV_32F);
+        rng.fill(query, RNG::UNIFORM, Scalar::all(0), Scalar::all(1));
+    }
+
+    void TearDown() CV_OVERRIDE
+    {
+        setNumThreads(nthreads);
+    }
+
+    // builds the index and searches the queries using the given number of threads
+    void knnSearch(int threads, const flann::IndexParams& params, Mat& indices, Mat& dists)
+    {
+        setNumThreads(threads);
+        theRNG() = RNG(12345);
+        flann::Index index(train, params);
+        index.knnSearch(query, indices, dists, 5, flann::SearchParams(32));
+    }
+
+    int nthreads;
+    Mat train, query;
+};
+
+TEST_F(Flann_Search, KDTree_parallel_determinism)
+{
+    Mat indices1, dists1, indices, dists;
+    knnSearch(1, flann::KDTreeIndexParams(4), indices1, dists1);
+    knnSearch(std::max(nthreads, 4), flann::KDTreeIndexParams(4), indices, dists);
+
+    EXPECT_EQ(0, cvtest::norm(indices1, indices, NORM_INF));
+    EXPECT_EQ(0, cvtest::norm(dists1, dists, NORM_INF));
+}
+
+TEST_F(Flann_Search, KDTreeSingle_parallel_knnSearch)
+{
+    Mat indices1(query.rows, 5, CV_32S), dists1(query.rows, 5, CV_32F);
+    Mat indices(query.rows, 5, CV_32S), dists(query.rows, 5, CV_32F);
+    flann::GenericIndex<cvflann::L2<float> > index(train, cvflann::KDTreeSingleIndexParams());
+    setNumThreads(1);
+    index.knnSearch(query, indices1, dists1, 5, cvflann::SearchParams());
+    setNumThreads(std::max(nthreads, 4));
+    index.knnSearch(query, indices, dists, 5, cvflann::SearchParams());
+
+    EXPECT_EQ(0, cvtest::norm(indices1, indices, NORM_INF));
+    EXPECT_EQ(0, cvtest::norm(dists1, dists, NORM_INF));
+}
+
+TEST_F(Flann_Search, Lsh_parallel_knnSearch)
+{
+    RNG& rng = TS::ptr()->get_rng();
+    train.create(5000, 32, CV_8U);
+    rng.fill(train, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+    query.create(500, 32, CV_8U);
+    rng.fill(query, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+
+    Mat indices1, dists1, indices, dists;
+    setNumThreads(1);
+    theRNG() = RNG(12345);
+    flann::Index index(train, flann::LshIndexParams(6, 12, 1), cvflann::FLANN_DIST_HAMMING);
+    index.knnSearch(query, indices1, dists1, 5);
+    setNumThreads(std::max(nthreads, 4));
+    index.knnSearch(query, indices, dists, 5);
+
+    EXPECT_EQ(0, cvtest::norm(indices1, indices, NORM_INF));
+    EXPECT_EQ(0, cvtest::norm(dists1, dists, NORM_INF));
+}
+
+TEST_F(Flann_Search, radiusSearch_batch)
+{
+    const int maxResults = 8;
+    const double radius = 0.3;
+    flann::Index index(train, flann::KDTreeIndexParams(4));
+    Mat indices, dists;
+    int maxCount = index.radiusSearch(query, indices, dists, radius, maxResults, flann::SearchParams(64));
+    ASSERT_EQ(query.rows, indices.rows);
+    ASSERT_EQ(query.rows, dists.rows);
+
+    int expectedMaxCount = 0;
+    for (int i = 0; i < query.rows; i++)
+    {
+        Mat rowIndices, rowDists;
+        int count = index.radiusSearch(query.row(i), rowIndices, rowDists, radius, maxResults, flann::SearchParams(64));
+        expectedMaxCount = std::max(expectedMaxCount, count);
+        count = std::min(count, maxResults);
+        EXPECT_EQ(0, cvtest::norm(rowIndices.colRange(0, count), indices.row(i).colRange(0, count), NORM_INF)) << "query " << i;
+        EXPECT_EQ(0, cvtest::norm(rowDists.colRange(0, count), dists.row(i).colRange(0, count), NORM_INF)) << "query " << i;
+        for (int j = count; j < maxResults; j++)
+        {
+            EXPECT_EQ(-1, indices.at<int>(i, j));
+            EXPECT_EQ(std::numeric_limits<float>::max(), dists.at<float>(i, j));
+        }
+    }
+    EXPECT_GT(maxCount, 0);
+    EXPECT_EQ(expectedMaxCount, maxCount);
+}
+
+}} // namespace
@@ -272,7 +272,8 @@ struct get_border_helper<true, Impl, Ins...>
                                                   const cv::GArgs &in_args,
                                                   cv::detail::Seq<IIs...>)
     {
-        return util::make_optional(Impl::getBorder(cv::detail::get_in_meta<Ins>(metas, in_args, IIs)...));
+        // getBorder() may return either Border or an empty BorderOpt if the kernel doesn't read border pixels
+        return gapi::fluid::BorderOpt(Impl::getBorder(cv::detail::get_in_meta<Ins>(metas, in_args, IIs)...));
     }
 
     static gapi::fluid::BorderOpt help(const GMetaArgs &metas,
@@ -208,6 +208,15 @@ INSTANTIATE_TEST_CASE_P(ResizePerfTestFluid, ResizePerfTest,
                    cv::Size(30, 30)),
             Values(cv::compile_args(IMGPROC_FLUID))));
 
+INSTANTIATE_TEST_CASE_P(ResizeInterpPerfTestFluid, ResizePerfTest,
+    Combine(Values(Tolerance_FloatRel_IntAbs(1e-5, 1).to_compare_f()),
+            Values(CV_8UC1, CV_8UC3, CV_16UC1, CV_32FC1),
+            Values(cv::INTER_NEAREST, cv::INTER_AREA, cv::INTER_CUBIC),
+            Values(sz720p, sz1080p),
+            Values(cv::Size(320, 240),
+                   cv::Size(1920, 1080)),
+            Values(cv::compile_args(IMGPROC_FLUID))));
+
 #define IMGPROC_FLUID cv::gapi::imgproc::fluid::kernels()
 INSTANTIATE_TEST_CASE_P(BottleneckKernelsPerfTestFluid, BottleneckKernelsConstInputPerfTest,
     Combine(Values(AbsSimilarPoints(0, 1).to_compare_f()),
@@ -169,6 +169,18 @@ private:
     int m_inHeight = 0;
 };
 
+// Interpolation kernels with more than 2 taps (e.g. bicubic), both for upscale and downscale
+struct FluidCubicMapper : public FluidMapper
+{
+    virtual int firstWindow(int outCoord, int lpi) const override;
+    virtual std::pair<int,int> linesReadAndNextWindow(int outCoord, int lpi) const override;
+    FluidCubicMapper(double ratio, int lpi, int window, int inHeight)
+        : FluidMapper(ratio, lpi), m_window(window), m_inHeight(inHeight) {}
+private:
+    int m_window = 0;
+    int m_inHeight = 0;
+};
+
 struct FluidFilterAgent : public FluidAgent
 {
 private:
@@ -193,8 +205,14 @@ private:
     virtual void setRatio(double ratio) override;
 
     std::unique_ptr<FluidMapper> m_mapper;
+    int m_window;
 public:
     using FluidAgent::FluidAgent;
+
+    FluidResizeAgent(const ade::Graph &g, ade::NodeHandle nh)
+        : FluidAgent(g, nh)
+        , m_window(GConstFluidModel(g).metadata(nh).get<FluidUnit>().window)
+    {}
 };
 
 struct Fluid420toRGBAgent : public FluidAgent
@@ -292,6 +310,8 @@ static int calcResizeWindow(int inH, int outH)
     }
 }
 
+static int calcWideResizeWindow(int inH, int outH, int lpi, int window);
+
 static int maxLineConsumption(const cv::GFluidKernel::Kind kind, int window, int inH, int outH, int lpi, std::size_t inPort)
 {
     switch (kind)
@@ -299,7 +319,11 @@ static int maxLineConsumption(const cv::GFluidKernel::Kind kind, int window, int
     case cv::GFluidKernel::Kind::Filter: return window + lpi - 1; break;
     case cv::GFluidKernel::Kind::Resize:
     {
-        if  (inH >= outH)
+        if (window > 2)
+        {
+            return calcWideResizeWindow(inH, outH, lpi, window);
+        }
+        else if (inH >= outH)
         {
             // FIXME:
             // This is a suboptimal value, can be reduced
@@ -366,8 +390,51 @@ inline int upscaleWindowEnd(int outCoord, double ratio, int inSz)
     }
     return end;
 }
+
+// Resize kernels with Window > 2 read window/2 lines on each side of the projection
+// of output pixel's center, the lines which fall outside of the image are replaced
+// by the border ones by the kernel itself
+inline int wideWindowStart(int outCoord, double ratio, int window, int inSz)
+{
+    int start = static_cast<int>(std::floor(inCoordUpscale(outCoord, ratio))) - (window/2 - 1);
+    return std::min(std::max(start, 0), inSz - 1);
+}
+
+inline int wideWindowEnd(int outCoord, double ratio, int window, int inSz)
+{
+    int end = static_cast<int>(std::floor(inCoordUpscale(outCoord, ratio))) + window/2 + 1;
+    return std::min(std::max(end, 1), inSz);
+}
+
+static int calcWideResizeWindow(int inH, int outH, int lpi, int window)
+{
+    double ratio = (double)inH / outH;
+    int maxWindow = 1;
+    // output ROI may start at any line, so every group of lpi lines is checked
+    for (int y = 0; y < outH; y++)
+    {
+        int last = std::min(y + lpi, outH) - 1;
+        maxWindow = std::max(maxWindow, wideWindowEnd(last, ratio, window, inH) - wideWindowStart(y, ratio, window, inH));
+    }
+    return maxWindow;
+}
 } // anonymous namespace
 
+std::pair<int,int> cv::gimpl::resizeWindow(int outCoord, int inSz, int outSz, int window)
+{
+    double ratio = (double)inSz / outSz;
+    if (window > 2)
+    {
+        return std::make_pair(wideWindowStart(outCoord, ratio, window, inSz),
+                              wideWindowEnd  (outCoord, ratio, window, inSz));
+    }
+    else if (ratio >= 1.0)
+    {
+        return std::make_pair(windowStart(outCoord, ratio), windowEnd(outCoord, ratio));
+    }
+    return std::make_pair(upscaleWindowStart(outCoord, ratio), upscaleWindowEnd(outCoord, ratio, inSz));
+}
+
 int cv::gimpl::FluidDownscaleMapper::firstWindow(int outCoord, int lpi) const
 {
     return windowEnd(outCoord + lpi - 1, m_ratio) - windowStart(outCoord, m_ratio);
@@ -408,6 +475,26 @@ std::pair<int,int> cv::gimpl::FluidUpscaleMapper::linesReadAndNextWindow(int out
     return std::make_pair(lines_read, next_window);
 }
 
+int cv::gimpl::FluidCubicMapper::firstWindow(int outCoord, int lpi) const
+{
+    return wideWindowEnd(outCoord + lpi - 1, m_ratio, m_window, m_inHeight) - wideWindowStart(outCoord, m_ratio, m_window, m_inHeight);
+}
+
+std::pair<int,int> cv::gimpl::FluidCubicMapper::linesReadAndNextWindow(int outCoord, int lpi) const
+{
+    auto nextStartIdx = outCoord + 1 + m_lpi - 1;
+    auto nextEndIdx   = nextStartIdx + lpi - 1;
+
+    auto currStart = wideWindowStart(outCoord, m_ratio, m_window, m_inHeight);
+    auto nextStart = wideWindowStart(nextStartIdx, m_ratio, m_window, m_inHeight);
+    auto nextEnd   = wideWindowEnd(nextEndIdx, m_ratio, m_window, m_inHeight);
+
+    auto lines_read = nextStart - currStart;
+    auto next_window = nextEnd - nextStart;
+
+    return std::make_pair(lines_read, next_window);
+}
+
 int cv::gimpl::FluidFilterAgent::firstWindow(std::size_t) const
 {
     int lpi = std::min(k.m_lpi, m_outputLines - m_producedLines);
@@ -448,7 +535,11 @@ std::pair<int,int> cv::gimpl::Fluid420toRGBAgent::linesReadAndnextWindow(std::si
 
 void cv::gimpl::FluidResizeAgent::setRatio(double ratio)
 {
-    if (ratio >= 1.0)
+    if (m_window > 2)
+    {
+        m_mapper.reset(new FluidCubicMapper(ratio, k.m_lpi, m_window, in_views[0].meta().size.height));
+    }
+    else if (ratio >= 1.0)
     {
         m_mapper.reset(new FluidDownscaleMapper(ratio, k.m_lpi));
     }
@@ -645,11 +736,16 @@ void cv::gimpl::GFluidExecutable::initBufferRois(std::vector<int>& readStarts,
                         return roi & fullImg;
                     };
 
-                    auto adjResizeRoi = [](cv::Rect produced, cv::Size inSz, cv::Size outSz) {
-                        auto map = [](int outCoord, int producedSz, int inSize, int outSize) {
+                    auto adjResizeRoi = [](cv::Rect produced, cv::Size inSz, cv::Size outSz, int window) {
+                        auto map = [](int outCoord, int producedSz, int inSize, int outSize, int window) {
                             double ratio = (double)inSize / outSize;
                             int w0 = 0, w1 = 0;
-                            if (ratio >= 1.0)
+                            if (window > 2)
+                            {
+                                w0 = wideWindowStart(outCoord, ratio, window, inSize);
+                                w1 = wideWindowEnd  (outCoord + producedSz - 1, ratio, window, inSize);
+                            }
+                            else if (ratio >= 1.0)
                             {
                                 w0 = windowStart(outCoord, ratio);
                                 w1 = windowEnd  (outCoord + producedSz - 1, ratio);
@@ -662,11 +758,12 @@ void cv::gimpl::GFluidExecutable::initBufferRois(std::vector<int>& readStarts,
                             return std::make_pair(w0, w1);
                         };
 
-                        auto mapY = map(produced.y, produced.height, inSz.height, outSz.height);
+                        auto mapY = map(produced.y, produced.height, inSz.height, outSz.height, window);
                         auto y0 = mapY.first;
                         auto y1 = mapY.second;
 
-                        auto mapX = map(produced.x, produced.width, inSz.width, outSz.width);
+                        // Only whole lines are processed, so wide kernels don't narrow the window here
+                        auto mapX = map(produced.x, produced.width, inSz.width, outSz.width, 1);
                         auto x0 = mapX.first;
                         auto x1 = mapX.second;
 
@@ -697,7 +794,8 @@ void cv::gimpl::GFluidExecutable::initBufferRois(std::vector<int>& readStarts,
                     switch (fg.metadata(oh).get<FluidUnit>().k.m_kind)
                     {
                     case GFluidKernel::Kind::Filter:      resized = produced; break;
-                    case GFluidKernel::Kind::Resize:      resized = adjResizeRoi(produced, in_meta.size, meta.size); break;
+                    case GFluidKernel::Kind::Resize:      resized = adjResizeRoi(produced, in_meta.size, meta.size,
+                                                                                 fg.metadata(oh).get<FluidUnit>().window); break;
                     case GFluidKernel::Kind::YUV420toRGB: resized = adj420Roi(produced, m_gm.metadata(in_edge).get<Input>().port); break;
                     default: GAPI_Error("InternalError");
                     }
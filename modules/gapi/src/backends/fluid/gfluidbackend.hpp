@@ -32,6 +32,10 @@ struct FluidUnit
     double ratio;
 };
 
+// Input lines [first, second) which a Resize kernel with the given window is
+// provided with to produce the output line outCoord
+std::pair<int,int> resizeWindow(int outCoord, int inSz, int outSz, int window);
+
 struct FluidUseOwnBorderBuffer
 {
     static const char *name() { return "FluidUseOwnBorderBuffer"; }
@@ -2175,9 +2175,314 @@ CV_ALWAYS_INLINE void calcRowLinear(const cv::gapi::fluid::View& in,
     }
 }
 
+//------------------------------------------------------------------------------
+//
+// Fluid kernels: resize with nearest, area and bicubic interpolation
+//
+//------------------------------------------------------------------------------
+
+// Every output pixel is a weighted sum of xtaps x ytaps input pixels. The tables keep
+// the taps clamped to the image like cv::resize does, the window of the kernel is wide
+// enough to hold all the input lines of the output one.
+struct ResizeTaps
+{
+    int x;
+    int y;
+};
+
+static inline bool isAreaDownscale(int interp, const Size& inSz, const Size& outSz)
+{
+    // same as in cv::resize: INTER_AREA is a bilinear-like one if any direction is enlarged
+    return interp == cv::INTER_AREA && inSz.width >= outSz.width && inSz.height >= outSz.height;
+}
+
+static inline int resizeTaps(int interp, bool areaDownscale, int inSz, int outSz)
+{
+    switch (interp)
+    {
+    case cv::INTER_NEAREST: return 1;
+    case cv::INTER_LINEAR:  return 2;
+    case cv::INTER_CUBIC:   return 4;
+    case cv::INTER_AREA:    return areaDownscale ? cvFloor(ratio(inSz, outSz)) + 2 : 2;
+    default: CV_Error(cv::Error::StsBadArg, "unsupported interpolation method");
+    }
+}
+
+static inline ResizeTaps resizeTaps(int interp, const Size& inSz, const Size& outSz)
+{
+    bool areaDownscale = isAreaDownscale(interp, inSz, outSz);
+    return { resizeTaps(interp, areaDownscale, inSz.width,  outSz.width),
+             resizeTaps(interp, areaDownscale, inSz.height, outSz.height) };
+}
+
+struct ResizeScratchDesc
+{
+    int*   mapsx;  // outW x taps.x, offsets of the input pixels in the row
+    float* alpha;  // outW x taps.x
+    int*   mapsy;  // outH x taps.y, indices of the input lines
+    float* beta;   // outH x taps.y
+    float* tmp;    // inW x chan, the input lines blended together
+
+    ResizeScratchDesc(int /*inW*/, int outW, int outH, int /*chan*/, ResizeTaps taps, void* data) {
+        mapsx = reinterpret_cast<int*>  (data);
+        alpha = reinterpret_cast<float*>(mapsx + outW * taps.x);
+        mapsy = reinterpret_cast<int*>  (alpha + outW * taps.x);
+        beta  = reinterpret_cast<float*>(mapsy + outH * taps.y);
+        tmp   = reinterpret_cast<float*>(beta  + outH * taps.y);
+    }
+
+    static int bufSize(int inW, int outW, int outH, int chan, ResizeTaps taps) {
+        auto size = outW * taps.x * (sizeof(int) + sizeof(float)) +
+                    outH * taps.y * (sizeof(int) + sizeof(float)) +
+                     inW * chan   *  sizeof(float);
+
+        return static_cast<int>(size);
+    }
+};
+
+// Fills the taps of every output coordinate, the unused taps have zero weight
+// and point to the first one
+static void calcResizeTab(int interp, bool areaDownscale, int inSz, int outSz, int taps,
+                          int* mapx, float* alpha)
+{
+    const double scale = ratio(inSz, outSz);
+    const double inv_scale = invRatio(inSz, outSz);
+
+    for (int d = 0; d < outSz; d++)
+    {
+        int*   m = mapx  + d * taps;
+        float* a = alpha + d * taps;
+        int n = 0;
+
+        auto addTap = [&](int s, float w) {
+            GAPI_DbgAssert(n < taps);
+            m[n] = std::min(std::max(s, 0), inSz - 1);
+            a[n] = w;
+            n++;
+        };
+
+        if (interp == cv::INTER_NEAREST)
+        {
+            addTap(cvFloor(d * scale), 1.f);
+        }
+        else if (interp == cv::INTER_AREA && areaDownscale)
+        {
+            double fs1 = d * scale;
+            double fs2 = fs1 + scale;
+            double cellWidth = std::min(scale, inSz - fs1);
+
+            int s1 = cvCeil(fs1), s2 = cvFloor(fs2);
+            s2 = std::min(s2, inSz - 1);
+            s1 = std::min(s1, s2);
+
+            if (s1 - fs1 > 1e-3)
+                addTap(s1 - 1, static_cast<float>((s1 - fs1) / cellWidth));
+
+            for (int s = s1; s < s2; s++)
+                addTap(s, static_cast<float>(1.0 / cellWidth));
+
+            if (fs2 - s2 > 1e-3)
+                addTap(s2, static_cast<float>(std::min(std::min(fs2 - s2, 1.), cellWidth) / cellWidth));
+        }
+        else
+        {
+            float f = 0.f;
+            int s = 0;
+            if (interp == cv::INTER_AREA)
+            {
+                s = cvFloor(d * scale);
+                f = static_cast<float>((d + 1) - (s + 1) * inv_scale);
+                f = f <= 0 ? 0.f : f - cvFloor(f);
+            }
+            else
+            {
+                f = static_cast<float>((d + 0.5) * scale - 0.5);
+                s = cvFloor(f);
+                f -= s;
+            }
+
+            if (interp == cv::INTER_CUBIC)
+            {
+                constexpr float A = -0.75f;
+                float c0 = ((A*(f + 1) - 5*A)*(f + 1) + 8*A)*(f + 1) - 4*A;
+                float c1 = ((A + 2)*f - (A + 3))*f*f + 1;
+                float c2 = ((A + 2)*(1 - f) - (A + 3))*(1 - f)*(1 - f) + 1;
+                addTap(s - 1, c0);
+                addTap(s,     c1);
+                addTap(s + 1, c2);
+                addTap(s + 2, 1.f - c0 - c1 - c2);
+            }
+            else
+            {
+                if (s < 0)
+                {
+                    s = 0;
+                    f = 0.f;
+                }
+                if (s >= inSz - 1)
+                {
+                    s = inSz - 1;
+                    f = 0.f;
+                }
+                addTap(s,     1.f - f);
+                addTap(s + 1, f);
+            }
+        }
+
+        for (int k = 0; k < taps; k++)
+        {
+            if (k >= n || a[k] == 0.f)
+            {
+                m[k] = m[0];
+                a[k] = 0.f;
+            }
+        }
+    }
+}
+
+static cv::Size resizeOutSize(const cv::GMatDesc& in, const cv::Size& outSz, double fx, double fy)
+{
+    if (outSz.width == 0 || outSz.height == 0)
+    {
+        return cv::Size(saturate_cast<int>(in.size.width  * fx),
+                        saturate_cast<int>(in.size.height * fy));
+    }
+    return outSz;
+}
+
+static int resizeKernelWindow(int inH, int outH)
+{
+    // The window is centered at the projection c = (y + 0.5) * ratio - 0.5 of the output line
+    // and spans [floor(c) - (window/2 - 1), floor(c) + window/2]. The area cell of the line
+    // lies within ratio/2 + 0.5 of c and the bicubic taps are [floor(c) - 1, floor(c) + 2],
+    // so one more line on each side keeps all the taps inside of the window even if the
+    // coordinates are rounded differently.
+    int halfCell = cvCeil(std::max(ratio(inH, outH), 1.) / 2);
+    return 2 * halfCell + 4;
+}
+
+static void initScratchResize(const cv::GMatDesc& in, const Size& outSz, int interp,
+                              cv::gapi::fluid::Buffer& scratch)
+{
+    auto inSz = in.size;
+    auto taps = resizeTaps(interp, inSz, outSz);
+    bool areaDownscale = isAreaDownscale(interp, inSz, outSz);
+
+    auto sbufsize = ResizeScratchDesc::bufSize(inSz.width, outSz.width, outSz.height, in.chan, taps);
+
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = Size{sbufsize, 1};
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+
+    ResizeScratchDesc scr(inSz.width, outSz.width, outSz.height, in.chan, taps, scratch.OutLineB());
+
+    calcResizeTab(interp, areaDownscale, inSz.width, outSz.width, taps.x, scr.mapsx, scr.alpha);
+    for (int i = 0; i < outSz.width * taps.x; i++)
+    {
+        scr.mapsx[i] *= in.chan;
+    }
+
+    calcResizeTab(interp, areaDownscale, inSz.height, outSz.height, taps.y, scr.mapsy, scr.beta);
+    const int window = resizeKernelWindow(inSz.height, outSz.height);
+    for (int y = 0; y < outSz.height; y++)
+    {
+        auto w = cv::gimpl::resizeWindow(y, inSz.height, outSz.height, window);
+        for (int k = 0; k < taps.y; k++)
+        {
+            int sy = scr.mapsy[y * taps.y + k];
+            GAPI_Assert(sy >= w.first && sy < w.second);
+        }
+    }
+}
+
+template<typename T>
+static void calcRowResize(const cv::gapi::fluid::View  & in,
+                                cv::gapi::fluid::Buffer& out,
+                                cv::gapi::fluid::Buffer& scratch,
+                                int interp)
+{
+    auto  inSz =  in.meta().size;
+    auto outSz = out.meta().size;
+    int chan = in.meta().chan;
+
+    auto taps = resizeTaps(interp, inSz, outSz);
+    ResizeScratchDesc scr(inSz.width, outSz.width, outSz.height, chan, taps, scratch.OutLineB());
+
+    int inY = in.y();
+    int outY = out.y();
+    int lpi = out.lpi();
+    GAPI_DbgAssert(outY + lpi <= outSz.height);
+
+    int inLength = inSz.width * chan;
+    int outWidth = out.length();
+
+    for (int l = 0; l < lpi; l++)
+    {
+        const int*   mapsy = scr.mapsy + (outY + l) * taps.y;
+        const float* beta  = scr.beta  + (outY + l) * taps.y;
+        T* dst = out.OutLine<T>(l);
+
+        if (interp == cv::INTER_NEAREST)
+        {
+            const T* src = in.InLine<T>(mapsy[0] - inY);
+            for (int x = 0; x < outWidth; x++)
+            {
+                const T* s = src + scr.mapsx[x];
+                for (int c = 0; c < chan; c++)
+                {
+                    dst[x * chan + c] = s[c];
+                }
+            }
+            continue;
+        }
+
+        // vertical pass: blend the input lines of the window into a single one
+        float* tmp = scr.tmp;
+        {
+            const T* src = in.InLine<T>(mapsy[0] - inY);
+            float b = beta[0];
+            for (int i = 0; i < inLength; i++)
+            {
+                tmp[i] = b * src[i];
+            }
+        }
+        for (int k = 1; k < taps.y; k++)
+        {
+            if (beta[k] == 0.f)
+                continue;
+
+            const T* src = in.InLine<T>(mapsy[k] - inY);
+            float b = beta[k];
+            for (int i = 0; i < inLength; i++)
+            {
+                tmp[i] += b * src[i];
+            }
+        }
+
+        // horizontal pass
+        for (int x = 0; x < outWidth; x++)
+        {
+            const int*   mapsx = scr.mapsx + x * taps.x;
+            const float* alpha = scr.alpha + x * taps.x;
+            for (int c = 0; c < chan; c++)
+            {
+                float sum = 0.f;
+                for (int k = 0; k < taps.x; k++)
+                {
+                    sum += alpha[k] * tmp[mapsx[k] + c];
+                }
+                dst[x * chan + c] = saturate_cast<T>(sum);
+            }
+        }
+    }
+}
+
 GAPI_FLUID_KERNEL(GFluidResize, cv::gapi::imgproc::GResize, true)
 {
-    static const int Window = 1;
     static const int LPI = 4;
     static const auto Kind = GFluidKernel::Kind::Resize;
 
@@ -2185,67 +2490,91 @@ GAPI_FLUID_KERNEL(GFluidResize, cv::gapi::imgproc::GResize, true)
     constexpr static const int INTER_RESIZE_COEF_SCALE = 1 << INTER_RESIZE_COEF_BITS;
     constexpr static const short ONE = INTER_RESIZE_COEF_SCALE;
 
+    static void checkParams(const cv::GMatDesc& in, int interp)
+    {
+        GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_16S || in.depth == CV_32F);
+        GAPI_Assert(in.chan >= 1 && in.chan <= 4);
+        GAPI_Assert(interp == cv::INTER_NEAREST || interp == cv::INTER_LINEAR ||
+                    interp == cv::INTER_AREA    || interp == cv::INTER_CUBIC);
+    }
+
+    // bilinear resize of 8UC3 and 32FC1 has dedicated implementations
+    static bool isLinear8UC3(const cv::GMatDesc& in, int interp)
+    {
+        return interp == cv::INTER_LINEAR && in.depth == CV_8U && in.chan == 3;
+    }
+
+    static bool isLinear32FC1(const cv::GMatDesc& in, int interp)
+    {
+        return interp == cv::INTER_LINEAR && in.depth == CV_32F && in.chan == 1;
+    }
+
    static void initScratch(const cv::GMatDesc& in,
                            cv::Size outSz, double fx, double fy, int interp,
                            cv::gapi::fluid::Buffer &scratch)
    {
-       GAPI_Assert((in.depth == CV_8U && in.chan == 3) ||
-                   (in.depth == CV_32F && in.chan == 1));
-       GAPI_Assert(interp == cv::INTER_LINEAR);
+       checkParams(in, interp);
 
-       int outSz_w;
-       int outSz_h;
-       if (outSz.width == 0 || outSz.height == 0)
-       {
-           outSz_w = saturate_cast<int>(in.size.width * fx);
-           outSz_h = saturate_cast<int>(in.size.height * fy);
-       }
-       else
-       {
-           outSz_w = outSz.width;
-           outSz_h = outSz.height;
-       }
-       cv::Size outSize(outSz_w, outSz_h);
+       cv::Size outSize = resizeOutSize(in, outSz, fx, fy);
 
-       if (in.depth == CV_8U && in.chan == 3)
+       if (isLinear8UC3(in, interp))
        {
            initScratchLinear<uchar, linear::Mapper, 3>(in, outSize, scratch, LPI);
        }
-       else if (in.depth == CV_32F && in.chan == 1)
+       else if (isLinear32FC1(in, interp))
        {
            initScratchLinear<float, linear32f::Mapper, 1>(in, outSize, scratch, LPI);
        }
        else
        {
-           CV_Error(cv::Error::StsBadArg, "unsupported combination of type and number of channel");
+           initScratchResize(in, outSize, interp, scratch);
        }
    }
 
     static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/)
     {}
 
+    static cv::gapi::fluid::BorderOpt getBorder(const cv::GMatDesc& /* in */, const cv::Size& /* sz */,
+                                                double /* fx */, double /* fy */, int /* interp */)
+    {
+        // Resize never reads from border pixels
+        return {};
+    }
+
+    static int getWindow(const cv::GMatDesc& in, const cv::Size& sz,
+                         double fx, double fy, int interp)
+    {
+        if (isLinear8UC3(in, interp) || isLinear32FC1(in, interp))
+        {
+            return 1;
+        }
+        return resizeKernelWindow(in.size.height, resizeOutSize(in, sz, fx, fy).height);
+    }
+
     static void run(const cv::gapi::fluid::View& in, cv::Size /*sz*/, double /*fx*/,
                     double /*fy*/, int interp, cv::gapi::fluid::Buffer& out,
                     cv::gapi::fluid::Buffer& scratch)
     {
-        GAPI_Assert((in.meta().depth == CV_8U && in.meta().chan == 3) ||
-                    (in.meta().depth == CV_32F && in.meta().chan == 1));
-        GAPI_Assert(interp == cv::INTER_LINEAR);
-
-        const int channels = in.meta().chan;
-        const int depth = in.meta().depth;
+        checkParams(in.meta(), interp);
 
-        if (depth == CV_8U && channels == 3)
+        if (isLinear8UC3(in.meta(), interp))
         {
             calcRowLinearC<uint8_t, linear::Mapper, 3>(in, out, scratch);
+            return;
         }
-        else if (depth == CV_32F && channels == 1)
+        else if (isLinear32FC1(in.meta(), interp))
         {
             calcRowLinear<linear32f::Mapper>(in, out, scratch);
+            return;
         }
-        else
+
+        switch (in.meta().depth)
         {
-            CV_Error(cv::Error::StsBadArg, "unsupported combination of type and number of channel");
+        case CV_8U:  calcRowResize<uchar >(in, out, scratch, interp); break;
+        case CV_16U: calcRowResize<ushort>(in, out, scratch, interp); break;
+        case CV_16S: calcRowResize<short >(in, out, scratch, interp); break;
+        case CV_32F: calcRowResize<float >(in, out, scratch, interp); break;
+        default: CV_Error(cv::Error::StsBadArg, "unsupported combination of type and number of channel");
         }
     }
 };
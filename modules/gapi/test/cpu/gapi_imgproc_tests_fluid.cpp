@@ -38,6 +38,29 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFxFyFluid, ResizeTestFxFy,
                                 Values(0.5, 1, 2),
                                 Values(0.5, 1, 2)));
 
+INSTANTIATE_TEST_CASE_P(ResizeInterpTestFluid, ResizeTest,
+                        Combine(Values(CV_8UC1, CV_8UC3, CV_8UC4, CV_16UC1, CV_16SC3, CV_32FC1, CV_32FC3),
+                                Values(cv::Size(1280, 720),
+                                       cv::Size(30, 30)),
+                                Values(-1),
+                                Values(IMGPROC_FLUID),
+                                Values(Tolerance_FloatRel_IntAbs(1e-5, 1).to_compare_obj()),
+                                Values(cv::INTER_NEAREST, cv::INTER_LINEAR, cv::INTER_AREA, cv::INTER_CUBIC),
+                                Values(cv::Size(1280, 720),
+                                       cv::Size(640, 480),
+                                       cv::Size(30, 30))));
+
+INSTANTIATE_TEST_CASE_P(ResizeInterpTestFxFyFluid, ResizeTestFxFy,
+                        Combine(Values(CV_8UC1, CV_8UC4, CV_16UC1, CV_32FC1),
+                                Values(cv::Size(1280, 720),
+                                       cv::Size(30, 30)),
+                                Values(-1),
+                                Values(IMGPROC_FLUID),
+                                Values(Tolerance_FloatRel_IntAbs(1e-5, 1).to_compare_obj()),
+                                Values(cv::INTER_NEAREST, cv::INTER_AREA, cv::INTER_CUBIC),
+                                Values(0.5, 1, 2),
+                                Values(0.5, 1, 2)));
+
 INSTANTIATE_TEST_CASE_P(RGB2GrayTestFluid, RGB2GrayTest,
                         Combine(Values(CV_8UC3),
                                 Values(cv::Size(1280, 720)),
@@ -559,6 +559,56 @@ INSTANTIATE_TEST_CASE_P(Resize220_400TestCPU, ResizeTestFluid,
                                 Values(1, 2, 3, 4), // lpi
                                 Values(0.0)));
 
+struct ImgprocResizeTestFluid : public TestWithParam<std::tuple<int, int, cv::Size, std::tuple<cv::Size, cv::Rect>>> {};
+TEST_P(ImgprocResizeTestFluid, SanityTest)
+{
+    int type = 0, interp = 0;
+    cv::Size sz_in, sz_out;
+    cv::Rect outRoi;
+    std::tuple<cv::Size, cv::Rect> outSizeAndRoi;
+    std::tie(type, interp, sz_in, outSizeAndRoi) = GetParam();
+    std::tie(sz_out, outRoi) = outSizeAndRoi;
+    if (outRoi == cv::Rect{}) outRoi = {0,0,sz_out.width,sz_out.height};
+    if (outRoi.width == 0) outRoi.width = sz_out.width;
+
+    cv::Mat in_mat1 (sz_in, CV_MAKETYPE(CV_8U, CV_MAT_CN(type)));
+    cv::randu(in_mat1, cv::Scalar::all(0), cv::Scalar::all(255));
+
+    cv::Mat out_mat = cv::Mat::zeros(sz_out, type);
+    cv::Mat out_mat_ocv = cv::Mat::zeros(sz_out, type);
+
+    // resize reads its input from an internal buffer, so the lines it is provided with must cover its taps
+    cv::GMat in;
+    auto mid = cv::gapi::convertTo(in, CV_MAT_DEPTH(type));
+    auto out = cv::gapi::resize(mid, sz_out, 0, 0, interp);
+
+    cv::GComputation c(in, out);
+    c.apply(in_mat1, out_mat, cv::compile_args(GFluidOutputRois{{outRoi}},
+                                               combine(cv::gapi::core::fluid::kernels(), cv::gapi::imgproc::fluid::kernels())));
+
+    cv::Mat mid_mat;
+    in_mat1.convertTo(mid_mat, CV_MAT_DEPTH(type));
+    cv::resize(mid_mat, out_mat_ocv, sz_out, 0, 0, interp);
+
+    EXPECT_LE(cvtest::norm(out_mat(outRoi), out_mat_ocv(outRoi), NORM_INF), CV_MAT_DEPTH(type) == CV_32F ? 1e-3 : 1.0);
+}
+
+INSTANTIATE_TEST_CASE_P(ResizeTestFluid, ImgprocResizeTestFluid,
+                        Combine(Values(CV_8UC1, CV_8UC3, CV_16UC1, CV_32FC1, CV_32FC4),
+                                Values(cv::INTER_NEAREST, cv::INTER_LINEAR, cv::INTER_AREA, cv::INTER_CUBIC),
+                                Values(cv::Size(3, 5),
+                                       cv::Size(8, 7),
+                                       cv::Size(16, 25),
+                                       cv::Size(128, 400)),
+                                Values(std::make_tuple(cv::Size(5, 4), cv::Rect{}),
+                                       std::make_tuple(cv::Size(5, 4), cv::Rect{0, 1, 0, 2}),
+                                       std::make_tuple(cv::Size(8, 8), cv::Rect{0, 2, 8, 2}),
+                                       std::make_tuple(cv::Size(16, 25), cv::Rect{}),
+                                       std::make_tuple(cv::Size(16, 25), cv::Rect{0, 7, 16, 6}),
+                                       std::make_tuple(cv::Size(23, 3), cv::Rect{0, 1, 0, 1}),
+                                       std::make_tuple(cv::Size(128, 384), cv::Rect{}),
+                                       std::make_tuple(cv::Size(128, 384), cv::Rect{0, 190, 0, 100}))));
+
 static auto cvBlur = [](const cv::Mat& in, cv::Mat& out, int kernelSize)
 {
     if (kernelSize == 1)
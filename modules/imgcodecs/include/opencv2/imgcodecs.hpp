@@ -281,6 +281,72 @@ The image passing through the img parameter can be pre-allocated. The memory is
  */
 CV_EXPORTS_W void imread( const String& filename, OutputArray dst, int flags = IMREAD_COLOR );
 
+/** @brief Loads an image from a file and resizes it to the given size.
+
+The result is the same as of cv::imread followed by cv::resize, but large downscaling is much faster and needs
+less memory: the codecs which are able to do it decode the image in a reduced resolution, which is not smaller than
+the requested one, and only the rest is done by cv::resize (with #INTER_AREA for downscaling). Reduced resolution
+decoding is supported by:
+-   JPEG: M/8 scaling in IDCT (1/8, 1/4 and 1/2 only if OpenCV is built with the original libjpeg),
+-   WebP: the scaler of libwebp produces the image of the requested size directly,
+-   PNG (non-interlaced) and TIFF (strips, top-left orientation): the image is downscaled by an integer factor
+    with box filter while it is decoded row by row.
+
+@param filename Name of file to be loaded.
+@param dsize Size of the output image (with EXIF orientation applied). If one of the components is 0, it is
+computed from the other one preserving the aspect ratio.
+@param flags Flag that can take values of cv::ImreadModes. Scaling of IMREAD_REDUCED_* modes is ignored.
+@sa imread, imdecodeResized
+ */
+CV_EXPORTS_W Mat imreadResized( const String& filename, Size dsize, int flags = IMREAD_COLOR );
+
+/** @overload
+@param filename Name of file to be loaded.
+@param maxSize Maximal size of the longest side of the output image. The aspect ratio is preserved, the images
+which are smaller than maxSize are not enlarged.
+@param flags Flag that can take values of cv::ImreadModes.
+ */
+CV_EXPORTS_W Mat imreadResized( const String& filename, int maxSize, int flags = IMREAD_COLOR );
+
+/** @brief Loads a region of an image from a file.
+
+The result is the same as of cv::imread followed by cropping of the region, but the memory is bounded by the
+region size rather than by the image size, and only the necessary part of the file is decoded where the codec
+allows it:
+-   TIFF (top-left orientation): only the tiles or strips intersecting the region are decoded,
+-   JPEG: the rows below the region are not decoded; with libjpeg-turbo the rows above the region are skipped
+    and only the iMCU columns containing the region are decoded,
+-   PNG (non-interlaced): the rows are decoded one by one up to the bottom of the region.
+
+The other formats are decoded in full and cropped.
+
+@param filename Name of file to be loaded.
+@param roi Region of the image to load, it must be inside the image. The region is given in the coordinates
+of the image as it is stored in the file, EXIF orientation is not applied.
+@param flags Flag that can take values of cv::ImreadModes. Scaling of IMREAD_REDUCED_* modes is ignored.
+@sa imread, imdecodeROI, ImageBandReader
+ */
+CV_EXPORTS_W Mat imreadROI( const String& filename, const Rect& roi, int flags = IMREAD_COLOR );
+
+/** @brief Loads a batch of images from files in parallel.
+
+The images are loaded the same way as with cv::imread, but in parallel on the OpenCV thread pool (see
+cv::setNumThreads). Every file is read into memory at once and decoded from there, so the reads of some files
+overlap with the decoding of the others. The function doesn't throw if some images can't be loaded, the reasons
+are reported in errors.
+
+@param filenames Names of the files to be loaded.
+@param images Output images, one per file. The matrices which are already there are reused if their size and
+type match the loaded images (see Mat::create), so the buffers are not reallocated when batches of images of the
+same size are loaded repeatedly. The images which can't be loaded are empty.
+@param errors Output error messages, one per file. The message is empty if the image is loaded.
+@param flags Flag that can take values of cv::ImreadModes.
+@return The number of loaded images.
+@sa imread, imdecodeBatch
+ */
+CV_EXPORTS_W int imreadBatch( const std::vector<String>& filenames, CV_IN_OUT std::vector<Mat>& images,
+                              CV_OUT std::vector<String>& errors, int flags = IMREAD_COLOR );
+
 /** @brief Loads a multi-page image from a file.
 
 The function imreadmulti loads a multi-page image from the specified file into a vector of Mat objects.
@@ -381,6 +447,48 @@ failure the function returns empty cv::Mat object, but does not release user-pro
 */
 CV_EXPORTS Mat imdecode( InputArray buf, int flags, Mat* dst);
 
+/** @brief Reads an image from a buffer in memory and resizes it to the given size.
+
+See cv::imreadResized for the details.
+
+@param buf Input array or vector of bytes.
+@param dsize Size of the output image. If one of the components is 0, it is computed from the other one
+preserving the aspect ratio.
+@param flags The same flags as in cv::imread, see cv::ImreadModes.
+*/
+CV_EXPORTS_W Mat imdecodeResized( InputArray buf, Size dsize, int flags = IMREAD_COLOR );
+
+/** @overload
+@param buf Input array or vector of bytes.
+@param maxSize Maximal size of the longest side of the output image.
+@param flags The same flags as in cv::imread, see cv::ImreadModes.
+*/
+CV_EXPORTS_W Mat imdecodeResized( InputArray buf, int maxSize, int flags = IMREAD_COLOR );
+
+/** @brief Reads a region of an image from a buffer in memory.
+
+See cv::imreadROI for the details.
+
+@param buf Input array or vector of bytes.
+@param roi Region of the image to read, it must be inside the image.
+@param flags The same flags as in cv::imread, see cv::ImreadModes.
+*/
+CV_EXPORTS_W Mat imdecodeROI( InputArray buf, const Rect& roi, int flags = IMREAD_COLOR );
+
+/** @brief Reads a batch of images from buffers in memory in parallel.
+
+See cv::imreadBatch for the details.
+
+@param bufs Input buffers: vector of Mat or vector of vectors of bytes.
+@param images Output images, one per buffer. The matrices which are already there are reused if their size and
+type match the decoded images.
+@param errors Output error messages, one per buffer. The message is empty if the image is decoded.
+@param flags The same flags as in cv::imread, see cv::ImreadModes.
+@return The number of decoded images.
+*/
+CV_EXPORTS_W int imdecodeBatch( InputArrayOfArrays bufs, CV_IN_OUT std::vector<Mat>& images,
+                                CV_OUT std::vector<String>& errors, int flags = IMREAD_COLOR );
+
 /** @brief Reads a multi-page image from a buffer in memory.
 
 The function imdecodemulti reads a multi-page image from the specified buffer in the memory. If the buffer is too short or
@@ -468,6 +576,46 @@ protected:
     Ptr<Impl> pImpl;
 };
 
+/** @brief Reads an image by horizontal bands of rows
+
+The image is read from top to bottom, every call of read() returns the next band of bandHeight rows (the last one
+may be smaller). The codecs supported by cv::imreadROI continue decoding where the previous band has ended, so the
+image is decoded only once and the memory is bounded by the band size. The other formats are decoded in full on
+the first read() call and the bands are copied from the decoded image. EXIF orientation is not applied.
+
+@code
+    ImageBandReader reader("huge.tif", 256);
+    Mat band;
+    while (reader.read(band))
+        process(band, reader.position() - band.rows);
+@endcode
+@sa imreadROI
+*/
+class CV_EXPORTS ImageBandReader {
+public:
+    ImageBandReader();
+    /** @param filename Name of file to be loaded.
+    @param bandHeight Number of rows in a band.
+    @param flags Flag that can take values of cv::ImreadModes. Scaling of IMREAD_REDUCED_* modes is ignored.
+    */
+    ImageBandReader(const String& filename, int bandHeight, int flags = IMREAD_COLOR);
+    /** Opens the file and reads the image header, returns false if the image can't be read. */
+    bool open(const String& filename, int bandHeight, int flags = IMREAD_COLOR);
+    bool isOpened() const;
+    /** Size of the whole image. */
+    Size size() const;
+    /** Type of the bands. */
+    int type() const;
+    /** Index of the first row of the next band. */
+    int position() const;
+    /** Reads the next band, returns false if there are no more rows or the image can't be decoded. */
+    bool read(OutputArray band);
+
+    class Impl;
+protected:
+    Ptr<Impl> pImpl;
+};
+
 //! @} imgcodecs
 
 } // cv
@@ -0,0 +1,89 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+#include "perf_precomp.hpp"
+
+namespace opencv_test
+{
+
+using namespace perf;
+
+static const int BATCH_SIZE = 32;
+
+static std::vector< vector<uchar> > getEncodedBatch(const string& ext)
+{
+    std::vector< vector<uchar> > bufs(BATCH_SIZE);
+    RNG rng(12345);
+    for (int i = 0; i < BATCH_SIZE; i++)
+    {
+        // 640x480 "photos": smooth noise
+        Mat img(480, 640, CV_8UC3);
+        rng.fill(img, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+        GaussianBlur(img, img, Size(7, 7), 0);
+        EXPECT_TRUE(imencode("." + ext, img, bufs[i]));
+    }
+    return bufs;
+}
+
+static const string batch_exts[] = {
+#ifdef HAVE_JPEG
+    "jpg",
+#endif
+#if defined(HAVE_PNG) || defined(HAVE_SPNG)
+    "png",
+#endif
+    "bmp",
+};
+
+typedef TestBaseWithParam<string> Decode_Batch;
+
+PERF_TEST_P(Decode_Batch, imdecode, testing::ValuesIn(batch_exts))
+{
+    const std::vector< vector<uchar> > bufs = getEncodedBatch(GetParam());
+    std::vector<Mat> images(bufs.size());
+
+    TEST_CYCLE()
+    {
+        for (size_t i = 0; i < bufs.size(); i++)
+            imdecode(bufs[i], IMREAD_COLOR, &images[i]);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Decode_Batch, imdecodeBatch, testing::ValuesIn(batch_exts))
+{
+    const std::vector< vector<uchar> > bufs = getEncodedBatch(GetParam());
+    std::vector<Mat> images;
+    std::vector<String> errors;
+    int decoded = 0;
+
+    TEST_CYCLE() decoded = imdecodeBatch(bufs, images, errors, IMREAD_COLOR);
+
+    ASSERT_EQ(BATCH_SIZE, decoded);
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Decode_Batch, imreadBatch, testing::ValuesIn(batch_exts))
+{
+    const std::vector< vector<uchar> > bufs = getEncodedBatch(GetParam());
+    std::vector<String> filenames;
+    for (size_t i = 0; i < bufs.size(); i++)
+    {
+        filenames.push_back(cv::tempfile(("." + GetParam()).c_str()));
+        std::ofstream f(filenames.back().c_str(), std::ios::binary);
+        f.write((const char*)&bufs[i][0], bufs[i].size());
+    }
+    std::vector<Mat> images;
+    std::vector<String> errors;
+    int decoded = 0;
+
+    TEST_CYCLE() decoded = imreadBatch(filenames, images, errors, IMREAD_COLOR);
+
+    EXPECT_EQ(BATCH_SIZE, decoded);
+    for (size_t i = 0; i < filenames.size(); i++)
+        EXPECT_EQ(0, remove(filenames[i].c_str()));
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
@@ -0,0 +1,94 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+#include "perf_precomp.hpp"
+
+namespace opencv_test
+{
+
+using namespace perf;
+
+static const vector<uchar>& getEncodedPhoto(const string& ext)
+{
+    static std::map<string, vector<uchar> > cache;
+    vector<uchar>& buf = cache[ext];
+    if (buf.empty())
+    {
+        // 12 megapixel "photo": smooth noise
+        Mat img(3000, 4000, CV_8UC3);
+        RNG rng(12345);
+        rng.fill(img, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+        GaussianBlur(img, img, Size(9, 9), 0);
+        EXPECT_TRUE(imencode("." + ext, img, buf));
+    }
+    return buf;
+}
+
+static const string decode_resized_exts[] = {
+#ifdef HAVE_JPEG
+    "jpg",
+#endif
+#if defined(HAVE_PNG) || defined(HAVE_SPNG)
+    "png",
+#endif
+#ifdef HAVE_TIFF
+    "tiff",
+#endif
+#ifdef HAVE_WEBP
+    "webp",
+#endif
+};
+
+typedef TestBaseWithParam<string> Decode_Thumbnail;
+
+PERF_TEST_P(Decode_Thumbnail, imdecode_and_resize, testing::ValuesIn(decode_resized_exts))
+{
+    const vector<uchar>& buf = getEncodedPhoto(GetParam());
+    Mat dst;
+
+    TEST_CYCLE()
+    {
+        Mat img = imdecode(buf, IMREAD_COLOR);
+        resize(img, dst, Size(256, 192), 0, 0, INTER_AREA);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Decode_Thumbnail, imdecodeResized, testing::ValuesIn(decode_resized_exts))
+{
+    const vector<uchar>& buf = getEncodedPhoto(GetParam());
+    Mat dst;
+
+    TEST_CYCLE() dst = imdecodeResized(buf, 256, IMREAD_COLOR);
+
+    ASSERT_EQ(Size(256, 192), dst.size());
+    SANITY_CHECK_NOTHING();
+}
+
+typedef TestBaseWithParam<string> Decode_ROI;
+
+PERF_TEST_P(Decode_ROI, imdecode_and_crop, testing::ValuesIn(decode_resized_exts))
+{
+    const vector<uchar>& buf = getEncodedPhoto(GetParam());
+    const Rect roi(1500, 1000, 512, 512);
+    Mat dst;
+
+    TEST_CYCLE() dst = imdecode(buf, IMREAD_COLOR)(roi).clone();
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Decode_ROI, imdecodeROI, testing::ValuesIn(decode_resized_exts))
+{
+    const vector<uchar>& buf = getEncodedPhoto(GetParam());
+    const Rect roi(1500, 1000, 512, 512);
+    Mat dst;
+
+    TEST_CYCLE() dst = imdecodeROI(buf, roi, IMREAD_COLOR);
+
+    ASSERT_EQ(roi.size(), dst.size());
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
@@ -94,6 +94,16 @@ int BaseImageDecoder::setScale( const int& scale_denom )
     return temp;
 }
 
+bool BaseImageDecoder::setTargetSize( const Size& /*size*/ )
+{
+    return false;
+}
+
+bool BaseImageDecoder::setRegion( const Rect& /*roi*/ )
+{
+    return false;
+}
+
 ImageDecoder BaseImageDecoder::newDecoder() const
 {
     return ImageDecoder();
@@ -71,6 +71,18 @@ public:
     virtual bool setSource( const Mat& buf );
     virtual int setScale( const int& scale_denom );
     virtual bool readHeader() = 0;
+
+    /** Requests a downscaled image which is not smaller than size, should be called after readHeader().
+        The decoder picks the nearest scale it supports natively and updates width() and height().
+        Returns false if the image is decoded in the original size. */
+    virtual bool setTargetSize( const Size& size );
+
+    /** Requests decoding of the region of the image only, should be called after readHeader().
+        The next readData() call fills img of the region size, width() and height() are updated.
+        The region may be changed after readData() to read the next part of the image; sequential
+        decoders accept only the regions which are below the already decoded rows.
+        Returns false if the decoder can't decode the region, the whole image should be read then. */
+    virtual bool setRegion( const Rect& roi );
     virtual bool readData( Mat& img ) = 0;
 
     /// Called after readData to advance to the next page, if any.
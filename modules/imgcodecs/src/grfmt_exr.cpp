@@ -62,10 +62,12 @@
 #include <ImfFrameBuffer.h>
 #include <ImfHeader.h>
 #include <ImfInputFile.h>
+#include <ImfIO.h>
 #include <ImfOutputFile.h>
 #include <ImfChannelList.h>
 #include <ImfStandardAttributes.h>
 #include <half.h>
+#include <Iex.h>
 #include "grfmt_exr.hpp"
 #include "OpenEXRConfig.h"
 
@@ -104,12 +106,90 @@ static void initOpenEXR()
     }
 }
 
+#if OPENEXR_VERSION_MAJOR >= 3
+typedef uint64_t ExrStreamPos;
+#else
+typedef Imf::Int64 ExrStreamPos;
+#endif
+
+// reads the encoded image directly from the buffer passed to imdecode()
+class ExrMemoryIStream CV_FINAL : public IStream
+{
+public:
+    explicit ExrMemoryIStream(const Mat& buf) :
+        IStream("<memory>"), m_data((const char*)buf.ptr()), m_size(buf.total() * buf.elemSize()), m_pos(0)
+    {
+        CV_Assert(buf.isContinuous());
+    }
+
+    bool isMemoryMapped() const CV_OVERRIDE { return true; }
+
+    char* readMemoryMapped(int n) CV_OVERRIDE
+    {
+        checkAvailable(n);
+        char* data = const_cast<char*>(m_data) + m_pos;
+        m_pos += n;
+        return data;
+    }
+
+    bool read(char c[], int n) CV_OVERRIDE
+    {
+        checkAvailable(n);
+        memcpy(c, m_data + m_pos, n);
+        m_pos += n;
+        return m_pos < m_size;
+    }
+
+    ExrStreamPos tellg() CV_OVERRIDE { return m_pos; }
+    void seekg(ExrStreamPos pos) CV_OVERRIDE { m_pos = (size_t)pos; }
+
+private:
+    void checkAvailable(int n) const
+    {
+        if (n < 0 || m_pos > m_size || (size_t)n > m_size - m_pos)
+            throw Iex::InputExc("Unexpected end of file.");
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos;
+};
+
+// writes the encoded image to the buffer passed to imencode(), the line offset table is patched by seeking back
+class ExrMemoryOStream CV_FINAL : public OStream
+{
+public:
+    explicit ExrMemoryOStream(std::vector<uchar>& buf) :
+        OStream("<memory>"), m_buf(buf), m_pos(0)
+    {
+        m_buf.clear();
+    }
+
+    void write(const char c[], int n) CV_OVERRIDE
+    {
+        CV_Assert(n >= 0);
+        if (m_pos + n > m_buf.size())
+            m_buf.resize(m_pos + n);
+        memcpy(&m_buf[m_pos], c, n);
+        m_pos += n;
+    }
+
+    ExrStreamPos tellp() CV_OVERRIDE { return m_pos; }
+    void seekp(ExrStreamPos pos) CV_OVERRIDE { m_pos = (size_t)pos; }
+
+private:
+    std::vector<uchar>& m_buf;
+    size_t m_pos;
+};
+
 /////////////////////// ExrDecoder ///////////////////
 
 ExrDecoder::ExrDecoder()
 {
     m_signature = "\x76\x2f\x31\x01";
+    m_buf_supported = true;
     m_file = 0;
+    m_stream = 0;
     m_red = m_green = m_blue = m_alpha = 0;
     m_type = ((Imf::PixelType)0);
     m_iscolor = false;
@@ -135,6 +215,11 @@ void  ExrDecoder::close()
         delete m_file;
         m_file = 0;
     }
+    if( m_stream )
+    {
+        delete m_stream;
+        m_stream = 0;
+    }
 }
 
 
@@ -148,7 +233,13 @@ bool  ExrDecoder::readHeader()
 {
     bool result = false;
 
-    m_file = new InputFile( m_filename.c_str() );
+    if( !m_buf.empty() )
+    {
+        m_stream = new ExrMemoryIStream( m_buf );
+        m_file = new InputFile( *m_stream );
+    }
+    else
+        m_file = new InputFile( m_filename.c_str() );
 
     if( !m_file ) // probably paranoid
         return false;
@@ -611,6 +702,7 @@ ImageDecoder ExrDecoder::newDecoder() const
 ExrEncoder::ExrEncoder()
 {
     m_description = "OpenEXR Image files (*.exr)";
+    m_buf_supported = true;
 }
 
 
@@ -719,7 +811,16 @@ bool  ExrEncoder::write( const Mat& img, const std::vector<int>& params )
         header.channels().insert( "A", Channel( type ) );
     }
 
-    OutputFile file( m_filename.c_str(), header );
+    // the stream must outlive the file: the line offset table is written by the OutputFile destructor
+    Ptr<ExrMemoryOStream> stream;
+    Ptr<OutputFile> file;
+    if( m_buf )
+    {
+        stream.reset( new ExrMemoryOStream( *m_buf ) );
+        file.reset( new OutputFile( *stream, header ) );
+    }
+    else
+        file.reset( new OutputFile( m_filename.c_str(), header ) );
 
     FrameBuffer frame;
 
@@ -755,12 +856,12 @@ bool  ExrEncoder::write( const Mat& img, const std::vector<int>& params )
         frame.insert( "A", Slice( type, buffer + size * (channels - 1), size * channels, bufferstep ));
     }
 
-    file.setFrameBuffer( frame );
+    file->setFrameBuffer( frame );
 
     result = true;
     try
     {
-        file.writePixels( height );
+        file->writePixels( height );
     }
     catch(...)
     {
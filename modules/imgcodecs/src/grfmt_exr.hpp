@@ -86,6 +86,7 @@ protected:
     void  RGBToGray( float *in, float *out );
 
     InputFile      *m_file;
+    IStream        *m_stream;  // memory stream of m_buf, is used by m_file
     Imf::PixelType  m_type;
     Box2i           m_datawindow;
     bool            m_ischroma;
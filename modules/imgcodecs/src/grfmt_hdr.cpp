@@ -53,14 +53,19 @@ HdrDecoder::HdrDecoder()
 {
     m_signature = "#?RGBE";
     m_signature_alt = "#?RADIANCE";
-    file = NULL;
     m_type = CV_32FC3;
+    m_buf_supported = true;
 }
 
 HdrDecoder::~HdrDecoder()
 {
 }
 
+void HdrDecoder::close()
+{
+    m_strm.close();
+}
+
 size_t HdrDecoder::signatureLength() const
 {
     return m_signature.size() > m_signature_alt.size() ?
@@ -69,14 +74,16 @@ size_t HdrDecoder::signatureLength() const
 
 bool  HdrDecoder::readHeader()
 {
-    file = fopen(m_filename.c_str(), "rb");
-    if(!file) {
+    if (!m_buf.empty()) {
+        if (!m_strm.open(m_buf)) {
+            return false;
+        }
+    } else if (!m_strm.open(m_filename)) {
         return false;
     }
-    RGBE_ReadHeader(file, &m_width, &m_height, NULL);
+    RGBE_ReadHeader(m_strm, &m_width, &m_height, NULL);
     if(m_width <= 0 || m_height <= 0) {
-        fclose(file);
-        file = NULL;
+        close();
         return false;
     }
     return true;
@@ -85,13 +92,13 @@ bool  HdrDecoder::readHeader()
 bool HdrDecoder::readData(Mat& _img)
 {
     Mat img(m_height, m_width, CV_32FC3);
-    if(!file) {
+    if(!m_strm.isOpened()) {
         if(!readHeader()) {
             return false;
         }
     }
-    RGBE_ReadPixels_RLE(file, const_cast<float*>(img.ptr<float>()), img.cols, img.rows);
-    fclose(file); file = NULL;
+    RGBE_ReadPixels_RLE(m_strm, const_cast<float*>(img.ptr<float>()), img.cols, img.rows);
+    close();
 
     // NOTE: 'img' has type CV32FC3
     switch (_img.depth())
@@ -130,6 +137,7 @@ ImageDecoder HdrDecoder::newDecoder() const
 HdrEncoder::HdrEncoder()
 {
     m_description = "Radiance HDR (*.hdr;*.pic)";
+    m_buf_supported = true;
 }
 
 HdrEncoder::~HdrEncoder()
@@ -164,19 +172,24 @@ bool HdrEncoder::write( const Mat& input_img, const std::vector<int>& params )
     }
     CV_Check(compression, compression == IMWRITE_HDR_COMPRESSION_NONE || compression == IMWRITE_HDR_COMPRESSION_RLE, "");
 
-    FILE *fout = fopen(m_filename.c_str(), "wb");
-    if(!fout) {
+    WLByteStream strm;
+    if (m_buf) {
+        if (!strm.open(*m_buf)) {
+            return false;
+        }
+        m_buf->reserve(alignSize(256 + 4 * img.total(), 256));
+    } else if (!strm.open(m_filename)) {
         return false;
     }
 
-    RGBE_WriteHeader(fout, img.cols, img.rows, NULL);
+    RGBE_WriteHeader(strm, img.cols, img.rows, NULL);
     if (compression == IMWRITE_HDR_COMPRESSION_RLE) {
-        RGBE_WritePixels_RLE(fout, const_cast<float*>(img.ptr<float>()), img.cols, img.rows);
+        RGBE_WritePixels_RLE(strm, const_cast<float*>(img.ptr<float>()), img.cols, img.rows);
     } else {
-        RGBE_WritePixels(fout, const_cast<float*>(img.ptr<float>()), img.cols * img.rows);
+        RGBE_WritePixels(strm, const_cast<float*>(img.ptr<float>()), img.cols * img.rows);
     }
 
-    fclose(fout);
+    strm.close();
     return true;
 }
 
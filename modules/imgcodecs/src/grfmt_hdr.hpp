@@ -44,6 +44,7 @@
 #define _GRFMT_HDR_H_
 
 #include "grfmt_base.hpp"
+#include "bitstrm.hpp"
 
 #ifdef HAVE_IMGCODEC_HDR
 
@@ -61,9 +62,10 @@ public:
     bool checkSignature( const String& signature ) const CV_OVERRIDE;
     ImageDecoder newDecoder() const CV_OVERRIDE;
     size_t signatureLength() const CV_OVERRIDE;
+    void close();
 protected:
     String m_signature_alt;
-    FILE *file;
+    RLByteStream m_strm;
 };
 
 // ... writer
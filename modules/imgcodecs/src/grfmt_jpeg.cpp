@@ -108,6 +108,11 @@ struct JpegState
     jpeg_decompress_struct cinfo; // IJG JPEG codec structure
     JpegErrorMgr jerr; // error processing manager state
     JpegSource source; // memory buffer source
+
+    // the state of the region decoding (see JpegDecoder::setRegion)
+    bool started; // jpeg_start_decompress() has been called, the rows are read sequentially
+    JSAMPARRAY buffer; // one row of the (cropped) output
+    int crop_x; // position of the first output column in the image
 };
 
 /////////////////////// Error processing /////////////////////
@@ -224,6 +229,10 @@ bool  JpegDecoder::readHeader()
 
     JpegState* state = new JpegState;
     m_state = state;
+    state->started = false;
+    state->buffer = 0;
+    state->crop_x = 0;
+    m_region = Rect();
     state->cinfo.err = jpeg_std_error(&state->jerr.pub);
     state->jerr.pub.error_exit = error_exit;
 
@@ -249,6 +258,28 @@ bool  JpegDecoder::readHeader()
             jpeg_save_markers(&state->cinfo, APP1, 0xffff);
             jpeg_read_header( &state->cinfo, TRUE );
 
+            // Check for Exif marker APP1 (parsed here, so the orientation is known before decoding)
+            jpeg_saved_marker_ptr exif_marker = NULL;
+            jpeg_saved_marker_ptr cmarker = state->cinfo.marker_list;
+            while( cmarker && exif_marker == NULL )
+            {
+                if (cmarker->marker == APP1)
+                    exif_marker = cmarker;
+
+                cmarker = cmarker->next;
+            }
+
+            // Parse Exif data
+            if( exif_marker )
+            {
+                const std::streamsize offsetToTiffHeader = 6; //bytes from Exif size field to the first TIFF header
+
+                if (exif_marker->data_length > offsetToTiffHeader)
+                {
+                    m_exif.parseExif(exif_marker->data + offsetToTiffHeader, exif_marker->data_length - offsetToTiffHeader);
+                }
+            }
+
             state->cinfo.scale_num=1;
             state->cinfo.scale_denom = m_scale_denom;
             m_scale_denom=1; // trick! to know which decoder used scale_denom see imread_
@@ -263,6 +294,84 @@ bool  JpegDecoder::readHeader()
     return result;
 }
 
+bool  JpegDecoder::setTargetSize( const Size& size )
+{
+    if( !m_state || size.width <= 0 || size.height <= 0 )
+        return false;
+
+    JpegState* state = (JpegState*)m_state;
+    jpeg_decompress_struct& cinfo = state->cinfo;
+    // libjpeg-turbo scales by M/8 in IDCT; the old libjpeg supports 1/8, 1/4, 1/2 only
+    // and rounds the requested scale up to the nearest of them
+    int num = 8;
+    while( num > 1 &&
+           (int)divUp((size_t)cinfo.image_width * (num - 1), 8) >= size.width &&
+           (int)divUp((size_t)cinfo.image_height * (num - 1), 8) >= size.height )
+        num--;
+    if( num == 8 )
+        return false;
+
+    cinfo.scale_num = num;
+    cinfo.scale_denom = 8;
+    jpeg_calc_output_dimensions(&cinfo);
+    m_width = cinfo.output_width;
+    m_height = cinfo.output_height;
+    return true;
+}
+
+bool  JpegDecoder::setRegion( const Rect& roi )
+{
+    if( !m_state )
+        return false;
+
+    JpegState* state = (JpegState*)m_state;
+    jpeg_decompress_struct& cinfo = state->cinfo;
+    if( state->started )
+    {
+        // the rows are decoded sequentially and the output columns can't be changed
+        if( m_region.empty() || roi.x != m_region.x || roi.width != m_region.width ||
+            roi.y < (int)cinfo.output_scanline )
+            return false;
+        CV_Assert(roi.height > 0 && roi.y + roi.height <= (int)cinfo.output_height);
+    }
+    else
+    {
+        CV_Assert(!roi.empty() && (roi & Rect(0, 0, (int)cinfo.output_width, (int)cinfo.output_height)) == roi);
+    }
+
+    m_region = roi;
+    m_width = roi.width;
+    m_height = roi.height;
+    return true;
+}
+
+// converts the decoded row of the given color space to the BGR or grayscale one
+static void convertRow( J_COLOR_SPACE color_space, bool color, const uchar* src, uchar* dst, int width )
+{
+    switch( color_space )
+    {
+    case JCS_GRAYSCALE:
+        memcpy( dst, src, width );
+        break;
+    case JCS_RGB:
+        icvCvt_RGB2BGR_8u_C3R( src, 0, dst, 0, Size(width,1) );
+        break;
+    case JCS_CMYK:
+        if( color )
+            icvCvt_CMYK2BGR_8u_C4C3R( src, 0, dst, 0, Size(width,1) );
+        else
+            icvCvt_CMYK2Gray_8u_C4C1R( src, 0, dst, 0, Size(width,1) );
+        break;
+#ifdef JCS_EXTENSIONS
+    case JCS_EXT_BGR:
+        memcpy( dst, src, width*3 );
+        break;
+#endif
+    default:
+        CV_Error(Error::StsNotImplemented, "Unsupported JPEG output color space");
+    }
+}
+
 #ifdef CV_MANUAL_JPEG_STD_HUFF_TABLES
 /***************************************************************************
  * following code is for supporting MJPEG image files
@@ -469,28 +578,50 @@ bool  JpegDecoder::readData( Mat& img )
                 }
             }
 
-            // Check for Exif marker APP1
-            jpeg_saved_marker_ptr exif_marker = NULL;
-            jpeg_saved_marker_ptr cmarker = cinfo->marker_list;
-            while( cmarker && exif_marker == NULL )
-            {
-                if (cmarker->marker == APP1)
-                    exif_marker = cmarker;
-
-                cmarker = cmarker->next;
-            }
 
-            // Parse Exif data
-            if( exif_marker )
+            if( !m_region.empty() )
             {
-                const std::streamsize offsetToTiffHeader = 6; //bytes from Exif size field to the first TIFF header
+                JpegState* state = (JpegState*)m_state;
+                if( !state->started )
+                {
+                    jpeg_start_decompress( cinfo );
+                    state->started = true;
+                    state->crop_x = 0;
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && LIBJPEG_TURBO_VERSION_NUMBER >= 1005000
+                    if( m_region.width < (int)cinfo->output_width )
+                    {
+                        // only the iMCU columns containing the region are decoded,
+                        // the first column may be moved to the left to the iMCU boundary
+                        JDIMENSION crop_x = (JDIMENSION)m_region.x, crop_width = (JDIMENSION)m_region.width;
+                        jpeg_crop_scanline( cinfo, &crop_x, &crop_width );
+                        state->crop_x = (int)crop_x;
+                    }
+#endif
+                    state->buffer = (*cinfo->mem->alloc_sarray)((j_common_ptr)cinfo,
+                                                                 JPOOL_IMAGE, cinfo->output_width*4, 1 );
+                }
 
-                if (exif_marker->data_length > offsetToTiffHeader)
+                JDIMENSION skip = (JDIMENSION)m_region.y - cinfo->output_scanline;
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && LIBJPEG_TURBO_VERSION_NUMBER >= 1005000
+                if( skip > 0 )
+                    jpeg_skip_scanlines( cinfo, skip );
+#else
+                for( ; skip > 0; skip-- )
+                    jpeg_read_scanlines( cinfo, state->buffer, 1 );
+#endif
+
+                const uchar* src = state->buffer[0] + (m_region.x - state->crop_x) * cinfo->out_color_components;
+                for( int iy = 0 ; iy < m_height; iy ++ )
                 {
-                    m_exif.parseExif(exif_marker->data + offsetToTiffHeader, exif_marker->data_length - offsetToTiffHeader);
+                    jpeg_read_scanlines( cinfo, state->buffer, 1 );
+                    convertRow( cinfo->out_color_space, color, src, img.ptr<uchar>(iy), m_width );
                 }
-            }
 
+                // the decoder is kept running for the next region until the last row is read
+                if( cinfo->output_scanline == cinfo->output_height )
+                    jpeg_finish_decompress( cinfo );
+                return true;
+            }
 
             jpeg_start_decompress( cinfo );
 
@@ -81,6 +81,8 @@ public:
 
     bool  readData( Mat& img ) CV_OVERRIDE;
     bool  readHeader() CV_OVERRIDE;
+    bool  setTargetSize( const Size& size ) CV_OVERRIDE;
+    bool  setRegion( const Rect& roi ) CV_OVERRIDE;
     void  close();
 
     ImageDecoder newDecoder() const CV_OVERRIDE;
@@ -89,6 +91,7 @@ protected:
 
     FILE* m_f;
     void* m_state;
+    Rect m_region; // the part of the image to read, empty if the whole image is read (see setRegion)
 
 private:
     JpegDecoder(const JpegDecoder &); // copy disabled
@@ -82,6 +82,7 @@ PFMDecoder::~PFMDecoder()
 PFMDecoder::PFMDecoder() : m_scale_factor(0), m_swap_byte_order(false)
 {
   m_strm.close();
+  m_buf_supported = true;
 }
 
 bool PFMDecoder::readHeader()
@@ -169,7 +170,7 @@ bool PFMDecoder::checkSignature( const String& signature ) const
 
 void PFMDecoder::close()
 {
-  // noop
+  m_strm.close();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -177,6 +178,7 @@ void PFMDecoder::close()
 PFMEncoder::PFMEncoder()
 {
   m_description = "Portable image format - float (*.pfm)";
+  m_buf_supported = true;
 }
 
 PFMEncoder::~PFMEncoder()
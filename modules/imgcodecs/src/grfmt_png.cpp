@@ -88,6 +88,8 @@ PngDecoder::PngDecoder()
     m_buf_supported = true;
     m_buf_pos = 0;
     m_bit_depth = 0;
+    m_decimation = 1;
+    m_next_row = -1;
 }
 
 
@@ -117,6 +119,9 @@ void  PngDecoder::close()
         png_destroy_read_struct( &png_ptr, &info_ptr, &end_info );
         m_png_ptr = m_info_ptr = m_end_info = 0;
     }
+    m_decimation = 1;
+    m_region = Rect();
+    m_next_row = -1;
 }
 
 
@@ -182,6 +187,17 @@ bool  PngDecoder::readHeader()
                     m_color_type = color_type;
                     m_bit_depth = bit_depth;
 
+#ifdef PNG_eXIf_SUPPORTED
+                    // eXIf before the image data is available now, so the orientation is known
+                    // with the header (the one after the image data is parsed by readData())
+                    png_uint_32 num_exif = 0;
+                    png_bytep exif = 0;
+                    if( png_get_valid(png_ptr, info_ptr, PNG_INFO_eXIf) )
+                        png_get_eXIf_1(png_ptr, info_ptr, &num_exif, &exif);
+                    if( exif && num_exif > 0 )
+                        m_exif.parseExif(exif, num_exif);
+#endif
+
                     if( bit_depth <= 8 || bit_depth == 16 )
                     {
                         switch(color_type)
@@ -214,6 +230,43 @@ bool  PngDecoder::readHeader()
 }
 
 
+bool  PngDecoder::setTargetSize( const Size& size )
+{
+    png_structp png_ptr = (png_structp)m_png_ptr;
+    png_infop info_ptr = (png_infop)m_info_ptr;
+    // interlaced images are combined from several passes, so the rows can't be decimated one by one
+    if( !png_ptr || !info_ptr || m_decimation != 1 || !m_region.empty() ||
+        png_get_interlace_type( png_ptr, info_ptr ) != PNG_INTERLACE_NONE )
+        return false;
+
+    int factor = calcDecimationFactor( Size(m_width, m_height), size );
+    if( factor <= 1 )
+        return false;
+
+    m_decimation = factor;
+    m_width = divUp( m_width, factor );
+    m_height = divUp( m_height, factor );
+    return true;
+}
+
+bool  PngDecoder::setRegion( const Rect& roi )
+{
+    png_structp png_ptr = (png_structp)m_png_ptr;
+    png_infop info_ptr = (png_infop)m_info_ptr;
+    // the rows are read one by one, so the rows above the already read ones can't be read
+    if( !png_ptr || !info_ptr || m_decimation != 1 || roi.y < m_next_row ||
+        png_get_interlace_type( png_ptr, info_ptr ) != PNG_INTERLACE_NONE )
+        return false;
+
+    Rect image_rect( 0, 0, (int)png_get_image_width( png_ptr, info_ptr ), (int)png_get_image_height( png_ptr, info_ptr ) );
+    CV_Assert( !roi.empty() && (roi & image_rect) == roi );
+
+    m_region = roi;
+    m_width = roi.width;
+    m_height = roi.height;
+    return true;
+}
+
 bool  PngDecoder::readData( Mat& img )
 {
     volatile bool result = false;
@@ -225,56 +278,103 @@ bool  PngDecoder::readData( Mat& img )
     png_infop info_ptr = (png_infop)m_info_ptr;
     png_infop end_info = (png_infop)m_end_info;
 
+    // allocated before setjmp(), which skips the destructors on errors
+    int src_width = m_width, src_height = m_height;
+    const bool readRows = m_decimation > 1 || !m_region.empty();
+    if( readRows && png_ptr && info_ptr )
+    {
+        src_width = (int)png_get_image_width( png_ptr, info_ptr );
+        src_height = (int)png_get_image_height( png_ptr, info_ptr );
+    }
+    AutoBuffer<uchar> _row( readRows ? (size_t)src_width * img.elemSize() : 0 );
+    Ptr<RowDecimator> decimator;
+    if( m_decimation > 1 )
+        decimator.reset( new RowDecimator( img, src_width, src_height, m_decimation ) );
+
     if( m_png_ptr && m_info_ptr && m_end_info && m_width && m_height )
     {
         if( setjmp( png_jmpbuf ( png_ptr ) ) == 0 )
         {
             int y;
 
-            if( img.depth() == CV_8U && m_bit_depth == 16 )
-                png_set_strip_16( png_ptr );
-            else if( !isBigEndian() )
-                png_set_swap( png_ptr );
-
-            if(img.channels() < 4)
+            // the transformations are set once, the reading of the next region continues from m_next_row
+            if( m_next_row < 0 )
             {
-                /* observation: png_read_image() writes 400 bytes beyond
-                 * end of data when reading a 400x118 color png
-                 * "mpplus_sand.png".  OpenCV crashes even with demo
-                 * programs.  Looking at the loaded image I'd say we get 4
-                 * bytes per pixel instead of 3 bytes per pixel.  Test
-                 * indicate that it is a good idea to always ask for
-                 * stripping alpha..  18.11.2004 Axel Walthelm
-                 */
-                 png_set_strip_alpha( png_ptr );
-            } else
-                png_set_tRNS_to_alpha( png_ptr );
-
-            if( m_color_type == PNG_COLOR_TYPE_PALETTE )
-                png_set_palette_to_rgb( png_ptr );
-
-            if( (m_color_type & PNG_COLOR_MASK_COLOR) == 0 && m_bit_depth < 8 )
+                if( img.depth() == CV_8U && m_bit_depth == 16 )
+                    png_set_strip_16( png_ptr );
+                else if( !isBigEndian() )
+                    png_set_swap( png_ptr );
+
+                if(img.channels() < 4)
+                {
+                    /* observation: png_read_image() writes 400 bytes beyond
+                     * end of data when reading a 400x118 color png
+                     * "mpplus_sand.png".  OpenCV crashes even with demo
+                     * programs.  Looking at the loaded image I'd say we get 4
+                     * bytes per pixel instead of 3 bytes per pixel.  Test
+                     * indicate that it is a good idea to always ask for
+                     * stripping alpha..  18.11.2004 Axel Walthelm
+                     */
+                     png_set_strip_alpha( png_ptr );
+                } else
+                    png_set_tRNS_to_alpha( png_ptr );
+
+                if( m_color_type == PNG_COLOR_TYPE_PALETTE )
+                    png_set_palette_to_rgb( png_ptr );
+
+                if( (m_color_type & PNG_COLOR_MASK_COLOR) == 0 && m_bit_depth < 8 )
 #if (PNG_LIBPNG_VER_MAJOR*10000 + PNG_LIBPNG_VER_MINOR*100 + PNG_LIBPNG_VER_RELEASE >= 10209) || \
     (PNG_LIBPNG_VER_MAJOR == 1 && PNG_LIBPNG_VER_MINOR == 0 && PNG_LIBPNG_VER_RELEASE >= 18)
-                png_set_expand_gray_1_2_4_to_8( png_ptr );
+                    png_set_expand_gray_1_2_4_to_8( png_ptr );
 #else
-                png_set_gray_1_2_4_to_8( png_ptr );
+                    png_set_gray_1_2_4_to_8( png_ptr );
 #endif
 
-            if( (m_color_type & PNG_COLOR_MASK_COLOR) && color )
-                png_set_bgr( png_ptr ); // convert RGB to BGR
-            else if( color )
-                png_set_gray_to_rgb( png_ptr ); // Gray->RGB
+                if( (m_color_type & PNG_COLOR_MASK_COLOR) && color )
+                    png_set_bgr( png_ptr ); // convert RGB to BGR
+                else if( color )
+                    png_set_gray_to_rgb( png_ptr ); // Gray->RGB
+                else
+                    png_set_rgb_to_gray( png_ptr, 1, 0.299, 0.587 ); // RGB->Gray
+
+                png_set_interlace_handling( png_ptr );
+                png_read_update_info( png_ptr, info_ptr );
+                m_next_row = 0;
+            }
+
+            if( decimator )
+            {
+                // read the full resolution rows one by one and downscale them on the fly
+                for( y = 0; y < src_height; y++ )
+                {
+                    png_read_row( png_ptr, _row.data(), NULL );
+                    decimator->push( _row.data() );
+                }
+                m_next_row = src_height;
+            }
+            else if( !m_region.empty() )
+            {
+                // read the rows one by one up to the bottom of the region, the columns of the region are copied
+                const size_t esz = img.elemSize();
+                for( ; m_next_row < m_region.y + m_region.height; m_next_row++ )
+                {
+                    png_read_row( png_ptr, _row.data(), NULL );
+                    if( m_next_row >= m_region.y )
+                        memcpy( img.ptr(m_next_row - m_region.y), _row.data() + m_region.x*esz, m_region.width*esz );
+                }
+            }
             else
-                png_set_rgb_to_gray( png_ptr, 1, 0.299, 0.587 ); // RGB->Gray
+            {
+                for( y = 0; y < m_height; y++ )
+                    buffer[y] = img.data + y*img.step;
 
-            png_set_interlace_handling( png_ptr );
-            png_read_update_info( png_ptr, info_ptr );
+                png_read_image( png_ptr, buffer );
+                m_next_row = m_height;
+            }
 
-            for( y = 0; y < m_height; y++ )
-                buffer[y] = img.data + y*img.step;
+            if( m_next_row < src_height )
+                return true; // the rest of the image may be read as the next region
 
-            png_read_image( png_ptr, buffer );
             png_read_end( png_ptr, end_info );
 
 #ifdef PNG_eXIf_SUPPORTED
@@ -60,6 +60,8 @@ public:
 
     bool  readData( Mat& img ) CV_OVERRIDE;
     bool  readHeader() CV_OVERRIDE;
+    bool  setTargetSize( const Size& size ) CV_OVERRIDE;
+    bool  setRegion( const Rect& roi ) CV_OVERRIDE;
     void  close();
 
     ImageDecoder newDecoder() const CV_OVERRIDE;
@@ -69,6 +71,9 @@ protected:
     static void readDataFromBuf(void* png_ptr, uchar* dst, size_t size);
 
     int   m_bit_depth;
+    int   m_decimation; // the image is downscaled by this factor while it is read (see setTargetSize)
+    Rect  m_region;     // the part of the image to read, empty if the whole image is read (see setRegion)
+    int   m_next_row;   // the next row of the image to read, -1 if the reading is not started
     void* m_png_ptr;  // pointer to decompression structure
     void* m_info_ptr; // pointer to image information structure
     void* m_end_info; // pointer to one more image information structure
@@ -60,6 +60,7 @@ SunRasterDecoder::SunRasterDecoder()
     m_encoding = RAS_STANDARD;
     m_maptype = RMT_NONE;
     m_maplength = 0;
+    m_buf_supported = true;
 }
 
 
@@ -82,7 +83,13 @@ bool  SunRasterDecoder::readHeader()
 {
     bool result = false;
 
-    if( !m_strm.open( m_filename )) return false;
+    if( !m_buf.empty() )
+    {
+        if( !m_strm.open( m_buf ) )
+            return false;
+    }
+    else if( !m_strm.open( m_filename ))
+        return false;
 
     try
     {
@@ -389,6 +396,7 @@ bad_decoding_end:
 SunRasterEncoder::SunRasterEncoder()
 {
     m_description = "Sun raster files (*.sr;*.ras)";
+    m_buf_supported = true;
 }
 
 
@@ -408,8 +416,10 @@ bool  SunRasterEncoder::write( const Mat& img, const std::vector<int>& )
     int fileStep = (width*channels + 1) & -2;
     WMByteStream  strm;
 
-    if( strm.open(m_filename) )
+    if( m_buf ? strm.open(*m_buf) : strm.open(m_filename) )
     {
+        if( m_buf )
+            m_buf->reserve( alignSize(32 + fileStep*height, 256) );
         strm.putBytes( fmtSignSunRas, (int)strlen(fmtSignSunRas) );
         strm.putDWord( width );
         strm.putDWord( height );
@@ -420,7 +430,11 @@ bool  SunRasterEncoder::write( const Mat& img, const std::vector<int>& )
         strm.putDWord( 0 );
 
         for( y = 0; y < height; y++ )
-            strm.putBytes( img.ptr(y), fileStep );
+        {
+            strm.putBytes( img.ptr(y), width*channels );
+            if( fileStep > width*channels )
+                strm.putByte( 0 );
+        }
 
         strm.close();
         result = true;
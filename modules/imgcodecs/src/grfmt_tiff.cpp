@@ -114,6 +114,7 @@ TiffDecoder::TiffDecoder()
     m_hdr = false;
     m_buf_supported = true;
     m_buf_pos = 0;
+    m_decimation = 1;
 }
 
 
@@ -279,6 +280,8 @@ bool TiffDecoder::readHeader()
 
             m_width = wdth;
             m_height = hght;
+            m_decimation = 1;
+            m_region = Rect();
             if (ncn == 3 && photometric == PHOTOMETRIC_LOGLUV)
             {
                 m_type = CV_32FC3;
@@ -583,6 +586,49 @@ static void _unpack14To16(const uchar* src, const uchar* srcEnd, ushort* dst, us
 }
 //end _unpack14To16()
 
+bool TiffDecoder::setTargetSize( const Size& size )
+{
+    TIFF* tif = static_cast<TIFF*>(m_tif.get());
+    // the strips are decoded and decimated one by one, so tiled and flipped images are not supported
+    if (!tif || m_hdr || m_decimation != 1 || !m_region.empty() || TIFFIsTiled(tif))
+        return false;
+    uint16_t img_orientation = ORIENTATION_TOPLEFT;
+    TIFFGetField(tif, TIFFTAG_ORIENTATION, &img_orientation);
+    if (img_orientation != ORIENTATION_TOPLEFT)
+        return false;
+
+    int factor = calcDecimationFactor(Size(m_width, m_height), size);
+    if (factor <= 1)
+        return false;
+
+    m_decimation = factor;
+    m_width = divUp(m_width, factor);
+    m_height = divUp(m_height, factor);
+    return true;
+}
+
+bool TiffDecoder::setRegion( const Rect& roi )
+{
+    TIFF* tif = static_cast<TIFF*>(m_tif.get());
+    // the region is cut from the decoded strips or tiles, so flipped images are not supported
+    if (!tif || m_decimation != 1)
+        return false;
+    uint16_t img_orientation = ORIENTATION_TOPLEFT;
+    TIFFGetField(tif, TIFFTAG_ORIENTATION, &img_orientation);
+    if (img_orientation != ORIENTATION_TOPLEFT)
+        return false;
+
+    uint32_t wdth = 0, hght = 0;
+    CV_TIFF_CHECK_CALL(TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &wdth));
+    CV_TIFF_CHECK_CALL(TIFFGetField(tif, TIFFTAG_IMAGELENGTH, &hght));
+    CV_Assert(!roi.empty() && (roi & Rect(0, 0, (int)wdth, (int)hght)) == roi);
+
+    m_region = roi;
+    m_width = roi.width;
+    m_height = roi.height;
+    return true;
+}
+
 bool  TiffDecoder::readData( Mat& img )
 {
     int type = img.type();
@@ -603,7 +649,18 @@ bool  TiffDecoder::readData( Mat& img )
 
     CV_CheckType(type, depth == CV_8U || depth == CV_8S || depth == CV_16U || depth == CV_16S || depth == CV_32S || depth == CV_32F || depth == CV_64F, "");
 
-    if (m_width && m_height)
+    // size of the decoded image, it is larger than img if the image is decimated or the region is read
+    int width = m_width, height = m_height;
+    if (m_decimation > 1 || !m_region.empty())
+    {
+        uint32_t wdth = 0, hght = 0;
+        CV_TIFF_CHECK_CALL(TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &wdth));
+        CV_TIFF_CHECK_CALL(TIFFGetField(tif, TIFFTAG_IMAGELENGTH, &hght));
+        width = (int)wdth;
+        height = (int)hght;
+    }
+
+    if (width && height)
     {
         int is_tiled = TIFFIsTiled(tif) != 0;
         bool isGrayScale = photometric == PHOTOMETRIC_MINISWHITE || photometric == PHOTOMETRIC_MINISBLACK;
@@ -624,7 +681,7 @@ bool  TiffDecoder::readData( Mat& img )
         int wanted_channels = normalizeChannelsNumber(img.channels());
         bool doReadScanline = false;
 
-        uint32_t tile_width0 = m_width, tile_height0 = 0;
+        uint32_t tile_width0 = width, tile_height0 = 0;
 
         if (is_tiled)
         {
@@ -639,11 +696,11 @@ bool  TiffDecoder::readData( Mat& img )
 
         {
             if (tile_width0 == 0)
-                tile_width0 = m_width;
+                tile_width0 = width;
 
             if (tile_height0 == 0 ||
                     (!is_tiled && tile_height0 == std::numeric_limits<uint32_t>::max()) )
-                tile_height0 = m_height;
+                tile_height0 = height;
 
             const int TILE_MAX_WIDTH = (1 << 24);
             const int TILE_MAX_HEIGHT = (1 << 24);
@@ -676,7 +733,7 @@ bool  TiffDecoder::readData( Mat& img )
                                      &&
                                      ( ( bpp == 8 ) || ( bpp == 16 ) )
                                      &&
-                                     (tile_height0 == (uint32_t) m_height) // single strip
+                                     (tile_height0 == (uint32_t) height) // single strip
                                      &&
                                      (
                                          (photometric == PHOTOMETRIC_MINISWHITE)
@@ -732,7 +789,7 @@ bool  TiffDecoder::readData( Mat& img )
                                      &&
                                      ( ( bpp == 8 ) || ( bpp == 16 ) )
                                      &&
-                                     (tile_height0 == (uint32_t) m_height) // single strip
+                                     (tile_height0 == (uint32_t) height) // single strip
                                      &&
                                      (
                                          (photometric == PHOTOMETRIC_MINISWHITE)
@@ -790,15 +847,43 @@ bool  TiffDecoder::readData( Mat& img )
             const int  convert_flag = MAKE_FLAG( ncn, wanted_channels );
             const bool isNeedConvert16to8 = ( doReadScanline ) && ( bpp == 16 ) && ( dst_bpp == 8);
 
-            for (int y = 0; y < m_height; y += (int)tile_height0)
+            // the decimated image and the region are decoded strip by strip (or by rows of tiles) into strip_img,
+            // only the strips and the tiles intersecting the region are read
+            Mat strip_img;
+            Ptr<RowDecimator> decimator;
+            int x_begin = 0, x_end = width, y_begin = 0, y_end = height;
+            if (m_decimation > 1)
+            {
+                CV_Assert(!is_tiled && !vert_flip);
+                strip_img.create((int)tile_height0, width, img.type());
+                decimator.reset(new RowDecimator(img, width, height, m_decimation));
+            }
+            else if (!m_region.empty())
+            {
+                CV_Assert(!vert_flip);
+                x_begin = m_region.x - m_region.x % (int)tile_width0;
+                x_end = std::min(width, divUp(m_region.x + m_region.width, (int)tile_width0) * (int)tile_width0);
+                y_begin = m_region.y - m_region.y % (int)tile_height0;
+                y_end = m_region.y + m_region.height;
+                strip_img.create((int)tile_height0, x_end - x_begin, img.type());
+            }
+            const int tiles_across = divUp(width, (int)tile_width0);
+
+            for (int y = y_begin; y < y_end; y += (int)tile_height0)
             {
-                int tile_height = std::min((int)tile_height0, m_height - y);
+                int tile_height = std::min((int)tile_height0, height - y);
 
-                const int img_y = vert_flip ? m_height - y - tile_height : y;
+                const int img_y = vert_flip ? height - y - tile_height : y;
 
-                for(int x = 0; x < m_width; x += (int)tile_width0, tileidx++)
+                // destination of the decoded rows and the position of its top-left corner in the image
+                Mat& tile_img = strip_img.empty() ? img : strip_img;
+                const int tile_img_y = strip_img.empty() ? 0 : y;
+                const int tile_img_x = x_begin;
+
+                tileidx = (y / (int)tile_height0) * tiles_across + x_begin / (int)tile_width0;
+                for(int x = x_begin; x < x_end; x += (int)tile_width0, tileidx++)
                 {
-                    int tile_width = std::min((int)tile_width0, m_width - x);
+                    int tile_width = std::min((int)tile_width0, width - x);
 
                     switch (dst_bpp)
                     {
@@ -838,7 +923,7 @@ bool  TiffDecoder::readData( Mat& img )
                                 bstart += (tile_height0 - tile_height) * tile_width0 * 4;
                             }
 
-                            uchar* img_line_buffer = (uchar*) img.ptr(y, 0);
+                            uchar* img_line_buffer = (uchar*) tile_img.ptr(y - tile_img_y, 0);
 
                             for (int i = 0; i < tile_height; i++)
                             {
@@ -901,14 +986,14 @@ bool  TiffDecoder::readData( Mat& img )
                                     if (wanted_channels == 4)
                                     {
                                         icvCvt_BGRA2RGBA_8u_C4R(bstart + i*tile_width0*4, 0,
-                                                img.ptr(img_y + tile_height - i - 1, x), 0,
+                                                tile_img.ptr(img_y - tile_img_y + tile_height - i - 1, x - tile_img_x), 0,
                                                 Size(tile_width, 1) );
                                     }
                                     else
                                     {
                                         CV_CheckEQ(wanted_channels, 3, "TIFF-8bpp: BGR/BGRA images are supported only");
                                         icvCvt_BGRA2BGR_8u_C4C3R(bstart + i*tile_width0*4, 0,
-                                                img.ptr(img_y + tile_height - i - 1, x), 0,
+                                                tile_img.ptr(img_y - tile_img_y + tile_height - i - 1, x - tile_img_x), 0,
                                                 Size(tile_width, 1), 2);
                                     }
                                 }
@@ -916,7 +1001,7 @@ bool  TiffDecoder::readData( Mat& img )
                                 {
                                     CV_CheckEQ(wanted_channels, 1, "");
                                     icvCvt_BGRA2Gray_8u_C4C1R( bstart + i*tile_width0*4, 0,
-                                            img.ptr(img_y + tile_height - i - 1, x), 0,
+                                            tile_img.ptr(img_y - tile_img_y + tile_height - i - 1, x - tile_img_x), 0,
                                             Size(tile_width, 1), 2);
                                 }
                             }
@@ -966,14 +1051,14 @@ bool  TiffDecoder::readData( Mat& img )
                                     {
                                         CV_CheckEQ(wanted_channels, 3, "");
                                         icvCvt_Gray2BGR_16u_C1C3R(buffer16, 0,
-                                                img.ptr<ushort>(img_y + i, x), 0,
+                                                tile_img.ptr<ushort>(img_y - tile_img_y + i, x - tile_img_x), 0,
                                                 Size(tile_width, 1));
                                     }
                                     else if (ncn == 3)
                                     {
                                         CV_CheckEQ(wanted_channels, 3, "");
                                         icvCvt_RGB2BGR_16u_C3R(buffer16, 0,
-                                                img.ptr<ushort>(img_y + i, x), 0,
+                                                tile_img.ptr<ushort>(img_y - tile_img_y + i, x - tile_img_x), 0,
                                                 Size(tile_width, 1));
                                     }
                                     else if (ncn == 4)
@@ -981,14 +1066,14 @@ bool  TiffDecoder::readData( Mat& img )
                                         if (wanted_channels == 4)
                                         {
                                             icvCvt_BGRA2RGBA_16u_C4R(buffer16, 0,
-                                                img.ptr<ushort>(img_y + i, x), 0,
+                                                tile_img.ptr<ushort>(img_y - tile_img_y + i, x - tile_img_x), 0,
                                                 Size(tile_width, 1));
                                         }
                                         else
                                         {
                                             CV_CheckEQ(wanted_channels, 3, "TIFF-16bpp: BGR/BGRA images are supported only");
                                             icvCvt_BGRA2BGR_16u_C4C3R(buffer16, 0,
-                                                img.ptr<ushort>(img_y + i, x), 0,
+                                                tile_img.ptr<ushort>(img_y - tile_img_y + i, x - tile_img_x), 0,
                                                 Size(tile_width, 1), 2);
                                         }
                                     }
@@ -1002,14 +1087,14 @@ bool  TiffDecoder::readData( Mat& img )
                                     CV_CheckEQ(wanted_channels, 1, "");
                                     if( ncn == 1 )
                                     {
-                                        memcpy(img.ptr<ushort>(img_y + i, x),
+                                        memcpy(tile_img.ptr<ushort>(img_y - tile_img_y + i, x - tile_img_x),
                                                buffer16,
                                                tile_width*sizeof(ushort));
                                     }
                                     else
                                     {
                                         icvCvt_BGRA2Gray_16u_CnC1R(buffer16, 0,
-                                                img.ptr<ushort>(img_y + i, x), 0,
+                                                tile_img.ptr<ushort>(img_y - tile_img_y + i, x - tile_img_x), 0,
                                                 Size(tile_width, 1), ncn, 2);
                                     }
                                 }
@@ -1031,13 +1116,13 @@ bool  TiffDecoder::readData( Mat& img )
 
                             Mat m_tile(Size(tile_width0, tile_height0), CV_MAKETYPE((dst_bpp == 32) ? (depth == CV_32S ? CV_32S : CV_32F) : CV_64F, ncn), src_buffer);
                             Rect roi_tile(0, 0, tile_width, tile_height);
-                            Rect roi_img(x, img_y, tile_width, tile_height);
+                            Rect roi_img(x - tile_img_x, img_y - tile_img_y, tile_width, tile_height);
                             if (!m_hdr && ncn == 3)
-                                extend_cvtColor(m_tile(roi_tile), img(roi_img), COLOR_RGB2BGR);
+                                extend_cvtColor(m_tile(roi_tile), tile_img(roi_img), COLOR_RGB2BGR);
                             else if (!m_hdr && ncn == 4)
-                                extend_cvtColor(m_tile(roi_tile), img(roi_img), COLOR_RGBA2BGRA);
+                                extend_cvtColor(m_tile(roi_tile), tile_img(roi_img), COLOR_RGBA2BGRA);
                             else
-                                m_tile(roi_tile).copyTo(img(roi_img));
+                                m_tile(roi_tile).copyTo(tile_img(roi_img));
                             break;
                         }
                         default:
@@ -1046,6 +1131,18 @@ bool  TiffDecoder::readData( Mat& img )
                         }
                     }  // switch (dst_bpp)
                 }  // for x
+
+                if (decimator)
+                {
+                    for (int i = 0; i < tile_height; i++)
+                        decimator->push(strip_img.ptr(i));
+                }
+                else if (!m_region.empty())
+                {
+                    int y0 = std::max(y, m_region.y), y1 = std::min(y + tile_height, y_end);
+                    strip_img(Rect(m_region.x - x_begin, y0 - y, m_region.width, y1 - y0))
+                        .copyTo(img.rowRange(y0 - m_region.y, y1 - m_region.y));
+                }
             }  // for y
         }
         if (bpp < dst_bpp)
@@ -98,6 +98,8 @@ public:
 
     bool  readHeader() CV_OVERRIDE;
     bool  readData( Mat& img ) CV_OVERRIDE;
+    bool  setTargetSize( const Size& size ) CV_OVERRIDE;
+    bool  setRegion( const Rect& roi ) CV_OVERRIDE;
     void  close();
     bool  nextPage() CV_OVERRIDE;
 
@@ -110,6 +112,8 @@ protected:
     int normalizeChannelsNumber(int channels) const;
     bool m_hdr;
     size_t m_buf_pos;
+    int m_decimation; // the image is downscaled by this factor while it is read (see setTargetSize)
+    Rect m_region; // the part of the image to read, empty if the whole image is read (see setRegion)
 
 private:
     TiffDecoder(const TiffDecoder &); // copy disabled
@@ -69,6 +69,7 @@ WebPDecoder::WebPDecoder()
     m_buf_supported = true;
     channels = 0;
     fs_size = 0;
+    use_scaling = false;
 }
 
 WebPDecoder::~WebPDecoder() {}
@@ -130,6 +131,7 @@ bool WebPDecoder::readHeader()
 
         m_width  = features.width;
         m_height = features.height;
+        use_scaling = false;
 
         if (features.has_alpha)
         {
@@ -148,6 +150,18 @@ bool WebPDecoder::readHeader()
     return false;
 }
 
+bool WebPDecoder::setTargetSize(const Size& size)
+{
+    // the scaler of libwebp produces the image of any size, but it doesn't enlarge the image
+    if (m_width <= 0 || m_height <= 0 || size.width <= 0 || size.height <= 0 ||
+        size.width >= m_width || size.height >= m_height)
+        return false;
+    m_width = size.width;
+    m_height = size.height;
+    use_scaling = true;
+    return true;
+}
+
 bool WebPDecoder::readData(Mat &img)
 {
     CV_CheckGE(m_width, 0, ""); CV_CheckGE(m_height, 0, "");
@@ -181,7 +195,24 @@ bool WebPDecoder::readData(Mat &img)
         size_t out_data_size = read_img.dataend - out_data;
 
         uchar *res_ptr = NULL;
-        if (channels == 3)
+        if (use_scaling)
+        {
+            CV_CheckTypeEQ(read_img.type(), channels == 3 ? CV_8UC3 : CV_8UC4, "");
+            WebPDecoderConfig config;
+            CV_Assert(WebPInitDecoderConfig(&config));
+            config.options.use_scaling = 1;
+            config.options.scaled_width = m_width;
+            config.options.scaled_height = m_height;
+            config.output.colorspace = channels == 3 ? MODE_BGR : MODE_BGRA;
+            config.output.is_external_memory = 1;
+            config.output.u.RGBA.rgba = out_data;
+            config.output.u.RGBA.stride = (int)read_img.step;
+            config.output.u.RGBA.size = out_data_size;
+            if (WebPDecode(data.ptr(), data.total(), &config) == VP8_STATUS_OK)
+                res_ptr = out_data;
+            WebPFreeDecBuffer(&config.output);
+        }
+        else if (channels == 3)
         {
             CV_CheckTypeEQ(read_img.type(), CV_8UC3, "");
             res_ptr = WebPDecodeBGRInto(data.ptr(), data.total(), out_data,
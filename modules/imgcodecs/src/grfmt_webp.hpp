@@ -61,6 +61,7 @@ public:
 
     bool readData( Mat& img ) CV_OVERRIDE;
     bool readHeader() CV_OVERRIDE;
+    bool setTargetSize( const Size& size ) CV_OVERRIDE;
 
     size_t signatureLength() const CV_OVERRIDE;
     bool checkSignature( const String& signature) const CV_OVERRIDE;
@@ -72,6 +73,7 @@ protected:
     size_t fs_size;
     Mat data;
     int channels;
+    bool use_scaling; // m_width x m_height is produced by the scaler of libwebp
 };
 
 class WebPEncoder CV_FINAL : public BaseImageEncoder
@@ -54,6 +54,7 @@
 #include <cerrno>
 #include <opencv2/core/utils/logger.hpp>
 #include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/tls.hpp>
 #include <opencv2/imgcodecs.hpp>
 
 
@@ -392,16 +393,107 @@ static void ApplyExifOrientation(ExifEntry_t orientationTag, OutputArray img)
     }
 }
 
+/// Requested size of the image loaded by imreadResized() / imdecodeResized()
+struct ImreadTargetSize
+{
+    Size dsize;   // components equal to 0 are computed from the aspect ratio
+    int maxSize;  // if maxSize > 0, it limits the longest side of the image instead of dsize
+};
+
+static bool isTransposedOrientation(const ImageDecoder& decoder, int flags)
+{
+    if ((flags & IMREAD_IGNORE_ORIENTATION) != 0 || flags == IMREAD_UNCHANGED)
+        return false;
+    ExifEntry_t orientationTag = decoder->getExifTag(ORIENTATION);
+    if (orientationTag.tag == INVALID_TAG)
+        return false;
+    const int orientation = orientationTag.field_u16;
+    return orientation == IMAGE_ORIENTATION_LT || orientation == IMAGE_ORIENTATION_RT ||
+           orientation == IMAGE_ORIENTATION_RB || orientation == IMAGE_ORIENTATION_LB;
+}
+
+/**
+ * Computes the size of the output image (with EXIF orientation applied)
+ *
+ * @param size size of the stored image
+ */
+static Size calcTargetSize(const ImageDecoder& decoder, int flags, Size size, const ImreadTargetSize& target)
+{
+    if (isTransposedOrientation(decoder, flags))
+        std::swap(size.width, size.height);
+
+    Size dsize = target.dsize;
+    if (target.maxSize > 0)
+    {
+        double scale = std::min(1., (double)target.maxSize / std::max(size.width, size.height));
+        dsize = Size(std::max(1, cvRound(size.width * scale)), std::max(1, cvRound(size.height * scale)));
+    }
+    else if (dsize.width == 0)
+        dsize.width = std::max(1, cvRound((double)size.width * dsize.height / size.height));
+    else if (dsize.height == 0)
+        dsize.height = std::max(1, cvRound((double)size.height * dsize.width / size.width));
+    return dsize;
+}
+
+/**
+ * Requests the decoder to produce the image close to the target size (after the header is read)
+ *
+ * EXIF orientation is taken into account if the decoder parses it with the header. The decoders
+ * which find it in the image data only (e.g. PNG with the eXIf chunk after the pixels) are asked
+ * for the stored size then, calcTargetSize() is called again after reading to get the final size.
+ */
+static void setDecoderTargetSize(const ImageDecoder& decoder, int flags, const ImreadTargetSize& target)
+{
+    Size size(decoder->width(), decoder->height());
+    Size dsize = calcTargetSize(decoder, flags, size, target);
+    const bool transposed = isTransposedOrientation(decoder, flags);
+    if (transposed)
+        std::swap(size.width, size.height);
+
+    if (dsize.width < size.width || dsize.height < size.height)
+    {
+        Size decode_size(std::min(dsize.width, size.width), std::min(dsize.height, size.height));
+        if (transposed)
+            std::swap(decode_size.width, decode_size.height);
+        decoder->setTargetSize(decode_size);
+    }
+}
+
+/**
+ * Requests the decoder to read the region of the image only (after the header is read)
+ *
+ * @return false if the decoder reads the whole image, the region should be cut out of it then
+ */
+static bool setDecoderRegion(const ImageDecoder& decoder, const Rect& roi)
+{
+    const Rect image_rect(0, 0, decoder->width(), decoder->height());
+    if (roi.empty() || (roi & image_rect) != roi)
+        CV_Error(Error::StsBadArg, cv::format("The region [%d x %d from (%d, %d)] is not inside the image [%d x %d]",
+                                              roi.width, roi.height, roi.x, roi.y, image_rect.width, image_rect.height));
+    return decoder->setRegion(roi);
+}
+
+/// Final resize of the image decoded by imreadResized() / imdecodeResized()
+static void resizeToTarget(Mat& mat, const Size& dsize)
+{
+    if (mat.empty() || mat.size() == dsize)
+        return;
+    const bool downscale = dsize.width <= mat.cols && dsize.height <= mat.rows;
+    resize(mat, mat, dsize, 0, 0, downscale ? INTER_AREA : INTER_LINEAR);
+}
+
 /**
  * Read an image into memory and return the information
  *
  * @param[in] filename File to load
  * @param[in] flags Flags
  * @param[in] mat Reference to C++ Mat object (If LOAD_MAT)
+ * @param[in] target Requested size of the image (optional)
+ * @param[in] roi Region of the image to read (optional), EXIF orientation is not applied then
  *
 */
 static bool
-imread_( const String& filename, int flags, OutputArray mat )
+imread_( const String& filename, int flags, OutputArray mat, const ImreadTargetSize* target = NULL, const Rect* roi = NULL )
 {
     /// Search for the relevant decoder to handle the imagery
     ImageDecoder decoder;
@@ -422,7 +514,7 @@ imread_( const String& filename, int flags, OutputArray mat )
     }
 
     int scale_denom = 1;
-    if( flags > IMREAD_LOAD_GDAL )
+    if( flags > IMREAD_LOAD_GDAL && !target && !roi )
     {
         if( flags & IMREAD_REDUCED_GRAYSCALE_2 )
             scale_denom = 2;
@@ -457,7 +549,16 @@ imread_( const String& filename, int flags, OutputArray mat )
 
 
     // established the required input image size
+    bool crop = false;
+    if (roi)
+        crop = !setDecoderRegion(decoder, *roi);
     Size size = validateInputImageSize(Size(decoder->width(), decoder->height()));
+    const Size stored_size = size;
+    if (target)
+    {
+        setDecoderTargetSize(decoder, flags, *target);
+        size = Size(decoder->width(), decoder->height());
+    }
 
     // grab the decoded type
     const int type = calcType(decoder->type(), flags);
@@ -499,17 +600,31 @@ imread_( const String& filename, int flags, OutputArray mat )
         return false;
     }
 
+    if (crop)
+    {
+        // the decoder has read the whole image
+        Mat region = real_mat(*roi).clone();
+        mat.assign(region);
+    }
+
     if( decoder->setScale( scale_denom ) > 1 ) // if decoder is JpegDecoder then decoder->setScale always returns 1
     {
         resize( mat, mat, Size( size.width / scale_denom, size.height / scale_denom ), 0, 0, INTER_LINEAR_EXACT);
     }
 
     /// optionally rotate the data if EXIF orientation flag says so
-    if (!mat.empty() && (flags & IMREAD_IGNORE_ORIENTATION) == 0 && flags != IMREAD_UNCHANGED )
+    if (!mat.empty() && !roi && (flags & IMREAD_IGNORE_ORIENTATION) == 0 && flags != IMREAD_UNCHANGED )
     {
         ApplyExifOrientation(decoder->getExifTag(ORIENTATION), mat);
     }
 
+    if (target)
+    {
+        Mat resized = mat.getMat();
+        resizeToTarget(resized, calcTargetSize(decoder, flags, stored_size, *target));
+        mat.assign(resized);
+    }
+
     return true;
 }
 
@@ -648,6 +763,38 @@ void imread( const String& filename, OutputArray dst, int flags )
     imread_(filename, flags, dst);
 }
 
+Mat imreadResized( const String& filename, Size dsize, int flags )
+{
+    CV_TRACE_FUNCTION();
+    CV_CheckGE(dsize.width, 0, ""); CV_CheckGE(dsize.height, 0, "");
+    CV_Check(dsize, dsize.width > 0 || dsize.height > 0, "Target size is not specified");
+
+    Mat img;
+    ImreadTargetSize target = { dsize, 0 };
+    imread_( filename, flags, img, &target );
+    return img;
+}
+
+Mat imreadResized( const String& filename, int maxSize, int flags )
+{
+    CV_TRACE_FUNCTION();
+    CV_CheckGT(maxSize, 0, "");
+
+    Mat img;
+    ImreadTargetSize target = { Size(), maxSize };
+    imread_( filename, flags, img, &target );
+    return img;
+}
+
+Mat imreadROI( const String& filename, const Rect& roi, int flags )
+{
+    CV_TRACE_FUNCTION();
+
+    Mat img;
+    imread_( filename, flags, img, NULL, &roi );
+    return img;
+}
+
 /**
 * Read a multi-page image
 *
@@ -804,22 +951,34 @@ bool imwrite( const String& filename, InputArray _img,
     return imwrite_(filename, img_vec, params, false);
 }
 
+/**
+ * Read an image from a buffer
+ *
+ * @param[in] buf Encoded image
+ * @param[in] flags Flags
+ * @param[in] mat Output image
+ * @param[in] target Requested size of the image (optional)
+ * @param[in] source File the buffer was read from (optional), it is used instead of a temporary file
+ *                   by the decoders which can't read from memory
+ * @param[in] roi Region of the image to read (optional), EXIF orientation is not applied then
+*/
 static bool
-imdecode_( const Mat& buf, int flags, Mat& mat )
+imdecode_( const Mat& buf, int flags, Mat& mat, const ImreadTargetSize* target = NULL, const String* source = NULL,
+           const Rect* roi = NULL )
 {
     CV_Assert(!buf.empty());
     CV_Assert(buf.isContinuous());
     CV_Assert(buf.checkVector(1, CV_8U) > 0);
     Mat buf_row = buf.reshape(1, 1);  // decoders expects single row, avoid issues with vector columns
 
-    String filename;
+    String filename;  // temporary file
 
     ImageDecoder decoder = findDecoder(buf_row);
     if( !decoder )
         return false;
 
     int scale_denom = 1;
-    if( flags > IMREAD_LOAD_GDAL )
+    if( flags > IMREAD_LOAD_GDAL && !target && !roi )
     {
         if( flags & IMREAD_REDUCED_GRAYSCALE_2 )
             scale_denom = 2;
@@ -834,21 +993,28 @@ imdecode_( const Mat& buf, int flags, Mat& mat )
 
     if( !decoder->setSource(buf_row) )
     {
-        filename = tempfile();
-        FILE* f = fopen( filename.c_str(), "wb" );
-        if( !f )
-            return false;
-        size_t bufSize = buf_row.total()*buf.elemSize();
-        if (fwrite(buf_row.ptr(), 1, bufSize, f) != bufSize)
+        if( source )
         {
-            fclose( f );
-            CV_Error( Error::StsError, "failed to write image data to temporary file" );
+            decoder->setSource(*source);
         }
-        if( fclose(f) != 0 )
+        else
         {
-            CV_Error( Error::StsError, "failed to write image data to temporary file" );
+            filename = tempfile();
+            FILE* f = fopen( filename.c_str(), "wb" );
+            if( !f )
+                return false;
+            size_t bufSize = buf_row.total()*buf.elemSize();
+            if (fwrite(buf_row.ptr(), 1, bufSize, f) != bufSize)
+            {
+                fclose( f );
+                CV_Error( Error::StsError, "failed to write image data to temporary file" );
+            }
+            if( fclose(f) != 0 )
+            {
+                CV_Error( Error::StsError, "failed to write image data to temporary file" );
+            }
+            decoder->setSource(filename);
         }
-        decoder->setSource(filename);
     }
 
     bool success = false;
@@ -879,7 +1045,27 @@ imdecode_( const Mat& buf, int flags, Mat& mat )
     }
 
     // established the required input image size
+    bool crop = false;
+    if (roi)
+    {
+        try
+        {
+            crop = !setDecoderRegion(decoder, *roi);
+        }
+        catch (...)
+        {
+            if (!filename.empty())
+                remove(filename.c_str());
+            throw;
+        }
+    }
     Size size = validateInputImageSize(Size(decoder->width(), decoder->height()));
+    const Size stored_size = size;
+    if (target)
+    {
+        setDecoderTargetSize(decoder, flags, *target);
+        size = Size(decoder->width(), decoder->height());
+    }
 
     const int type = calcType(decoder->type(), flags);
 
@@ -913,17 +1099,23 @@ imdecode_( const Mat& buf, int flags, Mat& mat )
         return false;
     }
 
+    if (crop)
+        mat = mat(*roi).clone(); // the decoder has read the whole image
+
     if( decoder->setScale( scale_denom ) > 1 ) // if decoder is JpegDecoder then decoder->setScale always returns 1
     {
         resize(mat, mat, Size( size.width / scale_denom, size.height / scale_denom ), 0, 0, INTER_LINEAR_EXACT);
     }
 
     /// optionally rotate the data if EXIF' orientation flag says so
-    if (!mat.empty() && (flags & IMREAD_IGNORE_ORIENTATION) == 0 && flags != IMREAD_UNCHANGED)
+    if (!mat.empty() && !roi && (flags & IMREAD_IGNORE_ORIENTATION) == 0 && flags != IMREAD_UNCHANGED)
     {
         ApplyExifOrientation(decoder->getExifTag(ORIENTATION), mat);
     }
 
+    if (target)
+        resizeToTarget(mat, calcTargetSize(decoder, flags, stored_size, *target));
+
     return true;
 }
 
@@ -951,6 +1143,163 @@ Mat imdecode( InputArray _buf, int flags, Mat* dst )
         return cv::Mat();
 }
 
+Mat imdecodeResized( InputArray _buf, Size dsize, int flags )
+{
+    CV_TRACE_FUNCTION();
+    CV_CheckGE(dsize.width, 0, ""); CV_CheckGE(dsize.height, 0, "");
+    CV_Check(dsize, dsize.width > 0 || dsize.height > 0, "Target size is not specified");
+
+    Mat buf = _buf.getMat(), img;
+    ImreadTargetSize target = { dsize, 0 };
+    if (!imdecode_(buf, flags, img, &target))
+        img.release();
+    return img;
+}
+
+Mat imdecodeResized( InputArray _buf, int maxSize, int flags )
+{
+    CV_TRACE_FUNCTION();
+    CV_CheckGT(maxSize, 0, "");
+
+    Mat buf = _buf.getMat(), img;
+    ImreadTargetSize target = { Size(), maxSize };
+    if (!imdecode_(buf, flags, img, &target))
+        img.release();
+    return img;
+}
+
+Mat imdecodeROI( InputArray _buf, const Rect& roi, int flags )
+{
+    CV_TRACE_FUNCTION();
+
+    Mat buf = _buf.getMat(), img;
+    if (!imdecode_(buf, flags, img, NULL, NULL, &roi))
+        img.release();
+    return img;
+}
+
+// reads the whole file, the buffer is reused
+static bool readFileToBuffer(const String& filename, std::vector<uchar>& data)
+{
+    std::ifstream f(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!f.is_open())
+        return false;
+    f.seekg(0, std::ios::end);
+    const std::streamoff len = f.tellg();  // 64-bit, unlike ftell() on some platforms
+    if (!f || len < 0 || (uint64_t)len > (uint64_t)std::numeric_limits<size_t>::max())
+        return false;
+    f.seekg(0, std::ios::beg);
+    data.resize((size_t)len);
+    if (len > 0)
+        f.read((char*)&data[0], (std::streamsize)len);
+    return !f.fail();
+}
+
+// decodes an image of a batch, returns the error message
+static String imdecodeBatchItem(const Mat& buf, const String* source, int flags, Mat& img)
+{
+    String error;
+    try
+    {
+        if (buf.empty())
+            error = "empty input";
+        else if (!imdecode_(buf, flags, img, NULL, source))
+            error = "can't decode the image: unsupported format or corrupted data";
+    }
+    catch (const std::exception& e)
+    {
+        error = e.what();
+    }
+    catch (...)
+    {
+        error = "unknown exception";
+    }
+    if (!error.empty())
+        img.release();
+    return error;
+}
+
+static int countDecoded(const std::vector<String>& errors)
+{
+    int count = 0;
+    for (size_t i = 0; i < errors.size(); i++)
+        count += errors[i].empty() ? 1 : 0;
+    return count;
+}
+
+int imreadBatch( const std::vector<String>& filenames, std::vector<Mat>& images,
+                 std::vector<String>& errors, int flags )
+{
+    CV_TRACE_FUNCTION();
+
+    const int n = (int)filenames.size();
+    images.resize(n);
+    errors.assign(n, String());
+
+    // every image is a separate task: the images of a batch may differ much in size,
+    // the file buffers are kept per thread
+    TLSData<std::vector<uchar> > buffers;
+    parallel_for_(Range(0, n), [&](const Range& range)
+    {
+        std::vector<uchar>& data = buffers.getRef();
+        for (int i = range.start; i < range.end; i++)
+        {
+            const String& filename = filenames[i];
+#ifdef HAVE_GDAL
+            if (flags != IMREAD_UNCHANGED && (flags & IMREAD_LOAD_GDAL) == IMREAD_LOAD_GDAL)
+            {
+                images[i].release();
+                try
+                {
+                    if (!imread_(filename, flags, images[i]))
+                        errors[i] = "can't read the image with GDAL";
+                }
+                catch (const std::exception& e)
+                {
+                    errors[i] = e.what();
+                }
+                catch (...)
+                {
+                    errors[i] = "unknown exception";
+                }
+                if (!errors[i].empty())
+                    images[i].release();
+                continue;
+            }
+#endif
+            if (!readFileToBuffer(filename, data))
+            {
+                images[i].release();
+                errors[i] = "can't open/read file: " + filename;
+                continue;
+            }
+            errors[i] = imdecodeBatchItem(Mat(data), &filename, flags, images[i]);
+        }
+    }, n);
+
+    return countDecoded(errors);
+}
+
+int imdecodeBatch( InputArrayOfArrays _bufs, std::vector<Mat>& images,
+                   std::vector<String>& errors, int flags )
+{
+    CV_TRACE_FUNCTION();
+
+    std::vector<Mat> bufs;
+    _bufs.getMatVector(bufs);
+    const int n = (int)bufs.size();
+    images.resize(n);
+    errors.assign(n, String());
+
+    parallel_for_(Range(0, n), [&](const Range& range)
+    {
+        for (int i = range.start; i < range.end; i++)
+            errors[i] = imdecodeBatchItem(bufs[i], NULL, flags, images[i]);
+    }, n);
+
+    return countDecoded(errors);
+}
+
 static bool
 imdecodemulti_(const Mat& buf, int flags, std::vector<Mat>& mats, int start, int count)
 {
@@ -1418,6 +1767,142 @@ ImageCollection::iterator ImageCollection::iterator::operator++(int) {
     return tmp;
 }
 
+/* ImageBandReader */
+
+class ImageBandReader::Impl {
+public:
+    bool open(const String& filename, int bandHeight, int flags);
+    bool read(OutputArray band);
+    void close();
+
+    Size m_size;
+    int m_type{-1};
+    int m_position{};
+
+private:
+    int m_bandHeight{};
+    bool m_bands{}; // the decoder reads the bands (see BaseImageDecoder::setRegion)
+    Mat m_image;    // the whole image, if the decoder can't read the bands
+    ImageDecoder m_decoder;
+};
+
+bool ImageBandReader::Impl::open(const String& filename, int bandHeight, int flags) {
+    CV_CheckGT(bandHeight, 0, "");
+    close();
+
+#ifdef HAVE_GDAL
+    if (flags != IMREAD_UNCHANGED && (flags & IMREAD_LOAD_GDAL) == IMREAD_LOAD_GDAL) {
+        m_decoder = GdalDecoder().newDecoder();
+    } else {
+#endif
+        m_decoder = findDecoder(filename);
+#ifdef HAVE_GDAL
+    }
+#endif
+
+    if (!m_decoder)
+        return false;
+
+    m_decoder->setSource(filename);
+    try {
+        if (!m_decoder->readHeader()) {
+            close();
+            return false;
+        }
+    }
+    catch (const cv::Exception& e) {
+        CV_LOG_ERROR(NULL, "ImageBandReader('" << filename << "'): can't read header: " << e.what());
+        close();
+        return false;
+    }
+    catch (...) {
+        CV_LOG_ERROR(NULL, "ImageBandReader('" << filename << "'): can't read header: unknown exception");
+        close();
+        return false;
+    }
+
+    m_size = Size(m_decoder->width(), m_decoder->height());
+    m_type = calcType(m_decoder->type(), flags);
+    m_bandHeight = bandHeight;
+    return true;
+}
+
+bool ImageBandReader::Impl::read(OutputArray band) {
+    if (!m_decoder || m_position >= m_size.height)
+        return false;
+
+    const Rect roi(0, m_position, m_size.width, std::min(m_bandHeight, m_size.height - m_position));
+    bool success = false;
+    try {
+        if (m_position == 0)
+            m_bands = m_decoder->setRegion(roi);
+        else if (m_bands)
+            CV_Assert(m_decoder->setRegion(roi));
+
+        if (m_bands) {
+            band.create(validateInputImageSize(roi.size()), m_type);
+            Mat mat = band.getMat();
+            success = m_decoder->readData(mat);
+        } else {
+            if (m_image.empty()) {
+                Mat image(validateInputImageSize(m_size), m_type);
+                if (m_decoder->readData(image))
+                    m_image = image;
+            }
+            if (!m_image.empty()) {
+                m_image(roi).copyTo(band);
+                success = true;
+            }
+        }
+    }
+    catch (const cv::Exception& e) {
+        CV_LOG_ERROR(NULL, "ImageBandReader: can't read data: " << e.what());
+    }
+    catch (...) {
+        CV_LOG_ERROR(NULL, "ImageBandReader: can't read data: unknown exception");
+    }
+
+    if (!success) {
+        m_decoder.release();
+        m_image.release();
+        return false;
+    }
+    m_position += roi.height;
+    if (m_position >= m_size.height) {
+        // the resources are released as soon as the last band is read
+        m_decoder.release();
+        m_image.release();
+    }
+    return true;
+}
+
+void ImageBandReader::Impl::close() {
+    m_decoder.release();
+    m_image.release();
+    m_size = Size();
+    m_type = -1;
+    m_position = 0;
+    m_bands = false;
+}
+
+ImageBandReader::ImageBandReader() : pImpl(new Impl()) {}
+
+ImageBandReader::ImageBandReader(const String& filename, int bandHeight, int flags) : pImpl(new Impl()) {
+    pImpl->open(filename, bandHeight, flags);
+}
+
+bool ImageBandReader::open(const String& filename, int bandHeight, int flags) { return pImpl->open(filename, bandHeight, flags); }
+
+bool ImageBandReader::isOpened() const { return !pImpl->m_size.empty(); }
+
+Size ImageBandReader::size() const { return pImpl->m_size; }
+
+int ImageBandReader::type() const { return pImpl->m_type; }
+
+int ImageBandReader::position() const { return pImpl->m_position; }
+
+bool ImageBandReader::read(OutputArray band) { return pImpl->read(band); }
+
 }
 
 /* End of file. */
@@ -58,7 +58,8 @@
 
 // Some opencv specific changes have been added:
 // inline define specified, error handler uses CV_Error,
-// defines changed to work in bgr color space.
+// defines changed to work in bgr color space,
+// the data is read and written with RLByteStream/WLByteStream instead of FILE.
 //
 // posted to http://www.graphics.cornell.edu/~bjw/
 // written by Bruce Walter  (bjw@graphics.cornell.edu)  5/26/95
@@ -101,6 +102,31 @@ static int rgbe_error(int rgbe_error_code, const char *msg)
   }
 }
 
+/* fgets() counterpart: reads a line including the '\n', returns NULL at the end of the stream */
+static char* rgbe_gets(char* buf, int size, cv::RLByteStream& strm)
+{
+  int i = 0;
+  try {
+    while (i < size - 1) {
+      int c = strm.getByte();
+      buf[i++] = (char)c;
+      if (c == '\n')
+        break;
+    }
+  }
+  catch (const cv::RBS_THROW_EOS_Exception&) {
+    if (i == 0)
+      return NULL;
+  }
+  buf[i] = 0;
+  return buf;
+}
+
+static void rgbe_puts(cv::WLByteStream& strm, const cv::String& str)
+{
+  strm.putBytes(str.c_str(), (int)str.size());
+}
+
 /* standard conversion from float pixels to rgbe pixels */
 /* note: you can remove the "inline"s if your compiler complains about it */
 static INLINE void
@@ -143,32 +169,27 @@ rgbe2float(float *red, float *green, float *blue, unsigned char rgbe[4])
 }
 
 /* default minimal header. modify if you want more information in header */
-int RGBE_WriteHeader(FILE *fp, int width, int height, rgbe_header_info *info)
+int RGBE_WriteHeader(cv::WLByteStream& strm, int width, int height, rgbe_header_info *info)
 {
   const char *programtype = "RADIANCE";
 
   if (info && (info->valid & RGBE_VALID_PROGRAMTYPE))
     programtype = info->programtype;
-  if (fprintf(fp,"#?%s\n",programtype) < 0)
-    return rgbe_error(rgbe_write_error,NULL);
+  rgbe_puts(strm, cv::format("#?%s\n",programtype));
   /* The #? is to identify file type, the programtype is optional. */
   if (info && (info->valid & RGBE_VALID_GAMMA)) {
-    if (fprintf(fp,"GAMMA=%g\n",info->gamma) < 0)
-      return rgbe_error(rgbe_write_error,NULL);
+    rgbe_puts(strm, cv::format("GAMMA=%g\n",info->gamma));
   }
   if (info && (info->valid & RGBE_VALID_EXPOSURE)) {
-    if (fprintf(fp,"EXPOSURE=%g\n",info->exposure) < 0)
-      return rgbe_error(rgbe_write_error,NULL);
+    rgbe_puts(strm, cv::format("EXPOSURE=%g\n",info->exposure));
   }
-  if (fprintf(fp,"FORMAT=32-bit_rle_rgbe\n\n") < 0)
-    return rgbe_error(rgbe_write_error,NULL);
-  if (fprintf(fp, "-Y %d +X %d\n", height, width) < 0)
-    return rgbe_error(rgbe_write_error,NULL);
+  rgbe_puts(strm, "FORMAT=32-bit_rle_rgbe\n\n");
+  rgbe_puts(strm, cv::format("-Y %d +X %d\n", height, width));
   return RGBE_RETURN_SUCCESS;
 }
 
 /* minimal header reading.  modify if you want to parse more information */
-int RGBE_ReadHeader(FILE *fp, int *width, int *height, rgbe_header_info *info)
+int RGBE_ReadHeader(cv::RLByteStream& strm, int *width, int *height, rgbe_header_info *info)
 {
   char buf[128];
   float tempf;
@@ -181,7 +202,7 @@ int RGBE_ReadHeader(FILE *fp, int *width, int *height, rgbe_header_info *info)
   }
 
   // 1. read first line
-  if (fgets(buf,sizeof(buf)/sizeof(buf[0]),fp) == NULL)
+  if (rgbe_gets(buf,sizeof(buf)/sizeof(buf[0]),strm) == NULL)
     return rgbe_error(rgbe_read_error,NULL);
   if ((buf[0] != '#')||(buf[1] != '?')) {
     /* if you want to require the magic token then uncomment the next line */
@@ -200,7 +221,7 @@ int RGBE_ReadHeader(FILE *fp, int *width, int *height, rgbe_header_info *info)
   // 2. reading other header lines
   bool hasFormat = false;
   for(;;) {
-    if (fgets(buf,sizeof(buf)/sizeof(buf[0]),fp) == 0)
+    if (rgbe_gets(buf,sizeof(buf)/sizeof(buf[0]),strm) == 0)
       return rgbe_error(rgbe_read_error,NULL);
     if (buf[0] == '\n') // end of the header
       break;
@@ -224,7 +245,7 @@ int RGBE_ReadHeader(FILE *fp, int *width, int *height, rgbe_header_info *info)
       return rgbe_error(rgbe_format_error, "missing FORMAT specifier");
 
   // 3. reading resolution string
-  if (fgets(buf,sizeof(buf)/sizeof(buf[0]),fp) == 0)
+  if (rgbe_gets(buf,sizeof(buf)/sizeof(buf[0]),strm) == 0)
     return rgbe_error(rgbe_read_error,NULL);
   if (sscanf(buf,"-Y %d +X %d",height,width) < 2)
     return rgbe_error(rgbe_format_error,"missing image size specifier");
@@ -234,7 +255,7 @@ int RGBE_ReadHeader(FILE *fp, int *width, int *height, rgbe_header_info *info)
 /* simple write routine that does not use run length encoding */
 /* These routines can be made faster by allocating a larger buffer and
    fread-ing and fwrite-ing the data in larger chunks */
-int RGBE_WritePixels(FILE *fp, float *data, int numpixels)
+int RGBE_WritePixels(cv::WLByteStream& strm, float *data, int numpixels)
 {
   unsigned char rgbe[4];
 
@@ -242,19 +263,18 @@ int RGBE_WritePixels(FILE *fp, float *data, int numpixels)
     float2rgbe(rgbe,data[RGBE_DATA_RED],
          data[RGBE_DATA_GREEN],data[RGBE_DATA_BLUE]);
     data += RGBE_DATA_SIZE;
-    if (fwrite(rgbe, sizeof(rgbe), 1, fp) < 1)
-      return rgbe_error(rgbe_write_error,NULL);
+    strm.putBytes(rgbe, (int)sizeof(rgbe));
   }
   return RGBE_RETURN_SUCCESS;
 }
 
 /* simple read routine.  will not correctly handle run length encoding */
-int RGBE_ReadPixels(FILE *fp, float *data, int numpixels)
+int RGBE_ReadPixels(cv::RLByteStream& strm, float *data, int numpixels)
 {
   unsigned char rgbe[4];
 
   while(numpixels-- > 0) {
-    if (fread(rgbe, sizeof(rgbe), 1, fp) < 1)
+    if (strm.getBytes(rgbe, sizeof(rgbe)) < (int)sizeof(rgbe))
       return rgbe_error(rgbe_read_error,NULL);
     rgbe2float(&data[RGBE_DATA_RED],&data[RGBE_DATA_GREEN],
          &data[RGBE_DATA_BLUE],rgbe);
@@ -268,7 +288,7 @@ int RGBE_ReadPixels(FILE *fp, float *data, int numpixels)
 /* save some space.  For each scanline, each channel (r,g,b,e) is */
 /* encoded separately for better compression. */
 
-static int RGBE_WriteBytes_RLE(FILE *fp, unsigned char *data, int numbytes)
+static int RGBE_WriteBytes_RLE(cv::WLByteStream& strm, unsigned char *data, int numbytes)
 {
 #define MINRUNLENGTH 4
   int cur, beg_run, run_count, old_run_count, nonrun_count;
@@ -291,8 +311,7 @@ static int RGBE_WriteBytes_RLE(FILE *fp, unsigned char *data, int numbytes)
     if ((old_run_count > 1)&&(old_run_count == beg_run - cur)) {
       buf[0] = static_cast<unsigned char>(128 + old_run_count);   /*write short run*/
       buf[1] = data[cur];
-      if (fwrite(buf,sizeof(buf[0])*2,1,fp) < 1)
-  return rgbe_error(rgbe_write_error,NULL);
+      strm.putBytes(buf,2);
       cur = beg_run;
     }
     /* write out bytes until we reach the start of the next run */
@@ -301,18 +320,15 @@ static int RGBE_WriteBytes_RLE(FILE *fp, unsigned char *data, int numbytes)
       if (nonrun_count > 128)
   nonrun_count = 128;
       buf[0] = static_cast<unsigned char>(nonrun_count);
-      if (fwrite(buf,sizeof(buf[0]),1,fp) < 1)
-  return rgbe_error(rgbe_write_error,NULL);
-      if (fwrite(&data[cur],sizeof(data[0])*nonrun_count,1,fp) < 1)
-  return rgbe_error(rgbe_write_error,NULL);
+      strm.putBytes(buf,1);
+      strm.putBytes(&data[cur],nonrun_count);
       cur += nonrun_count;
     }
     /* write out next run if one was found */
     if (run_count >= MINRUNLENGTH) {
       buf[0] = static_cast<unsigned char>(128 + run_count);
       buf[1] = data[beg_run];
-      if (fwrite(buf,sizeof(buf[0])*2,1,fp) < 1)
-  return rgbe_error(rgbe_write_error,NULL);
+      strm.putBytes(buf,2);
       cur += run_count;
     }
   }
@@ -320,7 +336,7 @@ static int RGBE_WriteBytes_RLE(FILE *fp, unsigned char *data, int numbytes)
 #undef MINRUNLENGTH
 }
 
-int RGBE_WritePixels_RLE(FILE *fp, float *data, int scanline_width,
+int RGBE_WritePixels_RLE(cv::WLByteStream& strm, float *data, int scanline_width,
        int num_scanlines)
 {
   unsigned char rgbe[4];
@@ -329,20 +345,17 @@ int RGBE_WritePixels_RLE(FILE *fp, float *data, int scanline_width,
 
   if ((scanline_width < 8)||(scanline_width > 0x7fff))
     /* run length encoding is not allowed so write flat*/
-    return RGBE_WritePixels(fp,data,scanline_width*num_scanlines);
+    return RGBE_WritePixels(strm,data,scanline_width*num_scanlines);
   buffer = (unsigned char *)malloc(sizeof(unsigned char)*4*scanline_width);
   if (buffer == NULL)
     /* no buffer space so write flat */
-    return RGBE_WritePixels(fp,data,scanline_width*num_scanlines);
+    return RGBE_WritePixels(strm,data,scanline_width*num_scanlines);
   while(num_scanlines-- > 0) {
     rgbe[0] = 2;
     rgbe[1] = 2;
     rgbe[2] = static_cast<unsigned char>(scanline_width >> 8);
     rgbe[3] = scanline_width & 0xFF;
-    if (fwrite(rgbe, sizeof(rgbe), 1, fp) < 1) {
-      free(buffer);
-      return rgbe_error(rgbe_write_error,NULL);
-    }
+    strm.putBytes(rgbe, (int)sizeof(rgbe));
     for(i=0;i<scanline_width;i++) {
       float2rgbe(rgbe,data[RGBE_DATA_RED],
      data[RGBE_DATA_GREEN],data[RGBE_DATA_BLUE]);
@@ -355,7 +368,7 @@ int RGBE_WritePixels_RLE(FILE *fp, float *data, int scanline_width,
     /* write out each of the four channels separately run length encoded */
     /* first red, then green, then blue, then exponent */
     for(i=0;i<4;i++) {
-      if ((err = RGBE_WriteBytes_RLE(fp,&buffer[i*scanline_width],
+      if ((err = RGBE_WriteBytes_RLE(strm,&buffer[i*scanline_width],
              scanline_width)) != RGBE_RETURN_SUCCESS) {
   free(buffer);
   return err;
@@ -366,7 +379,7 @@ int RGBE_WritePixels_RLE(FILE *fp, float *data, int scanline_width,
   return RGBE_RETURN_SUCCESS;
 }
 
-int RGBE_ReadPixels_RLE(FILE *fp, float *data, int scanline_width,
+int RGBE_ReadPixels_RLE(cv::RLByteStream& strm, float *data, int scanline_width,
       int num_scanlines)
 {
   unsigned char rgbe[4], *scanline_buffer, *ptr, *ptr_end;
@@ -375,11 +388,11 @@ int RGBE_ReadPixels_RLE(FILE *fp, float *data, int scanline_width,
 
   if ((scanline_width < 8)||(scanline_width > 0x7fff))
     /* run length encoding is not allowed so read flat*/
-    return RGBE_ReadPixels(fp,data,scanline_width*num_scanlines);
+    return RGBE_ReadPixels(strm,data,scanline_width*num_scanlines);
   scanline_buffer = NULL;
   /* read in each successive scanline */
   while(num_scanlines > 0) {
-    if (fread(rgbe,sizeof(rgbe),1,fp) < 1) {
+    if (strm.getBytes(rgbe,sizeof(rgbe)) < (int)sizeof(rgbe)) {
       free(scanline_buffer);
       return rgbe_error(rgbe_read_error,NULL);
     }
@@ -388,7 +401,7 @@ int RGBE_ReadPixels_RLE(FILE *fp, float *data, int scanline_width,
       rgbe2float(&data[RGBE_DATA_RED],&data[RGBE_DATA_GREEN],&data[RGBE_DATA_BLUE],rgbe);
       data += RGBE_DATA_SIZE;
       free(scanline_buffer);
-      return RGBE_ReadPixels(fp,data,scanline_width*num_scanlines-1);
+      return RGBE_ReadPixels(strm,data,scanline_width*num_scanlines-1);
     }
     if ((((int)rgbe[2])<<8 | rgbe[3]) != scanline_width) {
       free(scanline_buffer);
@@ -405,7 +418,7 @@ int RGBE_ReadPixels_RLE(FILE *fp, float *data, int scanline_width,
     for(i=0;i<4;i++) {
       ptr_end = &scanline_buffer[(i+1)*scanline_width];
       while(ptr < ptr_end) {
-  if (fread(buf,sizeof(buf[0])*2,1,fp) < 1) {
+  if (strm.getBytes(buf,2) < 2) {
     free(scanline_buffer);
     return rgbe_error(rgbe_read_error,NULL);
   }
@@ -428,7 +441,7 @@ int RGBE_ReadPixels_RLE(FILE *fp, float *data, int scanline_width,
     }
     *ptr++ = buf[1];
     if (--count > 0) {
-      if (fread(ptr,sizeof(*ptr)*count,1,fp) < 1) {
+      if (strm.getBytes(ptr,count) < count) {
         free(scanline_buffer);
         return rgbe_error(rgbe_read_error,NULL);
       }
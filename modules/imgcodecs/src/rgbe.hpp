@@ -47,7 +47,7 @@
 // written by Bruce Walter  (bjw@graphics.cornell.edu)  5/26/95
 // based on code written by Greg Ward
 
-#include <stdio.h>
+#include "bitstrm.hpp"
 
 typedef struct {
   int valid;            /* indicate which fields are valid */
@@ -69,21 +69,23 @@ typedef struct {
 #define RGBE_RETURN_SUCCESS 0
 #define RGBE_RETURN_FAILURE -1
 
+/* the streams may be opened on a file or on a memory buffer */
+
 /* read or write headers */
 /* you may set rgbe_header_info to null if you want to */
-int RGBE_WriteHeader(FILE *fp, int width, int height, rgbe_header_info *info);
-int RGBE_ReadHeader(FILE *fp, int *width, int *height, rgbe_header_info *info);
+int RGBE_WriteHeader(cv::WLByteStream& strm, int width, int height, rgbe_header_info *info);
+int RGBE_ReadHeader(cv::RLByteStream& strm, int *width, int *height, rgbe_header_info *info);
 
 /* read or write pixels */
 /* can read or write pixels in chunks of any size including single pixels*/
-int RGBE_WritePixels(FILE *fp, float *data, int numpixels);
-int RGBE_ReadPixels(FILE *fp, float *data, int numpixels);
+int RGBE_WritePixels(cv::WLByteStream& strm, float *data, int numpixels);
+int RGBE_ReadPixels(cv::RLByteStream& strm, float *data, int numpixels);
 
 /* read or write run length encoded files */
 /* must be called to read or write whole scanlines */
-int RGBE_WritePixels_RLE(FILE *fp, float *data, int scanline_width,
+int RGBE_WritePixels_RLE(cv::WLByteStream& strm, float *data, int scanline_width,
        int num_scanlines);
-int RGBE_ReadPixels_RLE(FILE *fp, float *data, int scanline_width,
+int RGBE_ReadPixels_RLE(cv::RLByteStream& strm, float *data, int scanline_width,
       int num_scanlines);
 
 #endif/*_RGBE_HDR_H_*/
@@ -51,6 +51,91 @@ int validateToInt(size_t sz)
     return valueInt;
 }
 
+int calcDecimationFactor(Size imgSize, Size size)
+{
+    CV_Assert(size.width > 0 && size.height > 0);
+    int factor = std::max(1, std::min(imgSize.width / size.width, imgSize.height / size.height));
+    while (factor > 1 && (divUp(imgSize.width, factor) < size.width || divUp(imgSize.height, factor) < size.height))
+        factor--;
+    return factor;
+}
+
+RowDecimator::RowDecimator(Mat& dst, int srcWidth, int srcHeight, int factor) :
+    m_dst(dst), m_srcWidth(srcWidth), m_srcHeight(srcHeight), m_factor(factor), m_y(0),
+    m_acc(dst.cols * dst.channels())
+{
+    CV_Assert(factor >= 1);
+    CV_CheckEQ(dst.cols, divUp(srcWidth, factor), "");
+    CV_CheckEQ(dst.rows, divUp(srcHeight, factor), "");
+    std::fill(m_acc.data(), m_acc.data() + m_acc.size(), 0.);
+}
+
+template<typename T> static void
+accumulateRow(const T* src, int width, int cn, int factor, double* acc)
+{
+    for (int x = 0; x < width; x += factor, acc += cn)
+    {
+        int x1 = std::min(x + factor, width);
+        for (int k = x * cn; k < x1 * cn; k += cn)
+            for (int c = 0; c < cn; c++)
+                acc[c] += src[k + c];
+    }
+}
+
+template<typename T> static void
+storeRow(double* acc, int width, int cn, int factor, int rows, T* dst)
+{
+    for (int x = 0, dx = 0; x < width; x += factor, dx += cn)
+    {
+        double scale = 1. / (rows * (std::min(x + factor, width) - x));
+        for (int c = 0; c < cn; c++)
+        {
+            dst[dx + c] = saturate_cast<T>(acc[dx + c] * scale);
+            acc[dx + c] = 0;
+        }
+    }
+}
+
+void RowDecimator::push(const uchar* row)
+{
+    CV_Assert(m_y < m_srcHeight);
+    const int cn = m_dst.channels();
+    double* acc = m_acc.data();
+    switch (m_dst.depth())
+    {
+    case CV_8U: accumulateRow((const uchar*)row, m_srcWidth, cn, m_factor, acc); break;
+    case CV_8S: accumulateRow((const schar*)row, m_srcWidth, cn, m_factor, acc); break;
+    case CV_16U: accumulateRow((const ushort*)row, m_srcWidth, cn, m_factor, acc); break;
+    case CV_16S: accumulateRow((const short*)row, m_srcWidth, cn, m_factor, acc); break;
+    case CV_32S: accumulateRow((const int*)row, m_srcWidth, cn, m_factor, acc); break;
+    case CV_32F: accumulateRow((const float*)row, m_srcWidth, cn, m_factor, acc); break;
+    case CV_64F: accumulateRow((const double*)row, m_srcWidth, cn, m_factor, acc); break;
+    default: CV_Error(Error::StsUnsupportedFormat, "");
+    }
+    m_y++;
+    if (m_y % m_factor == 0 || m_y == m_srcHeight)
+        flush();
+}
+
+void RowDecimator::flush()
+{
+    const int cn = m_dst.channels();
+    const int rows = (m_y - 1) % m_factor + 1;
+    uchar* dst = m_dst.ptr((m_y - 1) / m_factor);
+    double* acc = m_acc.data();
+    switch (m_dst.depth())
+    {
+    case CV_8U: storeRow(acc, m_srcWidth, cn, m_factor, rows, (uchar*)dst); break;
+    case CV_8S: storeRow(acc, m_srcWidth, cn, m_factor, rows, (schar*)dst); break;
+    case CV_16U: storeRow(acc, m_srcWidth, cn, m_factor, rows, (ushort*)dst); break;
+    case CV_16S: storeRow(acc, m_srcWidth, cn, m_factor, rows, (short*)dst); break;
+    case CV_32S: storeRow(acc, m_srcWidth, cn, m_factor, rows, (int*)dst); break;
+    case CV_32F: storeRow(acc, m_srcWidth, cn, m_factor, rows, (float*)dst); break;
+    case CV_64F: storeRow(acc, m_srcWidth, cn, m_factor, rows, (double*)dst); break;
+    default: CV_Error(Error::StsUnsupportedFormat, "");
+    }
+}
+
 #define  SCALE  14
 #define  cR  (int)(0.299*(1 << SCALE) + 0.5)
 #define  cG  (int)(0.587*(1 << SCALE) + 0.5)
@@ -55,6 +55,33 @@ size_t safeCastToSizeT(const _Tp v_origin, const char* msg)
     return value_cast;
 }
 
+/** Largest integer factor of decimation of the image of `imgSize` which gives an image not smaller than `size`.
+    The decimated image has divUp(imgSize.width, factor) x divUp(imgSize.height, factor) size. */
+int calcDecimationFactor(Size imgSize, Size size);
+
+/** Downscales the image by an integer factor while it is decoded row by row.
+
+    Every output pixel is the average of the factor x factor block of the source pixels (blocks at the right
+    and bottom borders may be smaller), so a decoder doesn't need to keep the full resolution image in memory.
+ */
+class RowDecimator
+{
+public:
+    /// dst must be allocated with the decimated size and has the type of the source rows
+    RowDecimator(Mat& dst, int srcWidth, int srcHeight, int factor);
+
+    /// adds the next source row of srcWidth pixels
+    void push(const uchar* row);
+
+protected:
+    void flush();
+
+    Mat& m_dst;
+    int m_srcWidth, m_srcHeight, m_factor;
+    int m_y;  // number of pushed rows
+    AutoBuffer<double> m_acc;
+};
+
 struct PaletteEntry
 {
     unsigned char b, g, r, a;
@@ -43,6 +43,34 @@ TEST(Imgcodecs_EXR, readWrite_32FC1)
     EXPECT_EQ(0, remove(filenameOutput.c_str()));
 }
 
+TEST(Imgcodecs_EXR, imencode_imdecode_in_memory)
+{
+    const Size sz(64, 32);
+    Mat img(sz, CV_32FC3, Scalar(0.5, 0.1, 1));
+    img(Rect(10, 5, sz.width - 30, sz.height - 20)).setTo(Scalar(1, 0, 0));
+    const int compressions[] = { IMWRITE_EXR_COMPRESSION_NO, IMWRITE_EXR_COMPRESSION_ZIP, IMWRITE_EXR_COMPRESSION_PIZ };
+    for (size_t i = 0; i < sizeof(compressions) / sizeof(compressions[0]); i++)
+    {
+        SCOPED_TRACE(cv::format("compression=%d", compressions[i]));
+        std::vector<int> params;
+        params.push_back(IMWRITE_EXR_COMPRESSION);
+        params.push_back(compressions[i]);
+
+        const string filenameOutput = cv::tempfile(".exr");
+        ASSERT_TRUE(cv::imwrite(filenameOutput, img, params));
+        std::vector<uchar> buf;
+        ASSERT_TRUE(cv::imencode(".exr", img, buf, params));
+        EXPECT_EQ(getFileSize(filenameOutput), buf.size());
+
+        const Mat img_file = cv::imread(filenameOutput, IMREAD_UNCHANGED);
+        const Mat img_buf = cv::imdecode(buf, IMREAD_UNCHANGED);
+        ASSERT_EQ(img.type(), img_buf.type());
+        EXPECT_EQ(0, cvtest::norm(img_file, img_buf, NORM_INF));
+        EXPECT_LE(cvtest::norm(img, img_buf, NORM_INF | NORM_RELATIVE), 1e-3);
+        EXPECT_EQ(0, remove(filenameOutput.c_str()));
+    }
+}
+
 TEST(Imgcodecs_EXR, readWrite_32FC3)
 { // RGB channels
     const string root = cvtest::TS::ptr()->get_data_path();
@@ -369,6 +369,43 @@ TEST(Imgcodecs_Bmp, rgba_scale)
     ASSERT_EQ(data[0], 255);
 }
 
+#if defined(HAVE_IMGCODEC_HDR) || defined(HAVE_IMGCODEC_PFM) || defined(HAVE_IMGCODEC_SUNRASTER)
+// imencode()/imdecode() must give the same results as imwrite()/imread() without the temporary files
+static void checkImageInMemory(const string& ext, int depth, double maxDiff,
+                               const std::vector<int>& params = std::vector<int>())
+{
+    Mat img(48, 67, CV_MAKETYPE(depth, 3));
+    RNG rng(12345);
+    rng.fill(img, RNG::UNIFORM, Scalar::all(0), Scalar::all(depth == CV_8U ? 256 : 4));
+    img(Rect(8, 8, 40, 20)).setTo(Scalar(0.5, 1, 2));  // runs for RLE
+
+    const string fname = cv::tempfile(ext.c_str());
+    ASSERT_TRUE(imwrite(fname, img, params));
+    std::vector<uchar> buf;
+    ASSERT_TRUE(imencode(ext, img, buf, params));
+
+    std::ifstream f(fname.c_str(), std::ios::in | std::ios::binary);
+    std::vector<uchar> file_buf((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    f.close();
+    EXPECT_EQ(file_buf, buf);
+
+    Mat from_file = imread(fname, IMREAD_UNCHANGED);
+    Mat from_buf = imdecode(buf, IMREAD_UNCHANGED);
+    ASSERT_FALSE(from_buf.empty());
+    ASSERT_EQ(img.type(), from_buf.type());
+    EXPECT_EQ(0, cvtest::norm(from_file, from_buf, NORM_INF));
+    EXPECT_LE(cvtest::norm(img, from_buf, NORM_INF), maxDiff);
+
+    // truncated data must not be decoded silently
+    buf.resize(buf.size() / 2);
+    Mat truncated;
+    try { truncated = imdecode(buf, IMREAD_UNCHANGED); } catch (const cv::Exception&) {}
+    EXPECT_TRUE(truncated.empty());
+
+    EXPECT_EQ(0, remove(fname.c_str()));
+}
+#endif
+
 #ifdef HAVE_IMGCODEC_HDR
 TEST(Imgcodecs_Hdr, regression)
 {
@@ -419,6 +456,16 @@ TEST(Imgcodecs_Hdr, regression_imencode)
     }
 }
 
+TEST(Imgcodecs_Hdr, imencode_imdecode_in_memory)
+{
+    std::vector<int> params(2);
+    params[0] = IMWRITE_HDR_COMPRESSION;
+    params[1] = IMWRITE_HDR_COMPRESSION_NONE;
+    checkImageInMemory(".hdr", CV_32F, 4.0 / 128, params);
+    params[1] = IMWRITE_HDR_COMPRESSION_RLE;
+    checkImageInMemory(".hdr", CV_32F, 4.0 / 128, params);
+}
+
 #endif
 
 #ifdef HAVE_IMGCODEC_PXM
@@ -472,6 +519,18 @@ TEST(Imgcodecs_Pfm, read_write)
   EXPECT_EQ(0, remove(writefile.c_str()));
   EXPECT_EQ(0, remove(writefile_no_param.c_str()));
 }
+
+TEST(Imgcodecs_Pfm, imencode_imdecode_in_memory)
+{
+  checkImageInMemory(".pfm", CV_32F, 0);
+}
+#endif
+
+#ifdef HAVE_IMGCODEC_SUNRASTER
+TEST(Imgcodecs_SunRaster, imencode_imdecode_in_memory)
+{
+    checkImageInMemory(".ras", CV_8U, 0);
+}
 #endif
 
 TEST(Imgcodecs, write_parameter_type)
@@ -96,6 +96,337 @@ INSTANTIATE_TEST_CASE_P(/*nothing*/, Imgcodecs_Resize,
 
 //==================================================================================================
 
+typedef testing::TestWithParam<string> Imgcodecs_DecodeResized;
+
+static Mat makeDecodeResizedTestImage()
+{
+    Mat img(750, 1000, CV_8UC3);
+    for (int y = 0; y < img.rows; y++)
+        for (int x = 0; x < img.cols; x++)
+            img.at<Vec3b>(y, x) = Vec3b((uchar)(x / 4), (uchar)(y / 3), (uchar)((x + y) / 7));
+    circle(img, Point(500, 375), 200, Scalar(30, 200, 90), FILLED);
+    rectangle(img, Rect(100, 80, 250, 120), Scalar(250, 20, 160), FILLED);
+    GaussianBlur(img, img, Size(7, 7), 0);
+    return img;
+}
+
+TEST_P(Imgcodecs_DecodeResized, dsize)
+{
+    const string ext = GetParam();
+    std::vector<uchar> buf;
+    ASSERT_TRUE(imencode("." + ext, makeDecodeResizedTestImage(), buf));
+    Mat full = imdecode(buf, IMREAD_COLOR);
+    ASSERT_FALSE(full.empty());
+
+    const Size sizes[] = { Size(200, 150), Size(333, 250), Size(90, 40), Size(999, 749), Size(1200, 900) };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        const Size dsize = sizes[i];
+        SCOPED_TRACE(cv::format("%dx%d", dsize.width, dsize.height));
+        Mat img = imdecodeResized(buf, dsize, IMREAD_COLOR);
+        ASSERT_EQ(dsize, img.size());
+        ASSERT_EQ(CV_8UC3, img.type());
+
+        Mat ref;
+        resize(full, ref, dsize, 0, 0, dsize.width <= full.cols ? INTER_AREA : INTER_LINEAR);
+        EXPECT_GT(cvtest::PSNR(img, ref), 30.);
+    }
+}
+
+TEST_P(Imgcodecs_DecodeResized, aspect_ratio_and_max_size)
+{
+    const string ext = GetParam();
+    std::vector<uchar> buf;
+    ASSERT_TRUE(imencode("." + ext, makeDecodeResizedTestImage(), buf));
+
+    EXPECT_EQ(Size(200, 150), imdecodeResized(buf, Size(200, 0)).size());
+    EXPECT_EQ(Size(400, 300), imdecodeResized(buf, Size(0, 300)).size());
+    EXPECT_EQ(Size(256, 192), imdecodeResized(buf, 256).size());
+    EXPECT_EQ(Size(1000, 750), imdecodeResized(buf, 5000).size());  // small images are not enlarged
+
+    Mat gray = imdecodeResized(buf, 100, IMREAD_GRAYSCALE);
+    EXPECT_EQ(Size(100, 75), gray.size());
+    EXPECT_EQ(CV_8UC1, gray.type());
+}
+
+TEST_P(Imgcodecs_DecodeResized, imread_same_as_imdecode)
+{
+    const string ext = GetParam();
+    const string fname = cv::tempfile(("." + ext).c_str());
+    const Mat image = makeDecodeResizedTestImage();
+    ASSERT_TRUE(imwrite(fname, image));
+    std::vector<uchar> buf;
+    ASSERT_TRUE(imencode("." + ext, image, buf));
+
+    Mat img_file = imreadResized(fname, Size(160, 120));
+    Mat img_buf = imdecodeResized(buf, Size(160, 120));
+    ASSERT_FALSE(img_file.empty());
+    EXPECT_EQ(0, cvtest::norm(img_file, img_buf, NORM_INF));
+
+    img_file = imreadResized(fname, 300, IMREAD_GRAYSCALE);
+    img_buf = imdecodeResized(buf, 300, IMREAD_GRAYSCALE);
+    ASSERT_FALSE(img_file.empty());
+    EXPECT_EQ(0, cvtest::norm(img_file, img_buf, NORM_INF));
+
+    EXPECT_EQ(0, remove(fname.c_str()));
+}
+
+const string decode_resized_exts[] = {
+#ifdef HAVE_JPEG
+    "jpg",
+#endif
+#if defined(HAVE_PNG) || defined(HAVE_SPNG)
+    "png",
+#endif
+#ifdef HAVE_TIFF
+    "tiff",
+#endif
+#ifdef HAVE_WEBP
+    "webp",
+#endif
+    "bmp",
+};
+
+INSTANTIATE_TEST_CASE_P(/**/, Imgcodecs_DecodeResized, testing::ValuesIn(decode_resized_exts));
+
+TEST(Imgcodecs_Image, decodeResized_empty_target_size)
+{
+    std::vector<uchar> buf;
+    ASSERT_TRUE(imencode(".bmp", Mat(10, 10, CV_8UC3, Scalar::all(0)), buf));
+    EXPECT_THROW(imdecodeResized(buf, Size(0, 0)), cv::Exception);
+    EXPECT_THROW(imdecodeResized(buf, 0), cv::Exception);
+}
+
+#ifdef HAVE_PNG
+static void insertPngChunk(std::vector<uchar>& png, size_t pos, const char type[4], const std::vector<uchar>& data)
+{
+    std::vector<uchar> chunk;
+    const uint32_t len = (uint32_t)data.size();
+    for (int i = 3; i >= 0; i--)
+        chunk.push_back((uchar)(len >> (i * 8)));
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 4; i < chunk.size(); i++)
+    {
+        crc ^= chunk[i];
+        for (int k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+    }
+    crc ^= 0xffffffff;
+    for (int i = 3; i >= 0; i--)
+        chunk.push_back((uchar)(crc >> (i * 8)));
+    png.insert(png.begin() + pos, chunk.begin(), chunk.end());
+}
+
+TEST(Imgcodecs_Image, decodeResized_png_exif_orientation)
+{
+    std::vector<uchar> png;
+    ASSERT_TRUE(imencode(".png", makeDecodeResizedTestImage(), png));
+    // little-endian TIFF header with the only IFD entry: Orientation (SHORT) = 6, rotated by 90 degrees
+    const uchar tiff[] = { 'I', 'I', 42, 0, 8, 0, 0, 0,  1, 0,  0x12, 0x01, 3, 0, 1, 0, 0, 0, 6, 0, 0, 0,  0, 0, 0, 0 };
+    const std::vector<uchar> exif(tiff, tiff + sizeof(tiff));
+
+    const size_t ihdr_end = 8 + 8 + 13 + 4, iend_begin = png.size() - 12;
+    // eXIf is allowed both before and after the image data, the latter is parsed with the pixels
+    const size_t positions[] = { ihdr_end, iend_begin };
+    for (size_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++)
+    {
+        SCOPED_TRACE(i == 0 ? "eXIf before IDAT" : "eXIf after IDAT");
+        std::vector<uchar> buf = png;
+        insertPngChunk(buf, positions[i], "eXIf", exif);
+        Mat full = imdecode(buf, IMREAD_COLOR);
+        ASSERT_EQ(Size(750, 1000), full.size());
+
+        EXPECT_EQ(Size(150, 200), imdecodeResized(buf, Size(150, 0)).size());
+        EXPECT_EQ(Size(225, 300), imdecodeResized(buf, Size(0, 300)).size());
+        EXPECT_EQ(Size(192, 256), imdecodeResized(buf, 256).size());
+        EXPECT_EQ(Size(256, 192), imdecodeResized(buf, 256, IMREAD_COLOR | IMREAD_IGNORE_ORIENTATION).size());
+
+        Mat img = imdecodeResized(buf, Size(300, 400));
+        ASSERT_EQ(Size(300, 400), img.size());
+        Mat ref;
+        resize(full, ref, img.size(), 0, 0, INTER_AREA);
+        EXPECT_GT(cvtest::PSNR(img, ref), 30.);
+    }
+}
+#endif
+
+//==================================================================================================
+
+typedef testing::TestWithParam<string> Imgcodecs_DecodeROI;
+
+TEST_P(Imgcodecs_DecodeROI, same_as_crop)
+{
+    const string ext = GetParam();
+    std::vector<uchar> buf;
+    ASSERT_TRUE(imencode("." + ext, makeDecodeResizedTestImage(), buf));
+
+    const Rect rois[] = { Rect(0, 0, 1000, 750), Rect(123, 45, 300, 200), Rect(0, 700, 1000, 50),
+                          Rect(17, 0, 33, 750), Rect(999, 749, 1, 1), Rect(512, 256, 256, 128) };
+    const int flags[] = { IMREAD_COLOR, IMREAD_GRAYSCALE };
+    for (size_t f = 0; f < sizeof(flags) / sizeof(flags[0]); f++)
+    {
+        Mat full = imdecode(buf, flags[f] | IMREAD_IGNORE_ORIENTATION);
+        ASSERT_FALSE(full.empty());
+        for (size_t i = 0; i < sizeof(rois) / sizeof(rois[0]); i++)
+        {
+            const Rect roi = rois[i];
+            SCOPED_TRACE(cv::format("flags=%d roi=%dx%d+%d+%d", flags[f], roi.width, roi.height, roi.x, roi.y));
+            Mat img = imdecodeROI(buf, roi, flags[f]);
+            ASSERT_EQ(roi.size(), img.size());
+            ASSERT_EQ(full.type(), img.type());
+            EXPECT_EQ(0, cvtest::norm(img, full(roi), NORM_INF));
+        }
+    }
+}
+
+TEST_P(Imgcodecs_DecodeROI, imread_and_bands)
+{
+    const string ext = GetParam();
+    const string fname = cv::tempfile(("." + ext).c_str());
+    const Mat image = makeDecodeResizedTestImage();
+    ASSERT_TRUE(imwrite(fname, image));
+    const Mat full = imread(fname, IMREAD_COLOR | IMREAD_IGNORE_ORIENTATION);
+    ASSERT_FALSE(full.empty());
+
+    const Rect roi(250, 300, 500, 100);
+    Mat img = imreadROI(fname, roi);
+    ASSERT_EQ(roi.size(), img.size());
+    EXPECT_EQ(0, cvtest::norm(img, full(roi), NORM_INF));
+
+    ImageBandReader reader(fname, 64);
+    ASSERT_TRUE(reader.isOpened());
+    EXPECT_EQ(full.size(), reader.size());
+    EXPECT_EQ(CV_8UC3, reader.type());
+    Mat band;
+    int bands = 0;
+    while (reader.read(band))
+    {
+        const int y = reader.position() - band.rows;
+        SCOPED_TRACE(cv::format("band=%d y=%d", bands, y));
+        ASSERT_EQ(std::min(64, full.rows - y), band.rows);
+        ASSERT_EQ(full.cols, band.cols);
+        EXPECT_EQ(0, cvtest::norm(band, full.rowRange(y, y + band.rows), NORM_INF));
+        bands++;
+    }
+    EXPECT_EQ(12, bands);
+    EXPECT_EQ(full.rows, reader.position());
+    EXPECT_FALSE(reader.read(band));
+
+    EXPECT_EQ(0, remove(fname.c_str()));
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Imgcodecs_DecodeROI, testing::ValuesIn(decode_resized_exts));
+
+TEST(Imgcodecs_Image, decodeROI_outside_of_image)
+{
+    std::vector<uchar> buf;
+    ASSERT_TRUE(imencode(".bmp", Mat(10, 10, CV_8UC3, Scalar::all(0)), buf));
+    EXPECT_THROW(imdecodeROI(buf, Rect(5, 5, 6, 5)), cv::Exception);
+    EXPECT_THROW(imdecodeROI(buf, Rect(-1, 0, 5, 5)), cv::Exception);
+    EXPECT_THROW(imdecodeROI(buf, Rect(0, 0, 0, 5)), cv::Exception);
+    EXPECT_EQ(Size(5, 5), imdecodeROI(buf, Rect(5, 5, 5, 5)).size());
+}
+
+//==================================================================================================
+
+static std::vector<string> getBatchTestExts()
+{
+    std::vector<string> exts_;
+#ifdef HAVE_JPEG
+    exts_.push_back("jpg");
+#endif
+#if defined(HAVE_PNG) || defined(HAVE_SPNG)
+    exts_.push_back("png");
+#endif
+    exts_.push_back("bmp");
+    return exts_;
+}
+
+TEST(Imgcodecs_Batch, imreadBatch)
+{
+    const std::vector<string> batch_exts = getBatchTestExts();
+    std::vector<String> filenames;
+    for (int i = 0; i < 12; i++)
+    {
+        Mat image(60 + i, 80 + 2*i, CV_8UC3);
+        randu(image, Scalar::all(0), Scalar::all(256));
+        filenames.push_back(cv::tempfile(("." + batch_exts[i % batch_exts.size()]).c_str()));
+        ASSERT_TRUE(imwrite(filenames.back(), image));
+    }
+    const string corrupted = cv::tempfile(".bmp");
+    {
+        std::ofstream f(corrupted.c_str(), std::ios::binary);
+        f << "BM not an image";
+    }
+    filenames.insert(filenames.begin() + 3, corrupted);
+    filenames.insert(filenames.begin() + 7, cv::tempfile(".png"));  // missing file
+
+    std::vector<Mat> decoded;
+    std::vector<String> errors;
+    EXPECT_EQ(12, imreadBatch(filenames, decoded, errors, IMREAD_GRAYSCALE));
+    ASSERT_EQ(filenames.size(), decoded.size());
+    ASSERT_EQ(filenames.size(), errors.size());
+    for (size_t i = 0; i < filenames.size(); i++)
+    {
+        SCOPED_TRACE(filenames[i]);
+        if (i == 3 || i == 7)
+        {
+            EXPECT_TRUE(decoded[i].empty());
+            EXPECT_FALSE(errors[i].empty());
+            continue;
+        }
+        EXPECT_TRUE(errors[i].empty()) << errors[i];
+        Mat expected = imread(filenames[i], IMREAD_GRAYSCALE);
+        ASSERT_FALSE(expected.empty());
+        EXPECT_EQ(0, cvtest::norm(expected, decoded[i], NORM_INF));
+        EXPECT_EQ(0, remove(filenames[i].c_str()));
+    }
+    EXPECT_EQ(0, remove(corrupted.c_str()));
+}
+
+TEST(Imgcodecs_Batch, imdecodeBatch_reuses_outputs)
+{
+    const std::vector<string> batch_exts = getBatchTestExts();
+    std::vector< std::vector<uchar> > bufs(9);
+    std::vector<Mat> expected(bufs.size());
+    for (size_t i = 0; i < bufs.size(); i++)
+    {
+        Mat image(64, 48, CV_8UC3);
+        randu(image, Scalar::all(0), Scalar::all(256));
+        ASSERT_TRUE(imencode("." + batch_exts[i % batch_exts.size()], image, bufs[i]));
+        expected[i] = imdecode(bufs[i], IMREAD_COLOR);
+    }
+    bufs[4].clear();
+
+    std::vector<Mat> decoded(bufs.size());
+    std::vector<const uchar*> ptrs(bufs.size());
+    for (size_t i = 0; i < decoded.size(); i++)
+    {
+        decoded[i].create(64, 48, CV_8UC3);
+        ptrs[i] = decoded[i].data;
+    }
+    std::vector<String> errors;
+    EXPECT_EQ(8, imdecodeBatch(bufs, decoded, errors, IMREAD_COLOR));
+    ASSERT_EQ(bufs.size(), decoded.size());
+    for (size_t i = 0; i < bufs.size(); i++)
+    {
+        SCOPED_TRACE(cv::format("i=%d", (int)i));
+        if (i == 4)
+        {
+            EXPECT_TRUE(decoded[i].empty());
+            EXPECT_FALSE(errors[i].empty());
+            continue;
+        }
+        EXPECT_TRUE(errors[i].empty()) << errors[i];
+        EXPECT_EQ(ptrs[i], decoded[i].data);
+        EXPECT_EQ(0, cvtest::norm(expected[i], decoded[i], NORM_INF));
+    }
+}
+
+//==================================================================================================
+
 TEST(Imgcodecs_Image, read_write_bmp)
 {
     const size_t IMAGE_COUNT = 10;
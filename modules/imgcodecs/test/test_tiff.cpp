@@ -540,6 +540,79 @@ TEST(Imgcodecs_Tiff, decode_tile_remainder)
     // What about 32, 64 bit?
 }
 
+// uncompressed little endian grayscale TIFF with 32x32 tiles (8 or 16 bits)
+static std::vector<uchar> makeTiledTiff(const Mat& img)
+{
+    const int tile = 32;
+    const int ntiles = divUp(img.cols, tile) * divUp(img.rows, tile);
+    const int bits = img.depth() == CV_16U ? 16 : 8;
+    std::vector<uchar> buf;
+    auto put16 = [&](int v) { buf.push_back((uchar)(v & 255)); buf.push_back((uchar)((v >> 8) & 255)); };
+    auto put32 = [&](int v) { put16(v & 0xffff); put16((v >> 16) & 0xffff); };
+    auto entry = [&](int tag, int type, int count, int value) {
+        put16(tag); put16(type); put32(count);
+        if (type == 3 && count == 1) { put16(value); put16(0); }  // SHORT
+        else put32(value);
+    };
+
+    const int nentries = 10, ifd_end = 8 + 2 + nentries * 12 + 4;
+    const int offsets = ifd_end, counts = offsets + ntiles * 4, data = counts + ntiles * 4;
+    const int tile_bytes = tile * tile * bits / 8;
+    buf.push_back('I'); buf.push_back('I'); put16(42); put32(8);
+    put16(nentries);
+    entry(256, 4, 1, img.cols);        // ImageWidth
+    entry(257, 4, 1, img.rows);        // ImageLength
+    entry(258, 3, 1, bits);            // BitsPerSample
+    entry(259, 3, 1, 1);               // Compression: none
+    entry(262, 3, 1, 1);               // Photometric: min-is-black
+    entry(277, 3, 1, 1);               // SamplesPerPixel
+    entry(322, 4, 1, tile);            // TileWidth
+    entry(323, 4, 1, tile);            // TileLength
+    entry(324, 4, ntiles, offsets);    // TileOffsets
+    entry(325, 4, ntiles, counts);     // TileByteCounts
+    put32(0);
+    for (int i = 0; i < ntiles; i++)
+        put32(data + i * tile_bytes);
+    for (int i = 0; i < ntiles; i++)
+        put32(tile_bytes);
+    for (int ty = 0; ty < img.rows; ty += tile)
+        for (int tx = 0; tx < img.cols; tx += tile)
+            for (int y = ty; y < ty + tile; y++)
+                for (int x = tx; x < tx + tile; x++)
+                {
+                    int v = x < img.cols && y < img.rows ? (bits == 16 ? img.at<ushort>(y, x) : img.at<uchar>(y, x)) : 0;
+                    if (bits == 16)
+                        put16(v);
+                    else
+                        buf.push_back((uchar)v);
+                }
+    return buf;
+}
+
+TEST(Imgcodecs_Tiff, read_region_of_tiled_image)
+{
+    const int depths[] = { CV_8U, CV_16U };
+    for (size_t d = 0; d < sizeof(depths) / sizeof(depths[0]); d++)
+    {
+        Mat img(140, 170, depths[d]);
+        randu(img, 0, depths[d] == CV_8U ? 256 : 65536);
+        const std::vector<uchar> buf = makeTiledTiff(img);
+        Mat full = imdecode(buf, IMREAD_UNCHANGED);
+        ASSERT_EQ(0, cvtest::norm(img, full, NORM_INF));
+
+        const Rect rois[] = { Rect(0, 0, 170, 140), Rect(32, 32, 32, 32), Rect(31, 31, 2, 2),
+                              Rect(40, 6, 120, 100), Rect(160, 128, 10, 12), Rect(0, 65, 170, 1) };
+        for (size_t i = 0; i < sizeof(rois) / sizeof(rois[0]); i++)
+        {
+            const Rect roi = rois[i];
+            SCOPED_TRACE(cv::format("depth=%d roi=%dx%d+%d+%d", depths[d], roi.width, roi.height, roi.x, roi.y));
+            Mat region = imdecodeROI(buf, roi, IMREAD_UNCHANGED);
+            ASSERT_EQ(roi.size(), region.size());
+            EXPECT_EQ(0, cvtest::norm(img(roi), region, NORM_INF));
+        }
+    }
+}
+
 TEST(Imgcodecs_Tiff, decode_10_12_14)
 {
     /* see issue #21700
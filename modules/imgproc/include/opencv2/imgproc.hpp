@@ -275,7 +275,18 @@ enum InterpolationFlags{
     - flag is set: \f$dst(x,y) = src( \rho , \phi )\f$
     */
     WARP_INVERSE_MAP     = 16,
-    WARP_RELATIVE_MAP    = 32
+    WARP_RELATIVE_MAP    = 32,
+    /** flag for #resize, can be combined with #INTER_LINEAR, #INTER_CUBIC or #INTER_LANCZOS4. The image
+    is resampled by a separable convolution with the triangle, bicubic or Lanczos kernel, whose support
+    is stretched by the downscale factor, so that every source pixel contributes to the result (the
+    same approach as used by Pillow). Gives anti-aliased results at arbitrary downscale ratios. */
+    INTER_ANTIALIAS      = 64,
+    /** Bit exact bicubic interpolation, only supported by #resize. Uses the same kernel as #INTER_CUBIC
+    with fixed-point coefficients, so the results are identical on all platforms. 32F and 64F images
+    fall back to #INTER_CUBIC. For 3-channel 8-bit images it is slower than #INTER_CUBIC.
+    The value lies outside of #INTER_MAX, so the functions which take `flags & INTER_MAX` (e.g. #remap
+    or #warpAffine) treat it as #INTER_CUBIC. */
+    INTER_CUBIC_EXACT    = 128 + INTER_CUBIC
 };
 
 /** \brief Specify the polar mapping mode
@@ -2398,7 +2409,11 @@ way:
 @endcode
 To shrink an image, it will generally look best with #INTER_AREA interpolation, whereas to
 enlarge an image, it will generally look best with #INTER_CUBIC (slow) or #INTER_LINEAR
-(faster but still looks OK).
+(faster but still looks OK). For downscaling by non-integer factors #INTER_LINEAR | #INTER_ANTIALIAS
+gives the quality of #INTER_AREA at about the speed of #INTER_LINEAR:
+@code
+    resize(src, dst, Size(224, 224), 0, 0, INTER_LINEAR | INTER_ANTIALIAS);
+@endcode
 
 @param src input image.
 @param dst output image; it has the size dsize (when it is non-zero) or the size computed from
@@ -2418,6 +2433,173 @@ CV_EXPORTS_W void resize( InputArray src, OutputArray dst,
                           Size dsize, double fx = 0, double fy = 0,
                           int interpolation = INTER_LINEAR );
 
+/** @brief Resizes a batch of images to the same size.
+
+The function is equivalent to calling #resize for every image of the batch, but the whole batch is
+processed by a single parallel job over (image, row stripe) pairs. It scales with the number of
+threads even when every output image is small (e.g. a network input), which is not the case for
+a loop of #resize calls. The interpolation tables are computed once for all the images with the
+same size and type.
+
+@param src input images; they may have different sizes and types.
+@param dst output images; dst[i] has the size dsize and the type of src[i].
+@param dsize output image size.
+@param interpolation interpolation method, see #InterpolationFlags
+
+@sa resize, ResizePlan
+ */
+CV_EXPORTS_W void resizeBatch( InputArrayOfArrays src, OutputArrayOfArrays dst,
+                               Size dsize, int interpolation = INTER_LINEAR );
+
+/** @brief Precomputed resize of images with fixed geometry.
+
+The class computes the interpolation tables used by #resize (pixel offsets and interpolation
+coefficients) once and then applies them to any number of images of the same size and type.
+The result of apply() is bit-exact to the result of #resize called with the same parameters.
+It is useful when many images (e.g. video frames) are resized with identical parameters and the
+destination is small, so the table setup becomes a noticeable share of the total cost.
+@code
+    ResizePlan plan(frame.size(), frame.type(), Size(224, 224), 0, 0, INTER_AREA);
+    Mat thumb;
+    while (cap.read(frame))
+        plan.apply(frame, thumb); // thumb is allocated once and reused
+@endcode
+The plan is immutable after construction, so apply() may be called concurrently from several
+threads.
+
+@sa resize
+ */
+class CV_EXPORTS_W_SIMPLE ResizePlan
+{
+public:
+    /** @brief Creates an empty plan. */
+    CV_WRAP ResizePlan();
+
+    /** @brief Computes the resize tables for the given geometry.
+
+    @param ssize size of the input images.
+    @param type type of the input and output images.
+    @param dsize output image size, see #resize.
+    @param fx scale factor along the horizontal axis, see #resize.
+    @param fy scale factor along the vertical axis, see #resize.
+    @param interpolation interpolation method, see #InterpolationFlags
+     */
+    CV_WRAP ResizePlan(Size ssize, int type, Size dsize, double fx = 0, double fy = 0,
+                       int interpolation = INTER_LINEAR);
+
+    /** @brief Resizes an image using the precomputed tables.
+
+    @param src input image; its size and type must match the ones the plan has been created for.
+    @param dst output image; it is reallocated only if its size or type differ from dstSize() and
+    type().
+     */
+    CV_WRAP void apply(InputArray src, OutputArray dst) const;
+
+    /** @brief Returns true if the plan has not been initialized. */
+    CV_WRAP bool empty() const;
+
+    /** @brief Returns the expected input image size. */
+    CV_WRAP Size srcSize() const;
+
+    /** @brief Returns the output image size. */
+    CV_WRAP Size dstSize() const;
+
+    /** @brief Returns the type of the input and output images. */
+    CV_WRAP int type() const;
+
+#ifndef CV_DOXYGEN
+    struct Impl;
+protected:
+    std::shared_ptr<Impl> impl;
+#endif
+};
+
+/** @brief Incremental resize of an image that arrives in horizontal bands.
+
+The class resizes an image whose rows become available sequentially, e.g. while it is being
+decoded or received. Source rows are pushed in bands of any height, and each push returns the
+destination rows whose interpolation window has been completely covered by the rows seen so far.
+Only the state needed by the pending destination rows is kept (e.g. `ksize` horizontally resized
+rows for #INTER_LINEAR, #INTER_CUBIC and #INTER_LANCZOS4, or one accumulated row pair for
+#INTER_AREA), so the full source image is never stored.
+@code
+    ResizeStream rs(Size(width, height), CV_8UC3, Size(), 0.25, 0.25, INTER_AREA);
+    Mat band, rows;
+    for (int y = 0; y < height; y += band.rows)
+    {
+        band = readNextRows(); // any number of rows
+        rs.push(band, rows);
+        rows.copyTo(dst.rowRange(rs.producedRows() - rows.rows, rs.producedRows()));
+    }
+@endcode
+All interpolation methods of #resize are supported, and the concatenated output is equal to the
+output of the built-in implementation of #resize (the external HAL and IPP code paths are not
+used by this class).
+
+@sa resize, ResizePlan
+ */
+class CV_EXPORTS_W_SIMPLE ResizeStream
+{
+public:
+    /** @brief Creates an empty object. */
+    CV_WRAP ResizeStream();
+
+    /** @brief Prepares the incremental resize of an image with the given geometry.
+
+    @param ssize size of the whole input image.
+    @param type type of the input and output images.
+    @param dsize output image size, see #resize.
+    @param fx scale factor along the horizontal axis, see #resize.
+    @param fy scale factor along the vertical axis, see #resize.
+    @param interpolation interpolation method, see #InterpolationFlags
+     */
+    CV_WRAP ResizeStream(Size ssize, int type, Size dsize, double fx = 0, double fy = 0,
+                         int interpolation = INTER_LINEAR);
+
+    /** @brief Pushes the next band of source rows.
+
+    @param rows the next rows of the input image; its width and type must match the ones the
+    object has been created for. The total number of pushed rows can not exceed srcSize().height.
+    @param dst the destination rows completed by this band, starting from the row
+    producedRows() had before the call. It is empty if no rows have been completed.
+    @return number of destination rows stored in dst.
+     */
+    CV_WRAP int push(InputArray rows, OutputArray dst);
+
+    /** @brief Restarts the object for the next image of the same geometry.
+
+    The interpolation tables are kept, only the row counters and the intermediate rows are reset.
+     */
+    CV_WRAP void reset();
+
+    /** @brief Returns the number of source rows pushed so far. */
+    CV_WRAP int consumedRows() const;
+
+    /** @brief Returns the number of destination rows produced so far. */
+    CV_WRAP int producedRows() const;
+
+    /** @brief Returns true when all the destination rows have been produced. */
+    CV_WRAP bool finished() const;
+
+    /** @brief Returns true if the object has not been initialized. */
+    CV_WRAP bool empty() const;
+
+    /** @brief Returns the size of the whole input image. */
+    CV_WRAP Size srcSize() const;
+
+    /** @brief Returns the output image size. */
+    CV_WRAP Size dstSize() const;
+
+    /** @brief Returns the type of the input and output images. */
+    CV_WRAP int type() const;
+
+#ifndef CV_DOXYGEN
+    struct Impl;
+protected:
+    std::shared_ptr<Impl> impl;
+#endif
+};
+
 /** @brief Applies an affine transformation to an image.
 
 The function warpAffine transforms the source image using the specified matrix:
@@ -3749,6 +3931,33 @@ This function only supports YUV420 to RGB conversion as of now.
 */
 CV_EXPORTS_W void cvtColorTwoPlane( InputArray src1, InputArray src2, OutputArray dst, int code );
 
+/** @brief Resizes a YUV 4:2:0 image and converts it to RGB in one call.
+
+The function gives the same result as resizing the luma and the chroma planes of the source
+separately with #resize and converting the resized image with #cvtColor. It is the cheap way to get a
+small RGB image out of a large camera or video frame: only the destination pixels are converted,
+while a call to #cvtColor followed by #resize converts and stores the whole full-resolution frame.
+Because chroma is interpolated before the conversion, the result differs slightly from the latter
+near sharp color edges.
+@code
+    // 3840x2160 NV12 frame (2160*3/2 rows of 3840 bytes) from the decoder
+    resizeYUV2BGR(frame, small, Size(640, 360), COLOR_YUV2BGR_NV12, INTER_AREA);
+@endcode
+
+@param src 8-bit single-channel YUV 4:2:0 image in the layout expected by #cvtColor: the Y plane
+followed by the chroma planes, src.rows = height*3/2.
+@param dst output image of the size dsize.
+@param dsize output image size; it must be even in both directions unless code is #COLOR_YUV2GRAY_420.
+@param code color conversion code. The supported values are the YUV 4:2:0 to RGB codes of #cvtColor:
+#COLOR_YUV2BGR_NV12, #COLOR_YUV2BGR_NV21, #COLOR_YUV2BGR_YV12, #COLOR_YUV2BGR_IYUV (#COLOR_YUV2BGR_I420),
+their RGB, BGRA and RGBA counterparts, and #COLOR_YUV2GRAY_420.
+@param interpolation interpolation method, see #InterpolationFlags
+
+@sa cvtColor, resize
+ */
+CV_EXPORTS_W void resizeYUV2BGR( InputArray src, OutputArray dst, Size dsize, int code,
+                                 int interpolation = INTER_LINEAR );
+
 /** @brief main function for all demosaicing processes
 
 @param src input image: 8-bit unsigned or 16-bit unsigned.
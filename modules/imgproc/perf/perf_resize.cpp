@@ -280,4 +280,193 @@ PERF_TEST_P(MatInfo_Size_Scale_NN, ResizeNNExact,
     SANITY_CHECK_NOTHING();
 }
 
+typedef tuple<MatType, Size_Size_t, int> MatInfo_SizePair_Inter_t;
+typedef TestBaseWithParam<MatInfo_SizePair_Inter_t> MatInfo_SizePair_Inter;
+
+PERF_TEST_P(MatInfo_SizePair_Inter, ResizeGeneric,
+    testing::Combine(
+        testing::Values(CV_8UC1, CV_8UC3, CV_16UC1, CV_32FC1),
+        testing::Values(
+            Size_Size_t(sz1080p, sz2160p),
+            Size_Size_t(sz720p, Size(1680, 945)),
+            Size_Size_t(sz2160p, sz1080p),
+            Size_Size_t(sz2160p, Size(1456, 819))
+        ),
+        testing::Values((int)INTER_CUBIC, (int)INTER_LANCZOS4)
+    )
+)
+{
+    int matType = get<0>(GetParam());
+    Size_Size_t sizes = get<1>(GetParam());
+    Size from = get<0>(sizes);
+    Size to = get<1>(sizes);
+    int interpolation = get<2>(GetParam());
+
+    cv::Mat src(from, matType), dst(to, matType);
+    declare.in(src, WARMUP_RNG).out(dst);
+    declare.time(100);
+
+    TEST_CYCLE() resize(src, dst, to, 0, 0, interpolation);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(MatInfo_SizePair_Inter, ResizeCubicExact,
+    testing::Combine(
+        testing::Values(CV_8UC1, CV_8UC3, CV_8UC4, CV_16UC1),
+        testing::Values(
+            Size_Size_t(sz1080p, sz2160p),
+            Size_Size_t(sz720p, Size(1680, 945)),
+            Size_Size_t(sz2160p, sz1080p)
+        ),
+        testing::Values((int)INTER_CUBIC, (int)INTER_CUBIC_EXACT)
+    )
+)
+{
+    int matType = get<0>(GetParam());
+    Size_Size_t sizes = get<1>(GetParam());
+    Size from = get<0>(sizes);
+    Size to = get<1>(sizes);
+    int interpolation = get<2>(GetParam());
+
+    cv::Mat src(from, matType), dst(to, matType);
+    declare.in(src, WARMUP_RNG).out(dst);
+    declare.time(100);
+
+    TEST_CYCLE() resize(src, dst, to, 0, 0, interpolation);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(MatInfo_SizePair_Inter, ResizeAntialias,
+    testing::Combine(
+        testing::Values(CV_8UC1, CV_8UC3, CV_16UC1, CV_32FC1),
+        testing::Values(
+            Size_Size_t(sz1080p, Size(224, 224)),
+            Size_Size_t(sz1080p, Size(700, 394)),
+            Size_Size_t(sz720p, Size(512, 288))
+        ),
+        testing::Values((int)INTER_LINEAR, (int)INTER_AREA,
+                        (int)(INTER_LINEAR | INTER_ANTIALIAS), (int)(INTER_CUBIC | INTER_ANTIALIAS))
+    )
+)
+{
+    int matType = get<0>(GetParam());
+    Size_Size_t sizes = get<1>(GetParam());
+    Size from = get<0>(sizes);
+    Size to = get<1>(sizes);
+    int interpolation = get<2>(GetParam());
+
+    cv::Mat src(from, matType), dst(to, matType);
+    declare.in(src, WARMUP_RNG).out(dst);
+
+    TEST_CYCLE() resize(src, dst, to, 0, 0, interpolation);
+
+    SANITY_CHECK_NOTHING();
+}
+
+typedef tuple<MatType, Size, int> MatInfo_Size_Inter_t;
+typedef TestBaseWithParam<MatInfo_Size_Inter_t> MatInfo_Size_Inter;
+
+PERF_TEST_P(MatInfo_Size_Inter, ResizePlanThumbnail,
+    testing::Combine(
+        testing::Values(CV_8UC1, CV_8UC3),
+        testing::Values(szVGA, sz720p, sz1080p),
+        testing::Values((int)INTER_LINEAR, (int)INTER_AREA, (int)INTER_CUBIC, (int)INTER_LINEAR_EXACT)
+    )
+)
+{
+    int matType = get<0>(GetParam());
+    Size from = get<1>(GetParam());
+    int interpolation = get<2>(GetParam());
+
+    cv::Mat src(from, matType);
+    cv::Mat dst(Size(224, 224), matType);
+
+    declare.in(src, WARMUP_RNG).out(dst);
+
+    ResizePlan plan(src.size(), matType, dst.size(), 0, 0, interpolation);
+
+    TEST_CYCLE_MULTIRUN(10) plan.apply(src, dst);
+
+    SANITY_CHECK_NOTHING();
+}
+
+typedef tuple<MatType, int, int> MatType_Count_Inter_t;
+typedef TestBaseWithParam<MatType_Count_Inter_t> MatType_Count_Inter;
+
+PERF_TEST_P(MatType_Count_Inter, ResizeBatch,
+    testing::Combine(
+        testing::Values(CV_8UC3, CV_32FC3),
+        testing::Values(16, 64, 256),
+        testing::Values((int)INTER_LINEAR, (int)INTER_AREA, (int)INTER_CUBIC)
+    )
+)
+{
+    int matType = get<0>(GetParam());
+    int count = get<1>(GetParam());
+    int interpolation = get<2>(GetParam());
+    const Size dsize(112, 112);
+
+    // detection crops: a few distinct sizes
+    std::vector<Mat> src(count), dst;
+    for (int i = 0; i < count; i++)
+    {
+        src[i].create(Size(160 + 24*(i % 4), 200 + 16*(i % 3)), matType);
+        declare.in(src[i], WARMUP_RNG);
+    }
+
+    TEST_CYCLE() cv::resizeBatch(src, dst, dsize, interpolation);
+
+    SANITY_CHECK_NOTHING();
+}
+
+CV_ENUM(YUV420Code, COLOR_YUV2BGR_NV12, COLOR_YUV2BGR_I420)
+typedef tuple<YUV420Code, Size, int> YUV420Code_Size_Inter_t;
+typedef TestBaseWithParam<YUV420Code_Size_Inter_t> YUV420Code_Size_Inter;
+
+PERF_TEST_P(YUV420Code_Size_Inter, ResizeYUV2BGR,
+    testing::Combine(
+        YUV420Code::all(),
+        testing::Values(sz1080p, sz2160p),
+        testing::Values((int)INTER_LINEAR, (int)INTER_AREA)
+    )
+)
+{
+    int code = get<0>(GetParam());
+    Size sz = get<1>(GetParam());
+    int interpolation = get<2>(GetParam());
+
+    Mat src(sz.height * 3 / 2, sz.width, CV_8UC1), dst(360, 640, CV_8UC3);
+    declare.in(src, WARMUP_RNG).out(dst);
+
+    TEST_CYCLE() cv::resizeYUV2BGR(src, dst, dst.size(), code, interpolation);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(YUV420Code_Size_Inter, ResizeYUV2BGR_cvtColorAndResize,
+    testing::Combine(
+        YUV420Code::all(),
+        testing::Values(sz1080p, sz2160p),
+        testing::Values((int)INTER_LINEAR, (int)INTER_AREA)
+    )
+)
+{
+    int code = get<0>(GetParam());
+    Size sz = get<1>(GetParam());
+    int interpolation = get<2>(GetParam());
+
+    Mat src(sz.height * 3 / 2, sz.width, CV_8UC1), bgr, dst(360, 640, CV_8UC3);
+    declare.in(src, WARMUP_RNG).out(dst);
+
+    TEST_CYCLE()
+    {
+        cvtColor(src, bgr, code);
+        resize(bgr, dst, dst.size(), 0, 0, interpolation);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
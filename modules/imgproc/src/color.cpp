@@ -185,6 +185,90 @@ void cvtColorTwoPlane( InputArray _ysrc, InputArray _uvsrc, OutputArray _dst, in
 }
 
 
+// resize + color conversion of YUV420 frames
+
+void resizeYUV2BGR( InputArray _src, OutputArray _dst, Size dsize, int code, int interpolation )
+{
+    CV_INSTRUMENT_REGION();
+
+    bool twoPlane = false;
+    switch (code)
+    {
+        case COLOR_YUV2BGR_NV21:  case COLOR_YUV2RGB_NV21:  case COLOR_YUV2BGR_NV12:  case COLOR_YUV2RGB_NV12:
+        case COLOR_YUV2BGRA_NV21: case COLOR_YUV2RGBA_NV21: case COLOR_YUV2BGRA_NV12: case COLOR_YUV2RGBA_NV12:
+            twoPlane = true;
+            break;
+        case COLOR_YUV2BGR_YV12:  case COLOR_YUV2RGB_YV12:  case COLOR_YUV2BGRA_YV12: case COLOR_YUV2RGBA_YV12:
+        case COLOR_YUV2BGR_IYUV:  case COLOR_YUV2RGB_IYUV:  case COLOR_YUV2BGRA_IYUV: case COLOR_YUV2RGBA_IYUV:
+        case COLOR_YUV2GRAY_420:
+            break;
+        default:
+            CV_Error( cv::Error::StsBadFlag, "Unknown/unsupported color conversion code" );
+    }
+
+    Mat src = _src.getMat();
+    CV_Assert( !src.empty() && src.type() == CV_8UC1 );
+    CV_Assert( src.cols % 2 == 0 && src.rows % 3 == 0 );
+    CV_Assert( dsize.width > 0 && dsize.height > 0 );
+
+    Size ysz(src.cols, src.rows * 2 / 3);
+    Mat ysrc = src.rowRange(0, ysz.height);
+
+    if (code == COLOR_YUV2GRAY_420)
+    {
+        resize(ysrc, _dst, dsize, 0, 0, interpolation);
+        return;
+    }
+
+    // chroma is subsampled 2x in both directions, so it is resized with the same ratio as luma
+    CV_Assert( dsize.width % 2 == 0 && dsize.height % 2 == 0 );
+    Size uvsz(ysz.width / 2, ysz.height / 2), duvsz(dsize.width / 2, dsize.height / 2);
+
+    int dcn = dstChannels(code);
+    _dst.create(dsize, CV_MAKETYPE(CV_8U, dcn));
+    Mat dst = _dst.getMat();
+
+    if (twoPlane)
+    {
+        Mat uvsrc(uvsz, CV_8UC2, src.ptr(ysz.height), src.step);
+        Mat ydst, uvdst;
+        resize(ysrc, ydst, dsize, 0, 0, interpolation);
+        resize(uvsrc, uvdst, duvsz, 0, 0, interpolation);
+
+        hal::cvtTwoPlaneYUVtoBGR(ydst.data, ydst.step, uvdst.data, uvdst.step,
+                                 dst.data, dst.step, dst.cols, dst.rows,
+                                 dcn, swapBlue(code), uIndex(code));
+    }
+    else
+    {
+        // every row of the source holds two rows of a chroma plane, it can be expressed
+        // as a matrix with a constant step only when there is no gap at the end of the row
+        if (!src.isContinuous())
+        {
+            src = src.clone();
+            ysrc = src.rowRange(0, ysz.height);
+        }
+
+        // the destination planes are stored in one continuous buffer in the same layout
+        Mat yuvdst(dsize.height * 3 / 2, dsize.width, CV_8UC1);
+        Mat ydst = yuvdst.rowRange(0, dsize.height);
+        const uchar* psrc = src.ptr(ysz.height);
+        uchar* pdst = yuvdst.ptr(dsize.height);
+        for (int i = 0; i < 2; i++)
+        {
+            Mat csrc(uvsz, CV_8UC1, const_cast<uchar*>(psrc) + i * uvsz.area());
+            Mat cdst(duvsz, CV_8UC1, pdst + i * duvsz.area());
+            resize(csrc, cdst, duvsz, 0, 0, interpolation);
+            CV_DbgAssert( cdst.data == pdst + i * duvsz.area() );
+        }
+        resize(ysrc, ydst, dsize, 0, 0, interpolation);
+
+        hal::cvtThreePlaneYUVtoBGR(yuvdst.data, yuvdst.step, dst.data, dst.step, dst.cols, dst.rows,
+                                   dcn, swapBlue(code), uIndex(code));
+    }
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 //                                   The main function                                  //
 //////////////////////////////////////////////////////////////////////////////////////////
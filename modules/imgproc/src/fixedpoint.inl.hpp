@@ -92,6 +92,9 @@ public:
     CV_ALWAYS_INLINE bool isZero() { return val == 0; }
     static CV_ALWAYS_INLINE fixedpoint64 zero() { return fixedpoint64(); }
     static CV_ALWAYS_INLINE fixedpoint64 one() { return fixedpoint64((int64_t)(1LL << fixedShift)); }
+
+    static CV_ALWAYS_INLINE fixedpoint64 fromRaw(int64_t v) { return fixedpoint64(v); }
+    CV_ALWAYS_INLINE int64_t raw() const { return val; }
     friend class fixedpoint32;
 };
 
@@ -218,6 +221,9 @@ public:
     CV_ALWAYS_INLINE bool isZero() { return val == 0; }
     static CV_ALWAYS_INLINE fixedpoint32 zero() { return fixedpoint32(); }
     static CV_ALWAYS_INLINE fixedpoint32 one() { return fixedpoint32((1 << fixedShift)); }
+
+    static CV_ALWAYS_INLINE fixedpoint32 fromRaw(int32_t v) { return fixedpoint32(v); }
+    CV_ALWAYS_INLINE int32_t raw() const { return val; }
     friend class fixedpoint16;
 };
 
@@ -48,6 +48,7 @@
 // */
 
 #include "precomp.hpp"
+#include "opencv2/core/hal/intrin.hpp"
 #include "resize.hpp"
 
 namespace cv
@@ -256,6 +257,33 @@ void resizeNN4_AVX2(const Range& range, const Mat& src, Mat &dst, int *x_ofs, do
     parallel_for_(range, invoker, dst.total() / (double)(1 << 16));
 }
 
+
+#include "resize_hresize.inc.hpp"
+#include "resize_bitexact.inc.hpp"
+
+int HResizeCubicVec_8u32s_AVX2(const uchar** src, int** dst, int count, const int* xofs,
+    const short* alpha, int swidth, int, int cn, int xmin, int xmax)
+{
+    return hresizeCubicVec_8u32s(src, dst, count, xofs, alpha, swidth, cn, xmin, xmax);
+}
+
+int HResizeLanczos4Vec_8u32s_AVX2(const uchar** src, int** dst, int count, const int* xofs,
+    const short* alpha, int swidth, int, int cn, int xmin, int xmax)
+{
+    return hresizeLanczos4Vec_8u32s(src, dst, count, xofs, alpha, swidth, cn, xmin, xmax);
+}
+
+int hlineResizeCubicExact_8u_AVX2(const uchar* src, int cn, const int* ofst, const int* m, int* dst,
+    int i, int dst_max, int dst_width)
+{
+    return hlineResizeCubicExact_8u(src, cn, ofst, m, dst, i, dst_max, dst_width);
+}
+
+int vlineResizeCubicExact_8u_AVX2(const int* src, size_t src_step, const int* beta, uchar* dst, int dst_width)
+{
+    return vlineResizeCubicExact_8u(src, src_step, beta, dst, dst_width);
+}
+
 }
 }
 /* End of file. */
@@ -70,6 +70,9 @@ template <bool needsign> struct fixedtype<int16_t, needsign> { typedef fixedpoin
 template <> struct fixedtype<uint16_t, false> { typedef ufixedpoint32 type; };
 template <bool needsign> struct fixedtype<int8_t, needsign> { typedef fixedpoint32 type; };
 template <> struct fixedtype<uint8_t, false> { typedef ufixedpoint16 type; };
+// signed coefficients (cubic) overshoot the source range, so the horizontal pass needs extra headroom
+template <> struct fixedtype<uint8_t, true> { typedef fixedpoint32 type; };
+template <> struct fixedtype<int16_t, true> { typedef fixedpoint64 type; };
 
 //FT is fixedtype<ET, needsign>::type
 template <typename ET, typename FT, int n, bool mulall>
@@ -236,7 +239,7 @@ template <typename ET, typename FT> struct hline<ET, FT, 4, true, 1>
         for (; i < dst_max; i++, m += 4)
         {
             ET* px = src + ofst[i];
-            *(dst++) = m[0] * src[0] + m[1] * src[1] + m[2] * src[2] + m[3] * src[3];
+            *(dst++) = m[0] * px[0] + m[1] * px[1] + m[2] * px[2] + m[3] * px[3];
         }
         src0 = (src + ofst[dst_width - 1])[0];
         for (; i < dst_width; i++) // Points that fall right from src image so became equal to rightmost src point
@@ -259,8 +262,8 @@ template <typename ET, typename FT> struct hline<ET, FT, 4, true, 2>
         for (; i < dst_max; i++, m += 4)
         {
             ET* px = src + 2*ofst[i];
-            *(dst++) = m[0] * src[0] + m[1] * src[2] + m[2] * src[4] + m[3] * src[6];
-            *(dst++) = m[0] * src[1] + m[1] * src[3] + m[2] * src[5] + m[3] * src[7];
+            *(dst++) = m[0] * px[0] + m[1] * px[2] + m[2] * px[4] + m[3] * px[6];
+            *(dst++) = m[0] * px[1] + m[1] * px[3] + m[2] * px[5] + m[3] * px[7];
         }
         src0 = (src + 2*ofst[dst_width - 1])[0];
         src1 = (src + 2*ofst[dst_width - 1])[1];
@@ -286,9 +289,9 @@ template <typename ET, typename FT> struct hline<ET, FT, 4, true, 3>
         for (; i < dst_max; i++, m += 4)
         {
             ET* px = src + 3*ofst[i];
-            *(dst++) = m[0] * src[0] + m[1] * src[3] + m[2] * src[6] + m[3] * src[ 9];
-            *(dst++) = m[0] * src[1] + m[1] * src[4] + m[2] * src[7] + m[3] * src[10];
-            *(dst++) = m[0] * src[2] + m[1] * src[5] + m[2] * src[8] + m[3] * src[11];
+            *(dst++) = m[0] * px[0] + m[1] * px[3] + m[2] * px[6] + m[3] * px[ 9];
+            *(dst++) = m[0] * px[1] + m[1] * px[4] + m[2] * px[7] + m[3] * px[10];
+            *(dst++) = m[0] * px[2] + m[1] * px[5] + m[2] * px[8] + m[3] * px[11];
         }
         src0 = (src + 3*ofst[dst_width - 1])[0];
         src1 = (src + 3*ofst[dst_width - 1])[1];
@@ -317,10 +320,10 @@ template <typename ET, typename FT> struct hline<ET, FT, 4, true, 4>
         for (; i < dst_max; i++, m += 4)
         {
             ET* px = src + 4*ofst[i];
-            *(dst++) = m[0] * src[0] + m[1] * src[4] + m[2] * src[ 8] + m[3] * src[12];
-            *(dst++) = m[0] * src[1] + m[1] * src[5] + m[2] * src[ 9] + m[3] * src[13];
-            *(dst++) = m[0] * src[2] + m[1] * src[6] + m[2] * src[10] + m[3] * src[14];
-            *(dst++) = m[0] * src[3] + m[1] * src[7] + m[2] * src[11] + m[3] * src[15];
+            *(dst++) = m[0] * px[0] + m[1] * px[4] + m[2] * px[ 8] + m[3] * px[12];
+            *(dst++) = m[0] * px[1] + m[1] * px[5] + m[2] * px[ 9] + m[3] * px[13];
+            *(dst++) = m[0] * px[2] + m[1] * px[6] + m[2] * px[10] + m[3] * px[14];
+            *(dst++) = m[0] * px[3] + m[1] * px[7] + m[2] * px[11] + m[3] * px[15];
         }
         src0 = (src + 4*ofst[dst_width - 1])[0];
         src1 = (src + 4*ofst[dst_width - 1])[1];
@@ -649,6 +652,122 @@ void hlineResizeCn<uint16_t, ufixedpoint32, 2, true, 1>(uint16_t* src, int, int
     }
 }
 
+#include "resize_bitexact.inc.hpp"
+
+// see resize_bitexact.inc.hpp for the layout of the coefficients and of the rows
+static int hlineResizeCubicExact_8u_dispatch(const uint8_t* src, int cn, const int* ofst, const fixedpoint32* m, fixedpoint32* dst,
+                                             int i, int dst_max, int dst_width)
+{
+#if CV_TRY_AVX2
+    if (CV_CPU_HAS_SUPPORT_AVX2)
+        return opt_AVX2::hlineResizeCubicExact_8u_AVX2(src, cn, ofst, (const int*)m, (int*)dst, i, dst_max, dst_width);
+#endif
+#if CV_TRY_SSE4_1
+    if (CV_CPU_HAS_SUPPORT_SSE4_1)
+        return opt_SSE4_1::hlineResizeCubicExact_8u_SSE4_1(src, cn, ofst, (const int*)m, (int*)dst, i, dst_max, dst_width);
+#endif
+    return hlineResizeCubicExact_8u(src, cn, ofst, (const int*)m, (int*)dst, i, dst_max, dst_width);
+}
+
+template <>
+void hlineResizeCn<uint8_t, fixedpoint32, 4, true, 1>(uint8_t* src, int, int *ofst, fixedpoint32* m, fixedpoint32* dst, int dst_min, int dst_max, int dst_width)
+{
+    int i = 0;
+    fixedpoint32 src_0(src[0]);
+    for (; i < dst_min; i++, m += 4) // Points that fall left from src image so became equal to leftmost src point
+    {
+        *(dst++) = src_0;
+    }
+    int i0 = i;
+    i = hlineResizeCubicExact_8u_dispatch(src, 1, ofst, m - 4*i0, dst - i0, i0, dst_max, dst_width);
+    m += 4*(i - i0);
+    dst += i - i0;
+    for (; i < dst_max; i++, m += 4)
+    {
+        uint8_t* px = src + ofst[i];
+        *(dst++) = m[0] * px[0] + m[1] * px[1] + m[2] * px[2] + m[3] * px[3];
+    }
+    src_0 = (src + ofst[dst_width - 1])[0];
+    for (; i < dst_width; i++) // Points that fall right from src image so became equal to rightmost src point
+    {
+        *(dst++) = src_0;
+    }
+}
+template <>
+void hlineResizeCn<uint8_t, fixedpoint32, 4, true, 3>(uint8_t* src, int, int *ofst, fixedpoint32* m, fixedpoint32* dst, int dst_min, int dst_max, int dst_width)
+{
+    int i = 0;
+    fixedpoint32 src_0(src[0]), src_1(src[1]), src_2(src[2]);
+    for (; i < dst_min; i++, m += 4) // Points that fall left from src image so became equal to leftmost src point
+    {
+        *(dst++) = src_0;
+        *(dst++) = src_1;
+        *(dst++) = src_2;
+    }
+    for (; i < dst_max && ofst[i] == 0; i++, m += 4) // the vector code reads one byte before the taps
+    {
+        *(dst++) = m[0] * src[0] + m[1] * src[3] + m[2] * src[6] + m[3] * src[ 9];
+        *(dst++) = m[0] * src[1] + m[1] * src[4] + m[2] * src[7] + m[3] * src[10];
+        *(dst++) = m[0] * src[2] + m[1] * src[5] + m[2] * src[8] + m[3] * src[11];
+    }
+    int i0 = i;
+    i = hlineResizeCubicExact_8u_dispatch(src, 3, ofst, m - 4*i0, dst - 3*i0, i0, dst_max, dst_width);
+    m += 4*(i - i0);
+    dst += 3*(i - i0);
+    for (; i < dst_max; i++, m += 4)
+    {
+        uint8_t* px = src + 3*ofst[i];
+        *(dst++) = m[0] * px[0] + m[1] * px[3] + m[2] * px[6] + m[3] * px[ 9];
+        *(dst++) = m[0] * px[1] + m[1] * px[4] + m[2] * px[7] + m[3] * px[10];
+        *(dst++) = m[0] * px[2] + m[1] * px[5] + m[2] * px[8] + m[3] * px[11];
+    }
+    src_0 = (src + 3*ofst[dst_width - 1])[0];
+    src_1 = (src + 3*ofst[dst_width - 1])[1];
+    src_2 = (src + 3*ofst[dst_width - 1])[2];
+    for (; i < dst_width; i++) // Points that fall right from src image so became equal to rightmost src point
+    {
+        *(dst++) = src_0;
+        *(dst++) = src_1;
+        *(dst++) = src_2;
+    }
+}
+template <>
+void hlineResizeCn<uint8_t, fixedpoint32, 4, true, 4>(uint8_t* src, int, int *ofst, fixedpoint32* m, fixedpoint32* dst, int dst_min, int dst_max, int dst_width)
+{
+    int i = 0;
+    fixedpoint32 src_0(src[0]), src_1(src[1]), src_2(src[2]), src_3(src[3]);
+    for (; i < dst_min; i++, m += 4) // Points that fall left from src image so became equal to leftmost src point
+    {
+        *(dst++) = src_0;
+        *(dst++) = src_1;
+        *(dst++) = src_2;
+        *(dst++) = src_3;
+    }
+    int i0 = i;
+    i = hlineResizeCubicExact_8u_dispatch(src, 4, ofst, m - 4*i0, dst - 4*i0, i0, dst_max, dst_width);
+    m += 4*(i - i0);
+    dst += 4*(i - i0);
+    for (; i < dst_max; i++, m += 4)
+    {
+        uint8_t* px = src + 4*ofst[i];
+        *(dst++) = m[0] * px[0] + m[1] * px[4] + m[2] * px[ 8] + m[3] * px[12];
+        *(dst++) = m[0] * px[1] + m[1] * px[5] + m[2] * px[ 9] + m[3] * px[13];
+        *(dst++) = m[0] * px[2] + m[1] * px[6] + m[2] * px[10] + m[3] * px[14];
+        *(dst++) = m[0] * px[3] + m[1] * px[7] + m[2] * px[11] + m[3] * px[15];
+    }
+    src_0 = (src + 4*ofst[dst_width - 1])[0];
+    src_1 = (src + 4*ofst[dst_width - 1])[1];
+    src_2 = (src + 4*ofst[dst_width - 1])[2];
+    src_3 = (src + 4*ofst[dst_width - 1])[3];
+    for (; i < dst_width; i++) // Points that fall right from src image so became equal to rightmost src point
+    {
+        *(dst++) = src_0;
+        *(dst++) = src_1;
+        *(dst++) = src_2;
+        *(dst++) = src_3;
+    }
+}
+
 template <typename ET, typename FT>
 void vlineSet(FT* src, ET* dst, int dst_width)
 {
@@ -730,6 +849,30 @@ void vlineResize<uint8_t, ufixedpoint16, 2>(ufixedpoint16* src, size_t src_step,
     }
 }
 
+template <>
+void vlineResize<uint8_t, fixedpoint32, 4>(fixedpoint32* src, size_t src_step, fixedpoint32* m, uint8_t* dst, int dst_width)
+{
+    int b[4] = { m[0].raw() >> 5, m[1].raw() >> 5, m[2].raw() >> 5, m[3].raw() >> 5 };
+    int i;
+#if CV_TRY_AVX2
+    if (CV_CPU_HAS_SUPPORT_AVX2)
+        i = opt_AVX2::vlineResizeCubicExact_8u_AVX2((const int*)src, src_step, b, dst, dst_width);
+    else
+#endif
+#if CV_TRY_SSE4_1
+    if (CV_CPU_HAS_SUPPORT_SSE4_1)
+        i = opt_SSE4_1::vlineResizeCubicExact_8u_SSE4_1((const int*)src, src_step, b, dst, dst_width);
+    else
+#endif
+        i = vlineResizeCubicExact_8u((const int*)src, src_step, b, dst, dst_width);
+    const int32_t* src0 = (const int32_t*)src;
+    const int32_t* src1 = src0 + src_step;
+    const int32_t* src2 = src1 + src_step;
+    const int32_t* src3 = src2 + src_step;
+    for (; i < dst_width; i++)
+        dst[i] = saturate_cast<uint8_t>(((src0[i] >> 10)*b[0] + (src1[i] >> 10)*b[1] + (src2[i] >> 10)*b[2] + (src3[i] >> 10)*b[3] + (1 << 16)) >> 17);
+}
+
 template <typename ET> class interpolationLinear
 {
 public:
@@ -771,6 +914,74 @@ protected:
     int minofst, maxofst;
 };
 
+// Keys' bicubic kernel (A = -0.75, the same as in INTER_CUBIC). The weights are evaluated in integer arithmetic for
+// the fractional position rounded to 16 bits, the taps that fall outside of the source image are folded into the
+// nearest border tap (BORDER_REPLICATE), after that the weights are rounded so that their sum is exactly one.
+template <typename ET> class interpolationCubic
+{
+public:
+    static const int len = 4;
+    static const bool needsign = true;
+    interpolationCubic(double inv_scale, int srcsize, int dstsize) : scale(softdouble::one() / softdouble(inv_scale)), maxsize(srcsize), minofst(0), maxofst(dstsize) {}
+    void getCoeffs(int val, int* offset, typename fixedtype<ET, needsign>::type* coeffs)
+    {
+        typedef typename fixedtype<ET, needsign>::type fixedpoint;
+        // 8-bit values use the precision of INTER_CUBIC coefficients, this keeps the products in 16 bits for SIMD
+        const int coeffbits = sizeof(ET) == 1 ? 11 : fixedpoint::fixedShift;
+        softdouble fval = scale*(softdouble(val)+softdouble(0.5))-softdouble(0.5);
+        int ival = cvFloor(fval);
+        if (ival + 2 <= 0 || ival > maxsize - 1)
+        {
+            *offset = ival + 2 <= 0 ? 0 : maxsize - 1;
+            coeffs[0] = fixedpoint::one();
+            for (int k = 1; k < len; k++)
+                coeffs[k] = fixedpoint::zero();
+            if (ival + 2 <= 0)
+                minofst = max(minofst, val + 1);
+            else
+                maxofst = min(maxofst, val);
+            return;
+        }
+
+        // 4*w(x) with 48 fractional bits: w0 = A*x*(1-x)^2, w1 = (A+2)*x^3 - (A+3)*x^2 + 1, w2 = w1(1-x), w3 = 1-w0-w1-w2
+        const int64_t x = cvRound((fval - softdouble(ival))*softdouble(1 << 16)), y = (1 << 16) - x;
+        const int64_t one = (int64_t)4 << 48;
+        int64_t w[len];
+        w[0] = -3*x*y*y;
+        w[1] = 5*x*x*x - 9*(x*x << 16) + one;
+        w[2] = 5*y*y*y - 9*(y*y << 16) + one;
+        w[3] = one - w[0] - w[1] - w[2];
+
+        int ofs = min(max(ival - 1, 0), max(maxsize - len, 0));
+        int64_t q[len] = { 0, 0, 0, 0 };
+        for (int k = 0; k < len; k++)
+            q[min(max(ival - 1 + k, 0), maxsize - 1) - ofs] += w[k];
+
+        const int shift = 50 - coeffbits;
+        int64_t sum = 0;
+        int kmax = 0;
+        for (int k = 0; k < len; k++)
+        {
+            q[k] = (q[k] + ((int64_t)1 << (shift - 1))) >> shift;
+            sum += q[k];
+            kmax = q[k] > q[kmax] ? k : kmax;
+        }
+        q[kmax] += ((int64_t)1 << coeffbits) - sum;
+        *offset = ofs;
+        for (int k = 0; k < len; k++)
+            coeffs[k] = fixedpoint::fromRaw((typename fixedpoint::raw_t)(q[k] << (fixedpoint::fixedShift - coeffbits)));
+    }
+    void getMinMax(int &min, int &max)
+    {
+        min = minofst;
+        max = maxofst;
+    }
+protected:
+    softdouble scale;
+    int maxsize;
+    int minofst, maxofst;
+};
+
 template <typename ET, typename FT, int interp_y_len>
 class resize_bitExactInvoker :
     public ParallelLoopBody
@@ -790,6 +1001,8 @@ public:
     virtual void operator() (const Range& range) const CV_OVERRIDE
     {
         AutoBuffer<fixedpoint> linebuf(interp_y_len * dst_width * cn);
+        if (src_height < interp_y_len) // the rows below the image are multiplied by zero coefficients
+            memset((void*)linebuf.data(), 0, interp_y_len * dst_width * cn * sizeof(fixedpoint));
         int last_eval = - interp_y_len;
         int evalbuf_start = 0;
         int rmin_y = max(min_y, range.start);
@@ -849,51 +1062,139 @@ private:
     resize_bitExactInvoker& operator=(const resize_bitExactInvoker&);
 };
 
+struct be_resize_tab
+{
+    AutoBuffer<uchar> buf;
+    int *xoffsets, *yoffsets;
+    void *xcoeffs, *ycoeffs;
+    int min_x, max_x, min_y, max_y;
+};
+
 template <typename ET, typename interpolation>
-void resize_bitExact(const uchar* src, size_t src_step, int src_width, int src_height,
-                           uchar* dst, size_t dst_step, int dst_width, int dst_height,
-                     int cn, double inv_scale_x, double inv_scale_y)
+void resize_bitExactTab(int src_width, int src_height, int dst_width, int dst_height,
+                        double inv_scale_x, double inv_scale_y, be_resize_tab& tab)
 {
     typedef typename fixedtype<ET, interpolation::needsign>::type fixedpoint;
-    void(*hResize)(ET* src, int cn, int *ofst, fixedpoint* m, fixedpoint* dst, int dst_min, int dst_max, int dst_width);
-    switch (cn)
-    {
-    case  1: hResize = src_width > interpolation::len ? hlineResizeCn<ET, fixedpoint, interpolation::len, true, 1> : hlineResizeCn<ET, fixedpoint, interpolation::len, false, 1>; break;
-    case  2: hResize = src_width > interpolation::len ? hlineResizeCn<ET, fixedpoint, interpolation::len, true, 2> : hlineResizeCn<ET, fixedpoint, interpolation::len, false, 2>; break;
-    case  3: hResize = src_width > interpolation::len ? hlineResizeCn<ET, fixedpoint, interpolation::len, true, 3> : hlineResizeCn<ET, fixedpoint, interpolation::len, false, 3>; break;
-    case  4: hResize = src_width > interpolation::len ? hlineResizeCn<ET, fixedpoint, interpolation::len, true, 4> : hlineResizeCn<ET, fixedpoint, interpolation::len, false, 4>; break;
-    default: hResize = src_width > interpolation::len ? hlineResize<ET, fixedpoint, interpolation::len, true>      : hlineResize<ET, fixedpoint, interpolation::len, false>     ; break;
-    }
 
     interpolation interp_x(inv_scale_x, src_width, dst_width);
     interpolation interp_y(inv_scale_y, src_height, dst_height);
 
-    AutoBuffer<uchar> buf( dst_width * sizeof(int) +
-                           dst_height * sizeof(int) +
-                           dst_width * interp_x.len*sizeof(fixedpoint) +
-                           dst_height * interp_y.len * sizeof(fixedpoint) );
-    int* xoffsets = (int*)buf.data();
+    tab.buf.allocate( dst_width * sizeof(int) +
+                      dst_height * sizeof(int) +
+                      dst_width * interp_x.len*sizeof(fixedpoint) +
+                      dst_height * interp_y.len * sizeof(fixedpoint) );
+    int* xoffsets = (int*)tab.buf.data();
     int* yoffsets = xoffsets + dst_width;
     fixedpoint* xcoeffs = (fixedpoint*)(yoffsets + dst_height);
     fixedpoint* ycoeffs = xcoeffs + dst_width * interp_x.len;
 
-    int min_x, max_x, min_y, max_y;
     for (int dx = 0; dx < dst_width; dx++)
         interp_x.getCoeffs(dx, xoffsets+dx, xcoeffs+dx*interp_x.len);
-    interp_x.getMinMax(min_x, max_x);
+    interp_x.getMinMax(tab.min_x, tab.max_x);
     for (int dy = 0; dy < dst_height; dy++)
         interp_y.getCoeffs(dy, yoffsets+dy, ycoeffs+dy*interp_y.len);
-    interp_y.getMinMax(min_y, max_y);
+    interp_y.getMinMax(tab.min_y, tab.max_y);
+
+    tab.xoffsets = xoffsets;
+    tab.yoffsets = yoffsets;
+    tab.xcoeffs = xcoeffs;
+    tab.ycoeffs = ycoeffs;
+}
+
+template <typename ET, typename interpolation>
+struct be_hresize
+{
+    typedef typename fixedtype<ET, interpolation::needsign>::type fixedpoint;
+    typedef void(*func)(ET* src, int cn, int *ofst, fixedpoint* m, fixedpoint* dst, int dst_min, int dst_max, int dst_width);
+
+    static func get(int cn, int src_width)
+    {
+        switch (cn)
+        {
+        case  1: return src_width > interpolation::len ? hlineResizeCn<ET, fixedpoint, interpolation::len, true, 1> : hlineResizeCn<ET, fixedpoint, interpolation::len, false, 1>;
+        case  2: return src_width > interpolation::len ? hlineResizeCn<ET, fixedpoint, interpolation::len, true, 2> : hlineResizeCn<ET, fixedpoint, interpolation::len, false, 2>;
+        case  3: return src_width > interpolation::len ? hlineResizeCn<ET, fixedpoint, interpolation::len, true, 3> : hlineResizeCn<ET, fixedpoint, interpolation::len, false, 3>;
+        case  4: return src_width > interpolation::len ? hlineResizeCn<ET, fixedpoint, interpolation::len, true, 4> : hlineResizeCn<ET, fixedpoint, interpolation::len, false, 4>;
+        default: return src_width > interpolation::len ? hlineResize<ET, fixedpoint, interpolation::len, true>      : hlineResize<ET, fixedpoint, interpolation::len, false>     ;
+        }
+    }
+};
 
+template <typename ET, typename interpolation>
+void resize_bitExactRun(const be_resize_tab& tab,
+                        const uchar* src, size_t src_step, int src_width, int src_height,
+                              uchar* dst, size_t dst_step, int dst_width, int dst_height, int cn,
+                        const Range& range)
+{
+    typedef typename fixedtype<ET, interpolation::needsign>::type fixedpoint;
     resize_bitExactInvoker<ET, fixedpoint, interpolation::len> invoker(src, src_step, src_width, src_height, dst, dst_step, dst_width, dst_height, cn,
-                                                                       xoffsets, yoffsets, xcoeffs, ycoeffs, min_x, max_x, min_y, max_y, hResize);
-    Range range(0, dst_height);
+                                                                       tab.xoffsets, tab.yoffsets, (fixedpoint*)tab.xcoeffs, (fixedpoint*)tab.ycoeffs,
+                                                                       tab.min_x, tab.max_x, tab.min_y, tab.max_y,
+                                                                       be_hresize<ET, interpolation>::get(cn, src_width));
     parallel_for_(range, invoker, dst_width * dst_height / (double)(1 << 16));
 }
 
-typedef void(*be_resize_func)(const uchar* src, size_t src_step, int src_width, int src_height,
-                                    uchar* dst, size_t dst_step, int dst_width, int dst_height,
-                              int cn, double inv_scale_x, double inv_scale_y);
+// single-row passes of resize_bitExactRun, used by the row-streaming resize.
+// rows holds interpolation::len horizontally resized rows, the row yoffsets[dy] is stored at index 'first'
+template <typename ET, typename interpolation>
+void resize_bitExactHRow(const be_resize_tab& tab, const uchar* src, int src_width, int dst_width, int cn, void* buf)
+{
+    typedef typename fixedtype<ET, interpolation::needsign>::type fixedpoint;
+    be_hresize<ET, interpolation>::get(cn, src_width)((ET*)src, cn, tab.xoffsets, (fixedpoint*)tab.xcoeffs,
+                                                      (fixedpoint*)buf, tab.min_x, tab.max_x, dst_width);
+}
+
+template <typename ET, typename interpolation>
+void resize_bitExactVRow(const be_resize_tab& tab, const void* rows, int first, int dy, uchar* dst, int dst_width, int cn)
+{
+    typedef typename fixedtype<ET, interpolation::needsign>::type fixedpoint;
+    const fixedpoint* ycoeffs = (const fixedpoint*)tab.ycoeffs + dy*interpolation::len;
+    fixedpoint curcoeffs[interpolation::len];
+    for (int i = 0; i < interpolation::len; i++)
+        curcoeffs[(first + i) % interpolation::len] = ycoeffs[i];
+    vlineResize<ET, fixedpoint, interpolation::len>((fixedpoint*)rows, dst_width*cn, curcoeffs, (ET*)dst, dst_width*cn);
+}
+
+template <typename ET, typename interpolation>
+void resize_bitExactSetRow(const void* row, uchar* dst, int dst_width, int cn)
+{
+    typedef typename fixedtype<ET, interpolation::needsign>::type fixedpoint;
+    vlineSet<ET, fixedpoint>((fixedpoint*)row, (ET*)dst, dst_width*cn);
+}
+
+typedef void(*be_resize_tab_func)(int src_width, int src_height, int dst_width, int dst_height,
+                                  double inv_scale_x, double inv_scale_y, be_resize_tab& tab);
+
+typedef void(*be_resize_run_func)(const be_resize_tab& tab,
+                                  const uchar* src, size_t src_step, int src_width, int src_height,
+                                        uchar* dst, size_t dst_step, int dst_width, int dst_height, int cn,
+                                  const Range& range);
+
+typedef void(*be_resize_hrow_func)(const be_resize_tab& tab, const uchar* src, int src_width, int dst_width, int cn, void* buf);
+
+typedef void(*be_resize_vrow_func)(const be_resize_tab& tab, const void* rows, int first, int dy, uchar* dst, int dst_width, int cn);
+
+typedef void(*be_resize_setrow_func)(const void* row, uchar* dst, int dst_width, int cn);
+
+struct be_resize_funcs
+{
+    be_resize_tab_func tab;
+    be_resize_run_func run;
+    be_resize_hrow_func hrow;
+    be_resize_vrow_func vrow;
+    be_resize_setrow_func setrow;
+    int len, bufelemsize;
+};
+
+template <typename ET, typename interpolation>
+be_resize_funcs resize_bitExactFuncs()
+{
+    be_resize_funcs f = { resize_bitExactTab<ET, interpolation>, resize_bitExactRun<ET, interpolation>,
+                          resize_bitExactHRow<ET, interpolation>, resize_bitExactVRow<ET, interpolation>,
+                          resize_bitExactSetRow<ET, interpolation>, interpolation::len,
+                          (int)sizeof(typename fixedtype<ET, interpolation::needsign>::type) };
+    return f;
+}
 
 }
 
@@ -1063,22 +1364,20 @@ private:
 };
 
 static void
-resizeNN( const Mat& src, Mat& dst, double fx, double fy )
+computeResizeNNTab( int ssize, int dsize, int pix_size, double fx, int* x_ofs )
 {
-    Size ssize = src.size(), dsize = dst.size();
-    AutoBuffer<int> _x_ofs(dsize.width);
-    int* x_ofs = _x_ofs.data();
-    int pix_size = (int)src.elemSize();
-    double ifx = 1./fx, ify = 1./fy;
-    int x;
-
-    for( x = 0; x < dsize.width; x++ )
+    double ifx = 1./fx;
+    for( int x = 0; x < dsize; x++ )
     {
         int sx = cvFloor(x*ifx);
-        x_ofs[x] = std::min(sx, ssize.width-1)*pix_size;
+        x_ofs[x] = std::min(sx, ssize-1)*pix_size;
     }
+}
 
-    Range range(0, dsize.height);
+static void
+resizeNN( const Mat& src, Mat& dst, int* x_ofs, double ify, const Range& range )
+{
+    int pix_size = (int)src.elemSize();
 #if CV_TRY_AVX2
     if(CV_CPU_HAS_SUPPORT_AVX2 && ((pix_size == 2) || (pix_size == 4)))
     {
@@ -1208,25 +1507,24 @@ private:
     const int ify0;
 };
 
-static void resizeNN_bitexact( const Mat& src, Mat& dst, double /*fx*/, double /*fy*/ )
+static void computeResizeNNBitexactTab( int ssize, int dsize, int* x_ofse )
 {
-    Size ssize = src.size(), dsize = dst.size();
-    int ifx = ((ssize.width << 16) + dsize.width / 2) / dsize.width; // 16bit fixed-point arithmetic
-    int ifx0 = ifx / 2 - ssize.width % 2;                       // This method uses center pixel coordinate as Pillow and scikit-images do.
-    int ify = ((ssize.height << 16) + dsize.height / 2) / dsize.height;
-    int ify0 = ify / 2 - ssize.height % 2;
+    int ifx = ((ssize << 16) + dsize / 2) / dsize; // 16bit fixed-point arithmetic
+    int ifx0 = ifx / 2 - ssize % 2;                 // This method uses center pixel coordinate as Pillow and scikit-images do.
 
-    cv::utils::BufferArea area;
-    int* x_ofse = 0;
-    area.allocate(x_ofse, dsize.width, CV_SIMD_WIDTH);
-    area.commit();
-
-    for( int x = 0; x < dsize.width; x++ )
+    for( int x = 0; x < dsize; x++ )
     {
         int sx = (ifx * x + ifx0) >> 16;
-        x_ofse[x] = std::min(sx, ssize.width-1);    // offset in element (not byte)
+        x_ofse[x] = std::min(sx, ssize-1);    // offset in element (not byte)
     }
-    Range range(0, dsize.height);
+}
+
+static void resizeNN_bitexact( const Mat& src, Mat& dst, int* x_ofse, const Range& range )
+{
+    Size ssize = src.size(), dsize = dst.size();
+    int ify = ((ssize.height << 16) + dsize.height / 2) / dsize.height;
+    int ify0 = ify / 2 - ssize.height % 2;
+
     resizeNN_bitexactInvoker invoker(src, dst, x_ofse, ify, ify0);
     parallel_for_(range, invoker, dst.total()/(double)(1<<16));
 }
@@ -1817,6 +2115,110 @@ typedef HResizeNoVec HResizeLinearVec_32f;
 
 typedef HResizeNoVec HResizeLinearVec_64f;
 
+// The horizontal cubic/Lanczos4 kernels live in resize.avx2.cpp/resize.sse4_1.cpp
+// (see resize_hresize.inc.hpp). They process the interior part of the row
+// and return the first unprocessed dx; the baseline build keeps the scalar loop.
+// The 16U/16S ones are not built for AVX2: with FMA the compiler fuses the float
+// multiply-adds, and the results would differ from the scalar loop.
+
+struct HResizeCubicVec_8u32s
+{
+    int operator()(const uchar** src, int** dst, int count, const int* xofs,
+        const short* alpha, int swidth, int dwidth, int cn, int xmin, int xmax) const
+    {
+#if CV_TRY_AVX2
+        if (CV_CPU_HAS_SUPPORT_AVX2)
+            return opt_AVX2::HResizeCubicVec_8u32s_AVX2(src, dst, count, xofs, alpha, swidth, dwidth, cn, xmin, xmax);
+#endif
+#if CV_TRY_SSE4_1
+        if (CV_CPU_HAS_SUPPORT_SSE4_1)
+            return opt_SSE4_1::HResizeCubicVec_8u32s_SSE4_1(src, dst, count, xofs, alpha, swidth, dwidth, cn, xmin, xmax);
+#endif
+        CV_UNUSED(src); CV_UNUSED(dst); CV_UNUSED(count); CV_UNUSED(xofs); CV_UNUSED(alpha);
+        CV_UNUSED(swidth); CV_UNUSED(dwidth); CV_UNUSED(cn); CV_UNUSED(xmax);
+        return xmin;
+    }
+};
+
+struct HResizeCubicVec_16u32f
+{
+    int operator()(const ushort** src, float** dst, int count, const int* xofs,
+        const float* alpha, int swidth, int dwidth, int cn, int xmin, int xmax) const
+    {
+#if CV_TRY_SSE4_1
+        if (CV_CPU_HAS_SUPPORT_SSE4_1)
+            return opt_SSE4_1::HResizeCubicVec_16u32f_SSE4_1(src, dst, count, xofs, alpha, swidth, dwidth, cn, xmin, xmax);
+#endif
+        CV_UNUSED(src); CV_UNUSED(dst); CV_UNUSED(count); CV_UNUSED(xofs); CV_UNUSED(alpha);
+        CV_UNUSED(swidth); CV_UNUSED(dwidth); CV_UNUSED(cn); CV_UNUSED(xmax);
+        return xmin;
+    }
+};
+
+struct HResizeCubicVec_16s32f
+{
+    int operator()(const short** src, float** dst, int count, const int* xofs,
+        const float* alpha, int swidth, int dwidth, int cn, int xmin, int xmax) const
+    {
+#if CV_TRY_SSE4_1
+        if (CV_CPU_HAS_SUPPORT_SSE4_1)
+            return opt_SSE4_1::HResizeCubicVec_16s32f_SSE4_1(src, dst, count, xofs, alpha, swidth, dwidth, cn, xmin, xmax);
+#endif
+        CV_UNUSED(src); CV_UNUSED(dst); CV_UNUSED(count); CV_UNUSED(xofs); CV_UNUSED(alpha);
+        CV_UNUSED(swidth); CV_UNUSED(dwidth); CV_UNUSED(cn); CV_UNUSED(xmax);
+        return xmin;
+    }
+};
+
+struct HResizeLanczos4Vec_8u32s
+{
+    int operator()(const uchar** src, int** dst, int count, const int* xofs,
+        const short* alpha, int swidth, int dwidth, int cn, int xmin, int xmax) const
+    {
+#if CV_TRY_AVX2
+        if (CV_CPU_HAS_SUPPORT_AVX2)
+            return opt_AVX2::HResizeLanczos4Vec_8u32s_AVX2(src, dst, count, xofs, alpha, swidth, dwidth, cn, xmin, xmax);
+#endif
+#if CV_TRY_SSE4_1
+        if (CV_CPU_HAS_SUPPORT_SSE4_1)
+            return opt_SSE4_1::HResizeLanczos4Vec_8u32s_SSE4_1(src, dst, count, xofs, alpha, swidth, dwidth, cn, xmin, xmax);
+#endif
+        CV_UNUSED(src); CV_UNUSED(dst); CV_UNUSED(count); CV_UNUSED(xofs); CV_UNUSED(alpha);
+        CV_UNUSED(swidth); CV_UNUSED(dwidth); CV_UNUSED(cn); CV_UNUSED(xmax);
+        return xmin;
+    }
+};
+
+struct HResizeLanczos4Vec_16u32f
+{
+    int operator()(const ushort** src, float** dst, int count, const int* xofs,
+        const float* alpha, int swidth, int dwidth, int cn, int xmin, int xmax) const
+    {
+#if CV_TRY_SSE4_1
+        if (CV_CPU_HAS_SUPPORT_SSE4_1)
+            return opt_SSE4_1::HResizeLanczos4Vec_16u32f_SSE4_1(src, dst, count, xofs, alpha, swidth, dwidth, cn, xmin, xmax);
+#endif
+        CV_UNUSED(src); CV_UNUSED(dst); CV_UNUSED(count); CV_UNUSED(xofs); CV_UNUSED(alpha);
+        CV_UNUSED(swidth); CV_UNUSED(dwidth); CV_UNUSED(cn); CV_UNUSED(xmax);
+        return xmin;
+    }
+};
+
+struct HResizeLanczos4Vec_16s32f
+{
+    int operator()(const short** src, float** dst, int count, const int* xofs,
+        const float* alpha, int swidth, int dwidth, int cn, int xmin, int xmax) const
+    {
+#if CV_TRY_SSE4_1
+        if (CV_CPU_HAS_SUPPORT_SSE4_1)
+            return opt_SSE4_1::HResizeLanczos4Vec_16s32f_SSE4_1(src, dst, count, xofs, alpha, swidth, dwidth, cn, xmin, xmax);
+#endif
+        CV_UNUSED(src); CV_UNUSED(dst); CV_UNUSED(count); CV_UNUSED(xofs); CV_UNUSED(alpha);
+        CV_UNUSED(swidth); CV_UNUSED(dwidth); CV_UNUSED(cn); CV_UNUSED(xmax);
+        return xmin;
+    }
+};
+
 
 template<typename T, typename WT, typename AT, int ONE, class VecOp>
 struct HResizeLinear
@@ -1933,7 +2335,7 @@ struct VResizeLinear<uchar, int, short, FixedPtCast<int, uchar, INTER_RESIZE_COE
 };
 
 
-template<typename T, typename WT, typename AT>
+template<typename T, typename WT, typename AT, class VecOp>
 struct HResizeCubic
 {
     typedef T value_type;
@@ -1944,6 +2346,10 @@ struct HResizeCubic
                     const int* xofs, const AT* alpha,
                     int swidth, int dwidth, int cn, int xmin, int xmax ) const
     {
+        VecOp vecOp;
+        int dx0 = std::max(vecOp(src, dst, count,
+            xofs, alpha, swidth, dwidth, cn, xmin, xmax ), xmin);
+
         for( int k = 0; k < count; k++ )
         {
             const T *S = src[k];
@@ -1971,7 +2377,8 @@ struct HResizeCubic
                 }
                 if( limit == dwidth )
                     break;
-                for( ; dx < xmax; dx++, alpha += 4 )
+                alpha += (dx0 - dx)*4;
+                for( dx = dx0; dx < xmax; dx++, alpha += 4 )
                 {
                     int sx = xofs[dx];
                     D[dx] = S[sx-cn]*alpha[0] + S[sx]*alpha[1] +
@@ -2006,7 +2413,7 @@ struct VResizeCubic
 };
 
 
-template<typename T, typename WT, typename AT>
+template<typename T, typename WT, typename AT, class VecOp>
 struct HResizeLanczos4
 {
     typedef T value_type;
@@ -2017,6 +2424,10 @@ struct HResizeLanczos4
                     const int* xofs, const AT* alpha,
                     int swidth, int dwidth, int cn, int xmin, int xmax ) const
     {
+        VecOp vecOp;
+        int dx0 = std::max(vecOp(src, dst, count,
+            xofs, alpha, swidth, dwidth, cn, xmin, xmax ), xmin);
+
         for( int k = 0; k < count; k++ )
         {
             const T *S = src[k];
@@ -2044,7 +2455,8 @@ struct HResizeLanczos4
                 }
                 if( limit == dwidth )
                     break;
-                for( ; dx < xmax; dx++, alpha += 8 )
+                alpha += (dx0 - dx)*8;
+                for( dx = dx0; dx < xmax; dx++, alpha += 8 )
                 {
                     int sx = xofs[dx];
                     D[dx] = S[sx-cn*3]*alpha[0] + S[sx-cn*2]*alpha[1] +
@@ -2132,44 +2544,43 @@ public:
         HResize hresize;
         VResize vresize;
 
+        // the horizontally resized rows live in a ring of ksize slots; source row sy always goes to
+        // slot sy % ksize. The clipped rows of one vertical window are consecutive, so they never
+        // share a slot, and when the window slides only the rows that entered it are computed.
+        // Each source row is thus filtered once per stripe and the ring is never copied around.
         int bufstep = (int)alignSize(dsize.width, 16);
         AutoBuffer<WT> _buffer(bufstep*ksize);
         const T* srows[MAX_ESIZE]={0};
-        WT* rows[MAX_ESIZE]={0};
-        int prev_sy[MAX_ESIZE];
+        WT* drows[MAX_ESIZE]={0};
+        const WT* rows[MAX_ESIZE]={0};
+        int ring_sy[MAX_ESIZE];
 
         for(int k = 0; k < ksize; k++ )
-        {
-            prev_sy[k] = -1;
-            rows[k] = _buffer.data() + bufstep*k;
-        }
+            ring_sy[k] = -1;
 
         const AT* beta = _beta + ksize * range.start;
 
         for( dy = range.start; dy < range.end; dy++, beta += ksize )
         {
-            int sy0 = yofs[dy], k0=ksize, k1=0, ksize2 = ksize/2;
+            int sy0 = yofs[dy], ksize2 = ksize/2, count = 0;
 
             for(int k = 0; k < ksize; k++ )
             {
                 int sy = clip(sy0 - ksize2 + 1 + k, 0, ssize.height);
-                for( k1 = std::max(k1, k); k1 < ksize; k1++ )
+                int slot = sy % ksize;
+                WT* row = _buffer.data() + bufstep*slot;
+                if( ring_sy[slot] != sy )
                 {
-                    if( k1 < MAX_ESIZE && sy == prev_sy[k1] ) // if the sy-th row has been computed already, reuse it.
-                    {
-                        if( k1 > k )
-                            memcpy( rows[k], rows[k1], bufstep*sizeof(rows[0][0]) );
-                        break;
-                    }
+                    ring_sy[slot] = sy;
+                    srows[count] = src.template ptr<T>(sy);
+                    drows[count++] = row;
                 }
-                if( k1 == ksize )
-                    k0 = std::min(k0, k); // remember the first row that needs to be computed
-                srows[k] = src.template ptr<T>(sy);
-                prev_sy[k] = sy;
+                rows[k] = row;
             }
 
-            if( k0 < ksize )
-                hresize( (const T**)(srows + k0), (WT**)(rows + k0), ksize - k0, xofs, (const AT*)(alpha),
+            // the first window of a stripe fills the whole ring with a single call
+            if( count > 0 )
+                hresize( (const T**)srows, (WT**)drows, count, xofs, (const AT*)(alpha),
                         ssize.width, dsize.width, cn, xmin, xmax );
             vresize( (const WT**)rows, (T*)(dst.data + dst.step*dy), beta, dsize.width );
         }
@@ -2190,7 +2601,7 @@ template<class HResize, class VResize>
 static void resizeGeneric_( const Mat& src, Mat& dst,
                             const int* xofs, const void* _alpha,
                             const int* yofs, const void* _beta,
-                            int xmin, int xmax, int ksize )
+                            int xmin, int xmax, int ksize, const Range& range )
 {
     typedef typename HResize::alpha_type AT;
 
@@ -2203,10 +2614,45 @@ static void resizeGeneric_( const Mat& src, Mat& dst,
     xmax *= cn;
     // image resize is a separable operation. In case of not too strong
 
-    Range range(0, dsize.height);
     resizeGeneric_Invoker<HResize, VResize> invoker(src, dst, xofs, yofs, (const AT*)_alpha, beta,
         ssize, dsize, ksize, xmin, xmax);
-    parallel_for_(range, invoker, dst.total()/(double)(1<<16));
+    // every stripe has to compute the ksize-1 source rows preceding its first window again,
+    // so keep stripes tall enough for this overlap to stay small compared to the stripe itself
+    double nstripes = dst.total()/(double)(1<<16);
+    if( ksize > 2 && !range.empty() )
+    {
+        int srows = std::min(yofs[range.end-1], ssize.height) - std::max(yofs[range.start], 0) + ksize;
+        nstripes = std::min(nstripes, std::max(1., srows/(4.*ksize)));
+    }
+    parallel_for_(range, invoker, nstripes);
+}
+
+// single-row horizontal and vertical passes of resizeGeneric_, used by the row-streaming resize.
+// the widths and xmin/xmax are already multiplied by the number of channels
+template<class HResize, class VResize>
+static void resizeGenericHRow_( const uchar* src, uchar* buf,
+                                const int* xofs, const void* _alpha,
+                                int swidth, int dwidth, int cn, int xmin, int xmax )
+{
+    typedef typename HResize::value_type T;
+    typedef typename HResize::buf_type WT;
+    typedef typename HResize::alpha_type AT;
+
+    const T* S = (const T*)src;
+    WT* D = (WT*)buf;
+    HResize hresize;
+    hresize( &S, &D, 1, xofs, (const AT*)_alpha, swidth, dwidth, cn, xmin, xmax );
+}
+
+template<class HResize, class VResize>
+static void resizeGenericVRow_( const uchar** rows, uchar* dst, const void* _beta, int dwidth )
+{
+    typedef typename HResize::value_type T;
+    typedef typename HResize::buf_type WT;
+    typedef typename HResize::alpha_type AT;
+
+    VResize vresize;
+    vresize( (const WT**)rows, (T*)dst, (const AT*)_beta, dwidth );
 }
 
 template <typename T, typename WT>
@@ -3004,9 +3450,8 @@ private:
 
 template<typename T, typename WT, typename VecOp>
 static void resizeAreaFast_( const Mat& src, Mat& dst, const int* ofs, const int* xofs,
-                             int scale_x, int scale_y )
+                             int scale_x, int scale_y, const Range& range )
 {
-    Range range(0, dst.rows);
     resizeAreaFast_Invoker<T, WT, VecOp> invoker(src, dst, scale_x,
         scale_y, ofs, xofs);
     parallel_for_(range, invoker, dst.total()/(double)(1<<16));
@@ -3124,25 +3569,89 @@ inline void muladd(const WT* buf, int width, WT beta, WT* sum) {
 
 }  // namespace inter_area
 
-template<typename T, typename WT> class ResizeArea_Invoker :
-    public ParallelLoopBody
+// horizontal pass of the generic INTER_AREA resize for a single source row
+template<typename T, typename WT>
+static void resizeAreaHPass( const T* S, WT* buf, const DecimateAlpha* xtab, int xtab_size, int cn, int width )
 {
-public:
-    ResizeArea_Invoker( const Mat& _src, Mat& _dst,
-                        const DecimateAlpha* _xtab, int _xtab_size,
-                        const DecimateAlpha* _ytab, int _ytab_size,
-                        const int* _tabofs )
-    {
-        src = &_src;
-        dst = &_dst;
-        xtab0 = _xtab;
-        xtab_size0 = _xtab_size;
-        ytab = _ytab;
-        ytab_size = _ytab_size;
-        tabofs = _tabofs;
-    }
+    int k, dx;
+    for( dx = 0; dx < width; dx++ )
+        buf[dx] = (WT)0;
 
-    virtual void operator() (const Range& range) const CV_OVERRIDE
+    if( cn == 1 )
+        for( k = 0; k < xtab_size; k++ )
+        {
+            int dxn = xtab[k].di;
+            WT alpha = xtab[k].alpha;
+            buf[dxn] += S[xtab[k].si]*alpha;
+        }
+    else if( cn == 2 )
+        for( k = 0; k < xtab_size; k++ )
+        {
+            int sxn = xtab[k].si;
+            int dxn = xtab[k].di;
+            WT alpha = xtab[k].alpha;
+            WT t0 = buf[dxn] + S[sxn]*alpha;
+            WT t1 = buf[dxn+1] + S[sxn+1]*alpha;
+            buf[dxn] = t0; buf[dxn+1] = t1;
+        }
+    else if( cn == 3 )
+        for( k = 0; k < xtab_size; k++ )
+        {
+            int sxn = xtab[k].si;
+            int dxn = xtab[k].di;
+            WT alpha = xtab[k].alpha;
+            WT t0 = buf[dxn] + S[sxn]*alpha;
+            WT t1 = buf[dxn+1] + S[sxn+1]*alpha;
+            WT t2 = buf[dxn+2] + S[sxn+2]*alpha;
+            buf[dxn] = t0; buf[dxn+1] = t1; buf[dxn+2] = t2;
+        }
+    else if( cn == 4 )
+    {
+        for( k = 0; k < xtab_size; k++ )
+        {
+            int sxn = xtab[k].si;
+            int dxn = xtab[k].di;
+            WT alpha = xtab[k].alpha;
+            WT t0 = buf[dxn] + S[sxn]*alpha;
+            WT t1 = buf[dxn+1] + S[sxn+1]*alpha;
+            buf[dxn] = t0; buf[dxn+1] = t1;
+            t0 = buf[dxn+2] + S[sxn+2]*alpha;
+            t1 = buf[dxn+3] + S[sxn+3]*alpha;
+            buf[dxn+2] = t0; buf[dxn+3] = t1;
+        }
+    }
+    else
+    {
+        for( k = 0; k < xtab_size; k++ )
+        {
+            int sxn = xtab[k].si;
+            int dxn = xtab[k].di;
+            WT alpha = xtab[k].alpha;
+            for( int c = 0; c < cn; c++ )
+                buf[dxn + c] += S[sxn + c]*alpha;
+        }
+    }
+}
+
+template<typename T, typename WT> class ResizeArea_Invoker :
+    public ParallelLoopBody
+{
+public:
+    ResizeArea_Invoker( const Mat& _src, Mat& _dst,
+                        const DecimateAlpha* _xtab, int _xtab_size,
+                        const DecimateAlpha* _ytab, int _ytab_size,
+                        const int* _tabofs )
+    {
+        src = &_src;
+        dst = &_dst;
+        xtab0 = _xtab;
+        xtab_size0 = _xtab_size;
+        ytab = _ytab;
+        ytab_size = _ytab_size;
+        tabofs = _tabofs;
+    }
+
+    virtual void operator() (const Range& range) const CV_OVERRIDE
     {
         Size dsize = dst->size();
         int cn = dst->channels();
@@ -3151,7 +3660,7 @@ public:
         const DecimateAlpha* xtab = xtab0;
         int xtab_size = xtab_size0;
         WT *buf = _buffer.data(), *sum = buf + dsize.width;
-        int j_start = tabofs[range.start], j_end = tabofs[range.end], j, k, dx, prev_dy = ytab[j_start].di;
+        int j_start = tabofs[range.start], j_end = tabofs[range.end], j, dx, prev_dy = ytab[j_start].di;
 
         for( dx = 0; dx < dsize.width; dx++ )
             sum[dx] = (WT)0;
@@ -3162,66 +3671,7 @@ public:
             int dy = ytab[j].di;
             int sy = ytab[j].si;
 
-            {
-                const T* S = src->template ptr<T>(sy);
-                for( dx = 0; dx < dsize.width; dx++ )
-                    buf[dx] = (WT)0;
-
-                if( cn == 1 )
-                    for( k = 0; k < xtab_size; k++ )
-                    {
-                        int dxn = xtab[k].di;
-                        WT alpha = xtab[k].alpha;
-                        buf[dxn] += S[xtab[k].si]*alpha;
-                    }
-                else if( cn == 2 )
-                    for( k = 0; k < xtab_size; k++ )
-                    {
-                        int sxn = xtab[k].si;
-                        int dxn = xtab[k].di;
-                        WT alpha = xtab[k].alpha;
-                        WT t0 = buf[dxn] + S[sxn]*alpha;
-                        WT t1 = buf[dxn+1] + S[sxn+1]*alpha;
-                        buf[dxn] = t0; buf[dxn+1] = t1;
-                    }
-                else if( cn == 3 )
-                    for( k = 0; k < xtab_size; k++ )
-                    {
-                        int sxn = xtab[k].si;
-                        int dxn = xtab[k].di;
-                        WT alpha = xtab[k].alpha;
-                        WT t0 = buf[dxn] + S[sxn]*alpha;
-                        WT t1 = buf[dxn+1] + S[sxn+1]*alpha;
-                        WT t2 = buf[dxn+2] + S[sxn+2]*alpha;
-                        buf[dxn] = t0; buf[dxn+1] = t1; buf[dxn+2] = t2;
-                    }
-                else if( cn == 4 )
-                {
-                    for( k = 0; k < xtab_size; k++ )
-                    {
-                        int sxn = xtab[k].si;
-                        int dxn = xtab[k].di;
-                        WT alpha = xtab[k].alpha;
-                        WT t0 = buf[dxn] + S[sxn]*alpha;
-                        WT t1 = buf[dxn+1] + S[sxn+1]*alpha;
-                        buf[dxn] = t0; buf[dxn+1] = t1;
-                        t0 = buf[dxn+2] + S[sxn+2]*alpha;
-                        t1 = buf[dxn+3] + S[sxn+3]*alpha;
-                        buf[dxn+2] = t0; buf[dxn+3] = t1;
-                    }
-                }
-                else
-                {
-                    for( k = 0; k < xtab_size; k++ )
-                    {
-                        int sxn = xtab[k].si;
-                        int dxn = xtab[k].di;
-                        WT alpha = xtab[k].alpha;
-                        for( int c = 0; c < cn; c++ )
-                            buf[dxn + c] += S[sxn + c]*alpha;
-                    }
-                }
-            }
+            resizeAreaHPass<T, WT>(src->template ptr<T>(sy), buf, xtab, xtab_size, cn, dsize.width);
 
             if( dy != prev_dy )
             {
@@ -3252,27 +3702,97 @@ template <typename T, typename WT>
 static void resizeArea_( const Mat& src, Mat& dst,
                          const DecimateAlpha* xtab, int xtab_size,
                          const DecimateAlpha* ytab, int ytab_size,
-                         const int* tabofs )
+                         const int* tabofs, const Range& range )
 {
-    parallel_for_(Range(0, dst.rows),
+    parallel_for_(range,
                  ResizeArea_Invoker<T, WT>(src, dst, xtab, xtab_size, ytab, ytab_size, tabofs),
                  dst.total()/((double)(1 << 16)));
 }
 
+// single-row passes of resizeArea_, used by the row-streaming resize
+template <typename T, typename WT>
+static void resizeAreaHRow_( const uchar* src, uchar* buf,
+                            const DecimateAlpha* xtab, int xtab_size, int cn, int width )
+{
+    resizeAreaHPass<T, WT>((const T*)src, (WT*)buf, xtab, xtab_size, cn, width);
+}
+
+template <typename T, typename WT>
+static void resizeAreaVRow_( const uchar* buf, uchar* sum, float beta, bool first, int width )
+{
+    if( first )
+        inter_area::mul((const WT*)buf, width, (WT)beta, (WT*)sum);
+    else
+        inter_area::muladd((const WT*)buf, width, (WT)beta, (WT*)sum);
+}
+
+template <typename T, typename WT>
+static void resizeAreaStoreRow_( const uchar* sum, uchar* dst, int width )
+{
+    inter_area::saturate_store((const WT*)sum, width, (T*)dst);
+}
+
 
 typedef void (*ResizeFunc)( const Mat& src, Mat& dst,
                             const int* xofs, const void* alpha,
                             const int* yofs, const void* beta,
-                            int xmin, int xmax, int ksize );
+                            int xmin, int xmax, int ksize, const Range& range );
 
 typedef void (*ResizeAreaFastFunc)( const Mat& src, Mat& dst,
                                     const int* ofs, const int *xofs,
-                                    int scale_x, int scale_y );
+                                    int scale_x, int scale_y, const Range& range );
 
 typedef void (*ResizeAreaFunc)( const Mat& src, Mat& dst,
                                 const DecimateAlpha* xtab, int xtab_size,
                                 const DecimateAlpha* ytab, int ytab_size,
-                                const int* yofs);
+                                const int* yofs, const Range& range );
+
+typedef void (*ResizeHRowFunc)( const uchar* src, uchar* buf,
+                                const int* xofs, const void* alpha,
+                                int swidth, int dwidth, int cn, int xmin, int xmax );
+
+typedef void (*ResizeVRowFunc)( const uchar** rows, uchar* dst, const void* beta, int dwidth );
+
+typedef void (*ResizeAreaHRowFunc)( const uchar* src, uchar* buf,
+                                    const DecimateAlpha* xtab, int xtab_size, int cn, int width );
+
+typedef void (*ResizeAreaVRowFunc)( const uchar* buf, uchar* sum, float beta, bool first, int width );
+
+typedef void (*ResizeAreaStoreRowFunc)( const uchar* sum, uchar* dst, int width );
+
+// whole-image function bundled with its single-row passes and the size of the intermediate row element
+struct ResizeGenericFuncs
+{
+    ResizeFunc func;
+    ResizeHRowFunc hrow;
+    ResizeVRowFunc vrow;
+    int bufelemsize;
+};
+
+template<class HResize, class VResize>
+static ResizeGenericFuncs resizeGenericFuncs_()
+{
+    ResizeGenericFuncs f = { resizeGeneric_<HResize, VResize>, resizeGenericHRow_<HResize, VResize>,
+                             resizeGenericVRow_<HResize, VResize>, (int)sizeof(typename HResize::buf_type) };
+    return f;
+}
+
+struct ResizeAreaFuncs
+{
+    ResizeAreaFunc func;
+    ResizeAreaHRowFunc hrow;
+    ResizeAreaVRowFunc vrow;
+    ResizeAreaStoreRowFunc store;
+    int bufelemsize;
+};
+
+template <typename T, typename WT>
+static ResizeAreaFuncs resizeAreaFuncs_()
+{
+    ResizeAreaFuncs f = { resizeArea_<T, WT>, resizeAreaHRow_<T, WT>, resizeAreaVRow_<T, WT>,
+                          resizeAreaStoreRow_<T, WT>, (int)sizeof(WT) };
+    return f;
+}
 
 
 static int computeResizeAreaTab( int ssize, int dsize, int cn, double scale, DecimateAlpha* tab )
@@ -3316,6 +3836,415 @@ static int computeResizeAreaTab( int ssize, int dsize, int cn, double scale, Dec
     return k;
 }
 
+//==================================================================================================
+// INTER_ANTIALIAS: separable resampling by the interpolation kernel stretched by the downscale factor.
+// Every destination pixel is a weighted sum over its own source window [ofs, ofs + cnt), the windows
+// are clipped by the image and their weights are renormalized. 8-bit images use fixed-point weights
+// and keep RESAMPLE_BUF_BITS fractional bits in the 16-bit intermediate row of the vertical pass.
+
+enum
+{
+    RESAMPLE_COEF_BITS = 14,
+    RESAMPLE_COEF_SCALE = 1 << RESAMPLE_COEF_BITS,
+    RESAMPLE_BUF_BITS = 6
+};
+
+static double resampleFilterSupport( int interpolation )
+{
+    return interpolation == INTER_CUBIC ? 2. : interpolation == INTER_LANCZOS4 ? 4. : 1.;
+}
+
+static double resampleFilter( int interpolation, double x )
+{
+    x = std::abs(x);
+    if( interpolation == INTER_CUBIC )
+    {
+        // the same kernel as of INTER_CUBIC
+        const double A = -0.75;
+        if( x < 1 )
+            return ((A + 2)*x - (A + 3))*x*x + 1;
+        if( x < 2 )
+            return ((A*x - 5*A)*x + 8*A)*x - 4*A;
+        return 0;
+    }
+    if( interpolation == INTER_LANCZOS4 )
+    {
+        if( x < DBL_EPSILON )
+            return 1;
+        if( x >= 4 )
+            return 0;
+        double y = x*CV_PI;
+        return 4*std::sin(y)*std::sin(y*0.25)/(y*y);
+    }
+    return std::max(1 - x, 0.);
+}
+
+// maximum number of taps of a destination pixel
+static int resampleKSize( int interpolation, double scale )
+{
+    return cvCeil(resampleFilterSupport(interpolation)*std::max(scale, 1.))*2 + 1;
+}
+
+// computes the source windows and the normalized weights of all dsize destination pixels,
+// the weights of the d-th pixel are stored at coeffs[d*ksize]
+static void computeResampleTab( int ssize, int dsize, double scale, int interpolation, int ksize,
+                                int* ofs, int* cnt, float* coeffs )
+{
+    double filterscale = std::max(scale, 1.);
+    double support = resampleFilterSupport(interpolation)*filterscale;
+    AutoBuffer<double> _w(ksize);
+    double* w = _w.data();
+
+    for( int d = 0; d < dsize; d++ )
+    {
+        double center = (d + 0.5)*scale;
+        int x0 = std::max(cvFloor(center - support + 0.5), 0);
+        int x1 = std::min(cvFloor(center + support + 0.5), ssize);
+        int n = x1 - x0;
+        CV_Assert( 0 < n && n <= ksize );
+
+        double sum = 0;
+        for( int k = 0; k < n; k++ )
+        {
+            w[k] = resampleFilter(interpolation, (x0 + k - center + 0.5)/filterscale);
+            sum += w[k];
+        }
+        CV_Assert( sum > 0 );
+
+        ofs[d] = x0;
+        cnt[d] = n;
+        float* c = coeffs + d*ksize;
+        for( int k = 0; k < n; k++ )
+            c[k] = (float)(w[k]/sum);
+        for( int k = n; k < ksize; k++ )
+            c[k] = 0.f;
+    }
+}
+
+// converts the weights to the fixed point, so that the weights of every pixel still sum to one exactly
+static void computeResampleFixedTab( const float* coeffs, const int* cnt, int dsize, int ksize, short* icoeffs )
+{
+    for( int d = 0; d < dsize; d++ )
+    {
+        const float* c = coeffs + d*ksize;
+        short* ic = icoeffs + d*ksize;
+        int sum = 0, kmax = 0;
+        for( int k = 0; k < ksize; k++ )
+        {
+            ic[k] = saturate_cast<short>(c[k]*RESAMPLE_COEF_SCALE);
+            sum += ic[k];
+            if( c[k] > c[kmax] )
+                kmax = k;
+        }
+        CV_Assert( kmax < cnt[d] );
+        ic[kmax] = saturate_cast<short>(ic[kmax] + RESAMPLE_COEF_SCALE - sum);
+    }
+}
+
+// vertical pass: the weighted sum of n source rows, width is in elements
+static void resampleVRow( const uchar** src, short* D, const short* beta, int n, int width )
+{
+    const int shift = RESAMPLE_COEF_BITS - RESAMPLE_BUF_BITS, delta = 1 << (shift - 1);
+    int x = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int VECSZ = VTraits<v_int16>::vlanes();
+    const v_int32 v_delta = vx_setall_s32(delta);
+    for( ; x <= width - VECSZ; x += VECSZ )
+    {
+        v_int32 s0 = v_delta, s1 = v_delta;
+        v_int16 t0, t1;
+        int k = 0;
+        for( ; k <= n - 2; k += 2 )
+        {
+            v_int16 b = v_reinterpret_as_s16(vx_setall_u32((unsigned)(ushort)beta[k] | ((unsigned)(ushort)beta[k+1] << 16)));
+            v_zip(v_reinterpret_as_s16(vx_load_expand(src[k] + x)),
+                  v_reinterpret_as_s16(vx_load_expand(src[k+1] + x)), t0, t1);
+            s0 = v_add(s0, v_dotprod(t0, b));
+            s1 = v_add(s1, v_dotprod(t1, b));
+        }
+        if( k < n )
+        {
+            v_int16 b = v_reinterpret_as_s16(vx_setall_u32((ushort)beta[k]));
+            v_zip(v_reinterpret_as_s16(vx_load_expand(src[k] + x)), vx_setzero_s16(), t0, t1);
+            s0 = v_add(s0, v_dotprod(t0, b));
+            s1 = v_add(s1, v_dotprod(t1, b));
+        }
+        v_store(D + x, v_pack(v_shr<RESAMPLE_COEF_BITS - RESAMPLE_BUF_BITS>(s0),
+                              v_shr<RESAMPLE_COEF_BITS - RESAMPLE_BUF_BITS>(s1)));
+    }
+#endif
+    for( ; x < width; x++ )
+    {
+        int sum = delta;
+        for( int k = 0; k < n; k++ )
+            sum += src[k][x]*beta[k];
+        D[x] = saturate_cast<short>(sum >> shift);
+    }
+}
+
+template<typename T, typename WT>
+static int resampleVRowVec( const T**, WT*, const float*, int, int )
+{
+    return 0;
+}
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+static inline v_float32 vx_resample_load( const float* p ) { return vx_load(p); }
+static inline v_float32 vx_resample_load( const ushort* p ) { return v_cvt_f32(v_reinterpret_as_s32(vx_load_expand(p))); }
+static inline v_float32 vx_resample_load( const short* p ) { return v_cvt_f32(vx_load_expand(p)); }
+
+template<typename T>
+static int resampleVRowVec_32f( const T** src, float* D, const float* beta, int n, int width )
+{
+    const int VECSZ = VTraits<v_float32>::vlanes();
+    int x = 0;
+    for( ; x <= width - VECSZ; x += VECSZ )
+    {
+        v_float32 s = v_mul(vx_resample_load(src[0] + x), vx_setall_f32(beta[0]));
+        for( int k = 1; k < n; k++ )
+            s = v_fma(vx_resample_load(src[k] + x), vx_setall_f32(beta[k]), s);
+        v_store(D + x, s);
+    }
+    return x;
+}
+
+template<>
+int resampleVRowVec<ushort, float>( const ushort** src, float* D, const float* beta, int n, int width )
+{
+    return resampleVRowVec_32f(src, D, beta, n, width);
+}
+
+template<>
+int resampleVRowVec<short, float>( const short** src, float* D, const float* beta, int n, int width )
+{
+    return resampleVRowVec_32f(src, D, beta, n, width);
+}
+
+template<>
+int resampleVRowVec<float, float>( const float** src, float* D, const float* beta, int n, int width )
+{
+    return resampleVRowVec_32f(src, D, beta, n, width);
+}
+#endif
+
+template<typename T, typename WT>
+static void resampleVRow( const T** src, WT* D, const float* beta, int n, int width )
+{
+    int x = resampleVRowVec(src, D, beta, n, width);
+    for( ; x < width; x++ )
+    {
+        WT sum = src[0][x]*beta[0];
+        for( int k = 1; k < n; k++ )
+            sum += src[k][x]*beta[k];
+        D[x] = sum;
+    }
+}
+
+// horizontal pass: the weighted sums over the windows of the intermediate row, the widths are in pixels
+static void resampleHRow( const short* S, uchar* D, const int* xofs, const int* xcnt,
+                          const short* alpha, int ksize, int swidth, int dwidth, int cn )
+{
+    const int shift = RESAMPLE_COEF_BITS + RESAMPLE_BUF_BITS, delta = 1 << (shift - 1);
+    for( int dx = 0; dx < dwidth; dx++, alpha += ksize, D += cn )
+    {
+        const short* s = S + xofs[dx]*cn;
+        int n = xcnt[dx], k = 0;
+#if CV_SIMD128
+        if( cn == 1 )
+        {
+            v_int32x4 vsum = v_setzero_s32();
+            for( ; k <= n - 8; k += 8 )
+                vsum = v_add(vsum, v_dotprod(v_load(s + k), v_load(alpha + k)));
+            int sum = v_reduce_sum(vsum) + delta;
+            for( ; k < n; k++ )
+                sum += s[k]*alpha[k];
+            D[0] = saturate_cast<uchar>(sum >> shift);
+            continue;
+        }
+        // a pixel is loaded as 4 values, so a 3-channel window must not end at the last source pixel
+        if( cn == 4 || (cn == 3 && xofs[dx] + n < swidth) )
+        {
+            // the channels of two pixels are paired up for the dot product
+            v_int32x4 vsum = v_setall_s32(delta);
+            v_int16x8 t0, t1;
+            for( ; k <= n - 2; k += 2 )
+            {
+                v_int16x8 b = v_reinterpret_as_s16(v_setall_u32((unsigned)(ushort)alpha[k] | ((unsigned)(ushort)alpha[k+1] << 16)));
+                v_zip(v_load_low(s + k*cn), v_load_low(s + (k + 1)*cn), t0, t1);
+                vsum = v_add(vsum, v_dotprod(t0, b));
+            }
+            if( k < n )
+            {
+                v_zip(v_load_low(s + k*cn), v_setzero_s16(), t0, t1);
+                vsum = v_add(vsum, v_dotprod(t0, v_reinterpret_as_s16(v_setall_u32((ushort)alpha[k]))));
+            }
+            int buf[4];
+            v_store(buf, v_shr<RESAMPLE_COEF_BITS + RESAMPLE_BUF_BITS>(vsum));
+            for( int c = 0; c < cn; c++ )
+                D[c] = saturate_cast<uchar>(buf[c]);
+            continue;
+        }
+#else
+        CV_UNUSED(swidth);
+#endif
+        for( int c = 0; c < cn; c++ )
+        {
+            int sum = delta;
+            for( k = 0; k < n; k++ )
+                sum += s[k*cn + c]*alpha[k];
+            D[c] = saturate_cast<uchar>(sum >> shift);
+        }
+    }
+}
+
+#if CV_SIMD128
+static inline bool resampleHPixelVec( const float* s, float* sum, const float* alpha, int n, int cn, bool load4 )
+{
+    if( cn == 1 )
+    {
+        v_float32x4 vsum = v_setzero_f32();
+        int k = 0;
+        for( ; k <= n - 4; k += 4 )
+            vsum = v_fma(v_load(s + k), v_load(alpha + k), vsum);
+        sum[0] = v_reduce_sum(vsum);
+        for( ; k < n; k++ )
+            sum[0] += s[k]*alpha[k];
+        return true;
+    }
+    if( cn == 4 || (cn == 3 && load4) )
+    {
+        v_float32x4 vsum = v_setzero_f32();
+        for( int k = 0; k < n; k++ )
+            vsum = v_fma(v_load(s + k*cn), v_setall_f32(alpha[k]), vsum);
+        v_store(sum, vsum);
+        return true;
+    }
+    return false;
+}
+#endif
+
+static inline bool resampleHPixelVec( const double*, double*, const float*, int, int, bool )
+{
+    return false;
+}
+
+template<typename T, typename WT>
+static void resampleHRow( const WT* S, T* D, const int* xofs, const int* xcnt,
+                          const float* alpha, int ksize, int swidth, int dwidth, int cn )
+{
+    for( int dx = 0; dx < dwidth; dx++, alpha += ksize, D += cn )
+    {
+        const WT* s = S + xofs[dx]*cn;
+        int n = xcnt[dx];
+        WT sum[4];
+#if CV_SIMD128
+        if( resampleHPixelVec(s, sum, alpha, n, cn, xofs[dx] + n < swidth) )
+        {
+            for( int c = 0; c < cn; c++ )
+                D[c] = saturate_cast<T>(sum[c]);
+            continue;
+        }
+#else
+        CV_UNUSED(swidth);
+        CV_UNUSED(sum);
+#endif
+        for( int c = 0; c < cn; c++ )
+        {
+            WT v = 0;
+            for( int k = 0; k < n; k++ )
+                v += s[k*cn + c]*alpha[k];
+            D[c] = saturate_cast<T>(v);
+        }
+    }
+}
+
+template<typename T, typename WT, typename AT>
+static void resampleVRow_( const uchar** rows, uchar* buf, const void* beta, int n, int width )
+{
+    resampleVRow((const T**)rows, (WT*)buf, (const AT*)beta, n, width);
+}
+
+template<typename T, typename WT, typename AT>
+static void resampleHRow_( const uchar* buf, uchar* dst, const int* xofs, const int* xcnt,
+                           const void* alpha, int ksize, int swidth, int dwidth, int cn )
+{
+    resampleHRow((const WT*)buf, (T*)dst, xofs, xcnt, (const AT*)alpha, ksize, swidth, dwidth, cn);
+}
+
+typedef void (*ResampleVRowFunc)( const uchar** rows, uchar* buf, const void* beta, int n, int width );
+
+typedef void (*ResampleHRowFunc)( const uchar* buf, uchar* dst, const int* xofs, const int* xcnt,
+                                  const void* alpha, int ksize, int swidth, int dwidth, int cn );
+
+struct ResampleFuncs
+{
+    ResampleVRowFunc vrow;
+    ResampleHRowFunc hrow;
+    int bufelemsize;
+    int coefelemsize;
+};
+
+template<typename T, typename WT, typename AT>
+static ResampleFuncs resampleFuncs_()
+{
+    ResampleFuncs f = { resampleVRow_<T, WT, AT>, resampleHRow_<T, WT, AT>, (int)sizeof(WT), (int)sizeof(AT) };
+    return f;
+}
+
+class resizeResample_Invoker :
+    public ParallelLoopBody
+{
+public:
+    resizeResample_Invoker(const Mat& _src, Mat& _dst, const ResampleFuncs& _funcs,
+        const int* _xofs, const int* _xcnt, const void* _alpha, int _xksize,
+        const int* _yofs, const int* _ycnt, const void* _beta, int _yksize) :
+        ParallelLoopBody(), src(_src), dst(_dst), funcs(_funcs), xofs(_xofs), xcnt(_xcnt), alpha(_alpha),
+        xksize(_xksize), yofs(_yofs), ycnt(_ycnt), beta(_beta), yksize(_yksize)
+    {
+    }
+
+    virtual void operator() (const Range& range) const CV_OVERRIDE
+    {
+        // the vertical pass goes first: it reads the source rows directly and is vectorized along
+        // the row, so the slower horizontal pass runs on the destination rows only
+        int cn = src.channels(), width = src.cols*cn;
+        AutoBuffer<uchar> _buffer(width*funcs.bufelemsize);
+        AutoBuffer<const uchar*> _rows(yksize);
+        const uchar** rows = _rows.data();
+
+        for( int dy = range.start; dy < range.end; dy++ )
+        {
+            int sy0 = yofs[dy], n = ycnt[dy];
+            for( int k = 0; k < n; k++ )
+                rows[k] = src.ptr(sy0 + k);
+            funcs.vrow(rows, _buffer.data(), (const uchar*)beta + (size_t)dy*yksize*funcs.coefelemsize, n, width);
+            funcs.hrow(_buffer.data(), dst.data + dst.step*dy, xofs, xcnt, alpha, xksize, src.cols, dst.cols, cn);
+        }
+    }
+
+private:
+    Mat src;
+    Mat dst;
+    ResampleFuncs funcs;
+    const int *xofs, *xcnt;
+    const void* alpha;
+    int xksize;
+    const int *yofs, *ycnt;
+    const void* beta;
+    int yksize;
+
+    resizeResample_Invoker& operator = (const resizeResample_Invoker&);
+};
+
+static void resizeResample_( const Mat& src, Mat& dst, const ResampleFuncs& funcs,
+                             const int* xofs, const int* xcnt, const void* alpha, int xksize,
+                             const int* yofs, const int* ycnt, const void* beta, int yksize,
+                             const Range& range )
+{
+    resizeResample_Invoker invoker(src, dst, funcs, xofs, xcnt, alpha, xksize, yofs, ycnt, beta, yksize);
+    parallel_for_(range, invoker, dst.total()/(double)(1<<16));
+}
+
 #ifdef HAVE_OPENCL
 static void ocl_computeResizeAreaTabs(int ssize, int dsize, double scale, int * const map_tab,
                                       float * const alpha_tab, int * const ofs_tab)
@@ -3677,6 +4606,9 @@ static bool ipp_resize(const uchar * src_data, size_t src_step, int src_width, i
 #ifdef HAVE_IPP_IW
     CV_INSTRUMENT_REGION_IPP();
 
+    if (interpolation & INTER_ANTIALIAS)
+        return false;
+
     IppDataType           ippDataType = ippiGetDataType(depth);
     IppiInterpolationType ippInter    = ippiGetInterpolation(interpolation);
     if((int)ippInter < 0)
@@ -3765,15 +4697,61 @@ static bool ipp_resize(const uchar * src_data, size_t src_step, int src_width, i
 
 //==================================================================================================
 
-namespace hal {
-
-void resize(int src_type,
-            const uchar * src_data, size_t src_step, int src_width, int src_height,
-            uchar * dst_data, size_t dst_step, int dst_width, int dst_height,
-            double inv_scale_x, double inv_scale_y, int interpolation)
+struct ResizePlan::Impl
 {
-    CV_INSTRUMENT_REGION();
+    enum
+    {
+        RESIZE_NN = 0,
+        RESIZE_NN_EXACT = 1,
+        RESIZE_BITEXACT = 2,
+        RESIZE_AREA_FAST = 3,
+        RESIZE_AREA = 4,
+        RESIZE_GENERIC = 5,
+        RESIZE_RESAMPLE = 6
+    };
+
+    Impl(int _type, int src_width, int src_height, int _dst_width, int _dst_height,
+         double _inv_scale_x, double _inv_scale_y, int _interpolation);
+
+    void computeTabs();
+    void run(const uchar* src_data, size_t src_step, uchar* dst_data, size_t dst_step, const Range& rows) const;
+
+    int type, interpolation;
+    Size ssize, dsize;
+    int dst_width, dst_height;
+    double inv_scale_x, inv_scale_y;
+
+    int mode;
+    AutoBuffer<uchar> buffer;
+    be_resize_tab be_tab;
+    be_resize_funcs be_funcs;
+    ResizeGenericFuncs funcs;
+    ResizeAreaFastFunc areafast_func;
+    ResizeAreaFuncs area_funcs;
+    ResampleFuncs resample_funcs;
+    int *xofs, *yofs;
+    void *alpha, *beta;
+    int xmin, xmax, ksize;
+    int *xcnt, *ycnt;
+    int xksize;
+    int iscale_x, iscale_y;
+    DecimateAlpha *xtab, *ytab;
+    int xtab_size, ytab_size;
+    int* tabofs;
 
+private:
+    Impl(const Impl&);
+    Impl& operator=(const Impl&);
+};
+
+ResizePlan::Impl::Impl(int _type, int src_width, int src_height, int _dst_width, int _dst_height,
+                       double _inv_scale_x, double _inv_scale_y, int _interpolation) :
+    type(_type), interpolation(_interpolation), ssize(src_width, src_height),
+    dst_width(_dst_width), dst_height(_dst_height), inv_scale_x(_inv_scale_x), inv_scale_y(_inv_scale_y),
+    mode(-1), be_funcs(), funcs(), areafast_func(0), area_funcs(), resample_funcs(), xofs(0), yofs(0), alpha(0), beta(0),
+    xmin(0), xmax(0), ksize(0), xcnt(0), ycnt(0), xksize(0),
+    iscale_x(0), iscale_y(0), xtab(0), ytab(0), xtab_size(0), ytab_size(0), tabofs(0)
+{
     CV_Assert((dst_width > 0 && dst_height > 0) || (inv_scale_x > 0 && inv_scale_y > 0));
     if (inv_scale_x < DBL_EPSILON || inv_scale_y < DBL_EPSILON)
     {
@@ -3781,98 +4759,97 @@ void resize(int src_type,
         inv_scale_y = static_cast<double>(dst_height) / src_height;
     }
 
-    CALL_HAL(resize, cv_hal_resize, src_type, src_data, src_step, src_width, src_height, dst_data, dst_step, dst_width, dst_height, inv_scale_x, inv_scale_y, interpolation);
+    dsize = Size(saturate_cast<int>(src_width*inv_scale_x),
+                 saturate_cast<int>(src_height*inv_scale_y));
+}
 
-    int  depth = CV_MAT_DEPTH(src_type), cn = CV_MAT_CN(src_type);
-    Size dsize = Size(saturate_cast<int>(src_width*inv_scale_x),
-                        saturate_cast<int>(src_height*inv_scale_y));
+void ResizePlan::Impl::computeTabs()
+{
     CV_Assert( !dsize.empty() );
 
-    CV_IPP_RUN_FAST(ipp_resize(src_data, src_step, src_width, src_height, dst_data, dst_step, dsize.width, dsize.height, inv_scale_x, inv_scale_y, depth, cn, interpolation))
-
-    static ResizeFunc linear_tab[] =
+    static ResizeGenericFuncs linear_tab[] =
     {
-        resizeGeneric_<
+        resizeGenericFuncs_<
             HResizeLinear<uchar, int, short,
                 INTER_RESIZE_COEF_SCALE,
                 HResizeLinearVec_8u32s>,
             VResizeLinear<uchar, int, short,
                 FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
-                VResizeLinearVec_32s8u> >,
-        0,
-        resizeGeneric_<
+                VResizeLinearVec_32s8u> >(),
+        ResizeGenericFuncs(),
+        resizeGenericFuncs_<
             HResizeLinear<ushort, float, float, 1,
                 HResizeLinearVec_16u32f>,
             VResizeLinear<ushort, float, float, Cast<float, ushort>,
-                VResizeLinearVec_32f16u> >,
-        resizeGeneric_<
+                VResizeLinearVec_32f16u> >(),
+        resizeGenericFuncs_<
             HResizeLinear<short, float, float, 1,
                 HResizeLinearVec_16s32f>,
             VResizeLinear<short, float, float, Cast<float, short>,
-                VResizeLinearVec_32f16s> >,
-        0,
-        resizeGeneric_<
+                VResizeLinearVec_32f16s> >(),
+        ResizeGenericFuncs(),
+        resizeGenericFuncs_<
             HResizeLinear<float, float, float, 1,
                 HResizeLinearVec_32f>,
             VResizeLinear<float, float, float, Cast<float, float>,
-                VResizeLinearVec_32f> >,
-        resizeGeneric_<
+                VResizeLinearVec_32f> >(),
+        resizeGenericFuncs_<
             HResizeLinear<double, double, float, 1,
                 HResizeNoVec>,
             VResizeLinear<double, double, float, Cast<double, double>,
-                VResizeNoVec> >,
-        0
+                VResizeNoVec> >(),
+        ResizeGenericFuncs()
     };
 
-    static ResizeFunc cubic_tab[] =
+    static ResizeGenericFuncs cubic_tab[] =
     {
-        resizeGeneric_<
-            HResizeCubic<uchar, int, short>,
+        resizeGenericFuncs_<
+            HResizeCubic<uchar, int, short, HResizeCubicVec_8u32s>,
             VResizeCubic<uchar, int, short,
                 FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
-                VResizeCubicVec_32s8u> >,
-        0,
-        resizeGeneric_<
-            HResizeCubic<ushort, float, float>,
+                VResizeCubicVec_32s8u> >(),
+        ResizeGenericFuncs(),
+        resizeGenericFuncs_<
+            HResizeCubic<ushort, float, float, HResizeCubicVec_16u32f>,
             VResizeCubic<ushort, float, float, Cast<float, ushort>,
-            VResizeCubicVec_32f16u> >,
-        resizeGeneric_<
-            HResizeCubic<short, float, float>,
+            VResizeCubicVec_32f16u> >(),
+        resizeGenericFuncs_<
+            HResizeCubic<short, float, float, HResizeCubicVec_16s32f>,
             VResizeCubic<short, float, float, Cast<float, short>,
-            VResizeCubicVec_32f16s> >,
-        0,
-        resizeGeneric_<
-            HResizeCubic<float, float, float>,
+            VResizeCubicVec_32f16s> >(),
+        ResizeGenericFuncs(),
+        resizeGenericFuncs_<
+            HResizeCubic<float, float, float, HResizeNoVec>,
             VResizeCubic<float, float, float, Cast<float, float>,
-            VResizeCubicVec_32f> >,
-        resizeGeneric_<
-            HResizeCubic<double, double, float>,
+            VResizeCubicVec_32f> >(),
+        resizeGenericFuncs_<
+            HResizeCubic<double, double, float, HResizeNoVec>,
             VResizeCubic<double, double, float, Cast<double, double>,
-            VResizeNoVec> >,
-        0
+            VResizeNoVec> >(),
+        ResizeGenericFuncs()
     };
 
-    static ResizeFunc lanczos4_tab[] =
+    static ResizeGenericFuncs lanczos4_tab[] =
     {
-        resizeGeneric_<HResizeLanczos4<uchar, int, short>,
+        resizeGenericFuncs_<HResizeLanczos4<uchar, int, short, HResizeLanczos4Vec_8u32s>,
             VResizeLanczos4<uchar, int, short,
             FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
-            VResizeNoVec> >,
-        0,
-        resizeGeneric_<HResizeLanczos4<ushort, float, float>,
+            VResizeNoVec> >(),
+        ResizeGenericFuncs(),
+        resizeGenericFuncs_<HResizeLanczos4<ushort, float, float, HResizeLanczos4Vec_16u32f>,
             VResizeLanczos4<ushort, float, float, Cast<float, ushort>,
-            VResizeLanczos4Vec_32f16u> >,
-        resizeGeneric_<HResizeLanczos4<short, float, float>,
+            VResizeLanczos4Vec_32f16u> >(),
+        resizeGenericFuncs_<HResizeLanczos4<short, float, float, HResizeLanczos4Vec_16s32f>,
             VResizeLanczos4<short, float, float, Cast<float, short>,
-            VResizeLanczos4Vec_32f16s> >,
-        0,
-        resizeGeneric_<HResizeLanczos4<float, float, float>,
+            VResizeLanczos4Vec_32f16s> >(),
+        ResizeGenericFuncs(),
+        resizeGenericFuncs_<HResizeLanczos4<float, float, float, HResizeNoVec>,
             VResizeLanczos4<float, float, float, Cast<float, float>,
-            VResizeLanczos4Vec_32f> >,
-        resizeGeneric_<HResizeLanczos4<double, double, float>,
+            VResizeLanczos4Vec_32f> >(),
+        resizeGenericFuncs_<HResizeLanczos4<double, double, float, HResizeNoVec>,
             VResizeLanczos4<double, double, float, Cast<double, double>,
-            VResizeNoVec> >,
-        0
+            VResizeNoVec> >(),
+        ResizeGenericFuncs()
     };
 
     static ResizeAreaFastFunc areafast_tab[] =
@@ -3887,62 +4864,134 @@ void resize(int src_type,
         0
     };
 
-    static ResizeAreaFunc area_tab[] =
+    static ResizeAreaFuncs area_tab[] =
     {
-        resizeArea_<uchar, float>, 0, resizeArea_<ushort, float>,
-        resizeArea_<short, float>, 0, resizeArea_<float, float>,
-        resizeArea_<double, double>, 0
+        resizeAreaFuncs_<uchar, float>(), ResizeAreaFuncs(), resizeAreaFuncs_<ushort, float>(),
+        resizeAreaFuncs_<short, float>(), ResizeAreaFuncs(), resizeAreaFuncs_<float, float>(),
+        resizeAreaFuncs_<double, double>(), ResizeAreaFuncs()
     };
 
-    static be_resize_func linear_exact_tab[] =
+    static be_resize_funcs linear_exact_tab[] =
     {
-        resize_bitExact<uchar, interpolationLinear<uchar> >,
-        resize_bitExact<schar, interpolationLinear<schar> >,
-        resize_bitExact<ushort, interpolationLinear<ushort> >,
-        resize_bitExact<short, interpolationLinear<short> >,
-        resize_bitExact<int, interpolationLinear<int> >,
-        0,
-        0,
-        0
+        resize_bitExactFuncs<uchar, interpolationLinear<uchar> >(),
+        resize_bitExactFuncs<schar, interpolationLinear<schar> >(),
+        resize_bitExactFuncs<ushort, interpolationLinear<ushort> >(),
+        resize_bitExactFuncs<short, interpolationLinear<short> >(),
+        resize_bitExactFuncs<int, interpolationLinear<int> >(),
+        be_resize_funcs(),
+        be_resize_funcs(),
+        be_resize_funcs()
     };
 
+    static be_resize_funcs cubic_exact_tab[] =
+    {
+        resize_bitExactFuncs<uchar, interpolationCubic<uchar> >(),
+        resize_bitExactFuncs<schar, interpolationCubic<schar> >(),
+        resize_bitExactFuncs<ushort, interpolationCubic<ushort> >(),
+        resize_bitExactFuncs<short, interpolationCubic<short> >(),
+        resize_bitExactFuncs<int, interpolationCubic<int> >(),
+        be_resize_funcs(),
+        be_resize_funcs(),
+        be_resize_funcs()
+    };
+
+    static ResampleFuncs resample_tab[] =
+    {
+        resampleFuncs_<uchar, short, short>(), ResampleFuncs(), resampleFuncs_<ushort, float, float>(),
+        resampleFuncs_<short, float, float>(), ResampleFuncs(), resampleFuncs_<float, float, float>(),
+        resampleFuncs_<double, double, float>(), ResampleFuncs()
+    };
+
+    int depth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
+    int src_width = ssize.width, src_height = ssize.height;
+    int interp = interpolation;
+
     double scale_x = 1./inv_scale_x, scale_y = 1./inv_scale_y;
 
-    int iscale_x = saturate_cast<int>(scale_x);
-    int iscale_y = saturate_cast<int>(scale_y);
+    iscale_x = saturate_cast<int>(scale_x);
+    iscale_y = saturate_cast<int>(scale_y);
 
     bool is_area_fast = std::abs(scale_x - iscale_x) < DBL_EPSILON &&
             std::abs(scale_y - iscale_y) < DBL_EPSILON;
 
-    Mat src(Size(src_width, src_height), src_type, const_cast<uchar*>(src_data), src_step);
-    Mat dst(dsize, src_type, dst_data, dst_step);
+    if( interp & INTER_ANTIALIAS )
+    {
+        interp &= ~INTER_ANTIALIAS;
+        CV_Assert( interp == INTER_LINEAR || interp == INTER_CUBIC || interp == INTER_LANCZOS4 );
+        resample_funcs = resample_tab[depth];
+        CV_Assert( resample_funcs.hrow != 0 );
+
+        // the tables are indexed by pixels, the windows of all channels of a pixel are the same
+        int dwidth = dsize.width, dheight = dsize.height;
+        bool fixpt = depth == CV_8U;
+        xksize = resampleKSize(interp, scale_x);
+        ksize = resampleKSize(interp, scale_y);
+        size_t ncoeffs = (size_t)dwidth*xksize + (size_t)dheight*ksize;
+        buffer.allocate((dwidth + dheight)*2*sizeof(int) + ncoeffs*(sizeof(float) + (fixpt ? sizeof(short) : 0)));
+        xofs = (int*)buffer.data();
+        xcnt = xofs + dwidth;
+        yofs = xcnt + dwidth;
+        ycnt = yofs + dheight;
+        float* falpha = (float*)(ycnt + dheight);
+        float* fbeta = falpha + (size_t)dwidth*xksize;
+
+        computeResampleTab(src_width, dwidth, scale_x, interp, xksize, xofs, xcnt, falpha);
+        computeResampleTab(src_height, dheight, scale_y, interp, ksize, yofs, ycnt, fbeta);
+        alpha = falpha;
+        beta = fbeta;
+        if( fixpt )
+        {
+            short* ialpha = (short*)(fbeta + (size_t)dheight*ksize);
+            short* ibeta = ialpha + (size_t)dwidth*xksize;
+            computeResampleFixedTab(falpha, xcnt, dwidth, xksize, ialpha);
+            computeResampleFixedTab(fbeta, ycnt, dheight, ksize, ibeta);
+            alpha = ialpha;
+            beta = ibeta;
+        }
+        mode = RESIZE_RESAMPLE;
+        return;
+    }
 
-    if (interpolation == INTER_LINEAR_EXACT)
+    if (interp == INTER_LINEAR_EXACT)
     {
         // in case of inv_scale_x && inv_scale_y is equal to 0.5
         // INTER_AREA (fast) is equal to bit exact INTER_LINEAR
         if (is_area_fast && iscale_x == 2 && iscale_y == 2 && cn != 2)//Area resize implementation for 2-channel images isn't bit-exact
-            interpolation = INTER_AREA;
+            interp = INTER_AREA;
         else
         {
-            be_resize_func func = linear_exact_tab[depth];
-            CV_Assert(func != 0);
-            func(src_data, src_step, src_width, src_height,
-                 dst_data, dst_step, dst_width, dst_height,
-                 cn, inv_scale_x, inv_scale_y);
+            be_funcs = linear_exact_tab[depth];
+            CV_Assert(be_funcs.tab != 0);
+            be_funcs.tab(src_width, src_height, dst_width, dst_height, inv_scale_x, inv_scale_y, be_tab);
+            mode = RESIZE_BITEXACT;
             return;
         }
     }
 
-    if( interpolation == INTER_NEAREST )
+    if (interp == INTER_CUBIC_EXACT)
+    {
+        be_funcs = cubic_exact_tab[depth];
+        CV_Assert(be_funcs.tab != 0);
+        be_funcs.tab(src_width, src_height, dst_width, dst_height, inv_scale_x, inv_scale_y, be_tab);
+        mode = RESIZE_BITEXACT;
+        return;
+    }
+
+    if( interp == INTER_NEAREST )
     {
-        resizeNN( src, dst, inv_scale_x, inv_scale_y );
+        buffer.allocate(dsize.width*sizeof(int));
+        xofs = (int*)buffer.data();
+        computeResizeNNTab(src_width, dsize.width, (int)CV_ELEM_SIZE(type), inv_scale_x, xofs);
+        mode = RESIZE_NN;
         return;
     }
 
-    if( interpolation == INTER_NEAREST_EXACT )
+    if( interp == INTER_NEAREST_EXACT )
     {
-        resizeNN_bitexact( src, dst, inv_scale_x, inv_scale_y );
+        buffer.allocate(dsize.width*sizeof(int) + CV_SIMD_WIDTH);
+        xofs = alignPtr((int*)buffer.data(), CV_SIMD_WIDTH);
+        computeResizeNNBitexactTab(src_width, dsize.width, xofs);
+        mode = RESIZE_NN_EXACT;
         return;
     }
 
@@ -3952,26 +5001,22 @@ void resize(int src_type,
     {
         // in case of scale_x && scale_y is equal to 2
         // INTER_AREA (fast) also is equal to INTER_LINEAR
-        if( interpolation == INTER_LINEAR && is_area_fast && iscale_x == 2 && iscale_y == 2 )
-            interpolation = INTER_AREA;
+        if( interp == INTER_LINEAR && is_area_fast && iscale_x == 2 && iscale_y == 2 )
+            interp = INTER_AREA;
 
         // true "area" interpolation is only implemented for the case (scale_x >= 1 && scale_y >= 1).
         // In other cases it is emulated using some variant of bilinear interpolation
-        if( interpolation == INTER_AREA && scale_x >= 1 && scale_y >= 1 )
+        if( interp == INTER_AREA && scale_x >= 1 && scale_y >= 1 )
         {
             if( is_area_fast )
             {
-                int area = iscale_x*iscale_y;
-                size_t srcstep = src_step / src.elemSize1();
-                AutoBuffer<int> _ofs(area + dsize.width*cn);
-                int* ofs = _ofs.data();
-                int* xofs = ofs + area;
-                ResizeAreaFastFunc func = areafast_tab[depth];
-                CV_Assert( func != 0 );
-
-                for( sy = 0, k = 0; sy < iscale_y; sy++ )
-                    for( sx = 0; sx < iscale_x; sx++ )
-                        ofs[k++] = (int)(sy*srcstep + sx*cn);
+                areafast_func = areafast_tab[depth];
+                CV_Assert( areafast_func != 0 );
+
+                // the offsets inside of the iscale_x*iscale_y cell depend on the source step,
+                // so they are filled right before processing, see run()
+                buffer.allocate(dsize.width*cn*sizeof(int));
+                xofs = (int*)buffer.data();
 
                 for( dx = 0; dx < dsize.width; dx++ )
                 {
@@ -3981,21 +5026,21 @@ void resize(int src_type,
                         xofs[j + k] = sx + k;
                 }
 
-                func( src, dst, ofs, xofs, iscale_x, iscale_y );
+                mode = RESIZE_AREA_FAST;
                 return;
             }
 
-            ResizeAreaFunc func = area_tab[depth];
-            CV_Assert( func != 0 && cn <= 4 );
+            area_funcs = area_tab[depth];
+            CV_Assert( area_funcs.func != 0 && cn <= 4 );
 
-            AutoBuffer<DecimateAlpha> _xytab((src_width + src_height)*2);
-            DecimateAlpha* xtab = _xytab.data(), *ytab = xtab + src_width*2;
+            buffer.allocate((src_width + src_height)*2*sizeof(DecimateAlpha) + (dsize.height + 1)*sizeof(int));
+            xtab = (DecimateAlpha*)buffer.data();
+            ytab = xtab + src_width*2;
+            tabofs = (int*)(ytab + src_height*2);
 
-            int xtab_size = computeResizeAreaTab(src_width, dsize.width, cn, scale_x, xtab);
-            int ytab_size = computeResizeAreaTab(src_height, dsize.height, 1, scale_y, ytab);
+            xtab_size = computeResizeAreaTab(src_width, dsize.width, cn, scale_x, xtab);
+            ytab_size = computeResizeAreaTab(src_height, dsize.height, 1, scale_y, ytab);
 
-            AutoBuffer<int> _tabofs(dsize.height + 1);
-            int* tabofs = _tabofs.data();
             for( k = 0, dy = 0; k < ytab_size; k++ )
             {
                 if( k == 0 || ytab[k].di != ytab[k-1].di )
@@ -4006,35 +5051,36 @@ void resize(int src_type,
             }
             tabofs[dy] = ytab_size;
 
-            func( src, dst, xtab, xtab_size, ytab, ytab_size, tabofs );
+            mode = RESIZE_AREA;
             return;
         }
     }
 
-    int xmin = 0, xmax = dsize.width, width = dsize.width*cn;
-    bool area_mode = interpolation == INTER_AREA;
+    int width = dsize.width*cn;
+    bool area_mode = interp == INTER_AREA;
     bool fixpt = depth == CV_8U;
     float fx, fy;
-    ResizeFunc func=0;
-    int ksize=0, ksize2;
-    if( interpolation == INTER_CUBIC )
-        ksize = 4, func = cubic_tab[depth];
-    else if( interpolation == INTER_LANCZOS4 )
-        ksize = 8, func = lanczos4_tab[depth];
-    else if( interpolation == INTER_LINEAR || interpolation == INTER_AREA )
-        ksize = 2, func = linear_tab[depth];
+    int ksize2;
+    xmin = 0;
+    xmax = dsize.width;
+    if( interp == INTER_CUBIC )
+        ksize = 4, funcs = cubic_tab[depth];
+    else if( interp == INTER_LANCZOS4 )
+        ksize = 8, funcs = lanczos4_tab[depth];
+    else if( interp == INTER_LINEAR || interp == INTER_AREA )
+        ksize = 2, funcs = linear_tab[depth];
     else
         CV_Error( cv::Error::StsBadArg, "Unknown interpolation method" );
     ksize2 = ksize/2;
 
-    CV_Assert( func != 0 );
+    CV_Assert( funcs.func != 0 );
 
-    AutoBuffer<uchar> _buffer((width + dsize.height)*(sizeof(int) + sizeof(float)*ksize));
-    int* xofs = (int*)_buffer.data();
-    int* yofs = xofs + width;
-    float* alpha = (float*)(yofs + dsize.height);
-    short* ialpha = (short*)alpha;
-    float* beta = alpha + width*ksize;
+    buffer.allocate((width + dsize.height)*(sizeof(int) + sizeof(float)*ksize));
+    xofs = (int*)buffer.data();
+    yofs = xofs + width;
+    float* falpha = (float*)(yofs + dsize.height);
+    short* ialpha = (short*)falpha;
+    float* fbeta = falpha + width*ksize;
     short* ibeta = ialpha + width*ksize;
     float cbuf[MAX_ESIZE] = {0};
 
@@ -4056,23 +5102,23 @@ void resize(int src_type,
         if( sx < ksize2-1 )
         {
             xmin = dx+1;
-            if( sx < 0 && (interpolation != INTER_CUBIC && interpolation != INTER_LANCZOS4))
+            if( sx < 0 && (interp != INTER_CUBIC && interp != INTER_LANCZOS4))
                 fx = 0, sx = 0;
         }
 
         if( sx + ksize2 >= src_width )
         {
             xmax = std::min( xmax, dx );
-            if( sx >= src_width-1 && (interpolation != INTER_CUBIC && interpolation != INTER_LANCZOS4))
+            if( sx >= src_width-1 && (interp != INTER_CUBIC && interp != INTER_LANCZOS4))
                 fx = 0, sx = src_width-1;
         }
 
         for( k = 0, sx *= cn; k < cn; k++ )
             xofs[dx*cn + k] = sx + k;
 
-        if( interpolation == INTER_CUBIC )
+        if( interp == INTER_CUBIC )
             interpolateCubic( fx, cbuf );
-        else if( interpolation == INTER_LANCZOS4 )
+        else if( interp == INTER_LANCZOS4 )
             interpolateLanczos4( fx, cbuf );
         else
         {
@@ -4089,9 +5135,9 @@ void resize(int src_type,
         else
         {
             for( k = 0; k < ksize; k++ )
-                alpha[dx*cn*ksize + k] = cbuf[k];
+                falpha[dx*cn*ksize + k] = cbuf[k];
             for( ; k < cn*ksize; k++ )
-                alpha[dx*cn*ksize + k] = alpha[dx*cn*ksize + k - ksize];
+                falpha[dx*cn*ksize + k] = falpha[dx*cn*ksize + k - ksize];
         }
     }
 
@@ -4111,9 +5157,9 @@ void resize(int src_type,
         }
 
         yofs[dy] = sy;
-        if( interpolation == INTER_CUBIC )
+        if( interp == INTER_CUBIC )
             interpolateCubic( fy, cbuf );
-        else if( interpolation == INTER_LANCZOS4 )
+        else if( interp == INTER_LANCZOS4 )
             interpolateLanczos4( fy, cbuf );
         else
         {
@@ -4129,26 +5175,333 @@ void resize(int src_type,
         else
         {
             for( k = 0; k < ksize; k++ )
-                beta[dy*ksize + k] = cbuf[k];
+                fbeta[dy*ksize + k] = cbuf[k];
         }
     }
 
-    func( src, dst, xofs, fixpt ? (void*)ialpha : (void*)alpha, yofs,
-          fixpt ? (void*)ibeta : (void*)beta, xmin, xmax, ksize );
+    alpha = fixpt ? (void*)ialpha : (void*)falpha;
+    beta = fixpt ? (void*)ibeta : (void*)fbeta;
+    mode = RESIZE_GENERIC;
 }
 
-} // cv::hal::
-} // cv::
+// computes the destination rows 'rows' of the resized image
+void ResizePlan::Impl::run(const uchar* src_data, size_t src_step, uchar* dst_data, size_t dst_step, const Range& rows) const
+{
+    CV_DbgAssert(mode >= 0);
+
+    int cn = CV_MAT_CN(type);
+    Mat src(ssize, type, const_cast<uchar*>(src_data), src_step);
+    Mat dst(dsize, type, dst_data, dst_step);
+
+    switch( mode )
+    {
+    case RESIZE_BITEXACT:
+        be_funcs.run(be_tab, src_data, src_step, ssize.width, ssize.height,
+                     dst_data, dst_step, dst_width, dst_height, cn, rows);
+        break;
+    case RESIZE_NN:
+        resizeNN( src, dst, xofs, 1./inv_scale_y, rows );
+        break;
+    case RESIZE_NN_EXACT:
+        resizeNN_bitexact( src, dst, xofs, rows );
+        break;
+    case RESIZE_AREA_FAST:
+        {
+            int area = iscale_x*iscale_y;
+            size_t srcstep = src_step / src.elemSize1();
+            AutoBuffer<int> _ofs(area);
+            int* ofs = _ofs.data();
+
+            for( int sy = 0, k = 0; sy < iscale_y; sy++ )
+                for( int sx = 0; sx < iscale_x; sx++ )
+                    ofs[k++] = (int)(sy*srcstep + sx*cn);
+
+            areafast_func( src, dst, ofs, xofs, iscale_x, iscale_y, rows );
+        }
+        break;
+    case RESIZE_AREA:
+        area_funcs.func( src, dst, xtab, xtab_size, ytab, ytab_size, tabofs, rows );
+        break;
+    case RESIZE_RESAMPLE:
+        resizeResample_( src, dst, resample_funcs, xofs, xcnt, alpha, xksize, yofs, ycnt, beta, ksize, rows );
+        break;
+    default:
+        funcs.func( src, dst, xofs, alpha, yofs, beta, xmin, xmax, ksize, rows );
+    }
+}
 
 //==================================================================================================
 
-void cv::resize( InputArray _src, OutputArray _dst, Size dsize,
-                 double inv_scale_x, double inv_scale_y, int interpolation )
+struct ResizeStream::Impl
 {
-    CV_INSTRUMENT_REGION();
+    Impl(int _type, Size _ssize, Size _dsize, double _inv_scale_x, double _inv_scale_y, int _interpolation);
+
+    void reset();
+    int firstSrcRow(int dy) const;
+    int lastSrcRow(int dy) const;
+    void pushRow(const uchar* S, Mat& dst, int dst_row0);
+
+    ResizePlan::Impl plan;
+    bool copy;
+    int consumed, produced;
+    int ify, ify0;
+    size_t betastep;
+    // intermediate rows: horizontally resized source rows (generic and bit-exact linear modes),
+    // the horizontal pass and two accumulated destination rows (area mode) or
+    // the source rows of the current cell row (fast area mode) or of the vertical window (resampling)
+    AutoBuffer<uchar> ring;
+    size_t ringstep;
+    int ringrows;
+    AutoBuffer<int> areaofs;
+    AutoBuffer<uchar> rowbuf;
+    int ytabpos;
 
-    Size ssize = _src.size();
+private:
+    Impl(const Impl&);
+    Impl& operator=(const Impl&);
+};
+
+ResizeStream::Impl::Impl(int _type, Size _ssize, Size _dsize, double _inv_scale_x, double _inv_scale_y, int _interpolation) :
+    plan(_type, _ssize.width, _ssize.height, _dsize.width, _dsize.height, _inv_scale_x, _inv_scale_y, _interpolation),
+    copy(_ssize == _dsize), consumed(0), produced(0), ify(0), ify0(0), betastep(0), ringstep(0), ringrows(0), ytabpos(0)
+{
+    if (copy)
+        return;
+
+    plan.computeTabs();
+
+    int cn = CV_MAT_CN(plan.type);
+    int width = plan.dsize.width*cn;
+    switch (plan.mode)
+    {
+    case ResizePlan::Impl::RESIZE_NN:
+        break;
+    case ResizePlan::Impl::RESIZE_NN_EXACT:
+        ify = ((plan.ssize.height << 16) + plan.dsize.height / 2) / plan.dsize.height;
+        ify0 = ify / 2 - plan.ssize.height % 2;
+        break;
+    case ResizePlan::Impl::RESIZE_BITEXACT:
+        ringrows = plan.be_funcs.len;
+        ringstep = width*plan.be_funcs.bufelemsize;
+        break;
+    case ResizePlan::Impl::RESIZE_AREA_FAST:
+        {
+            ringrows = plan.iscale_y;
+            ringstep = plan.ssize.width*CV_ELEM_SIZE(plan.type);
+            areaofs.allocate(plan.iscale_x*plan.iscale_y);
+            size_t srcstep = ringstep / CV_ELEM_SIZE1(plan.type);
+            for( int sy = 0, k = 0; sy < plan.iscale_y; sy++ )
+                for( int sx = 0; sx < plan.iscale_x; sx++ )
+                    areaofs[k++] = (int)(sy*srcstep + sx*cn);
+        }
+        break;
+    case ResizePlan::Impl::RESIZE_AREA:
+        ringrows = 3;
+        ringstep = width*plan.area_funcs.bufelemsize;
+        break;
+    case ResizePlan::Impl::RESIZE_RESAMPLE:
+        ringrows = plan.ksize;
+        ringstep = plan.ssize.width*CV_ELEM_SIZE(plan.type);
+        betastep = plan.ksize*plan.resample_funcs.coefelemsize;
+        rowbuf.allocate(plan.ssize.width*cn*plan.resample_funcs.bufelemsize);
+        break;
+    default:
+        ringrows = plan.ksize;
+        ringstep = alignSize(width, 16)*plan.funcs.bufelemsize;
+        betastep = plan.ksize*(CV_MAT_DEPTH(plan.type) == CV_8U ? sizeof(short) : sizeof(float));
+    }
+    ring.allocate(ringrows*ringstep);
+    if (plan.mode == ResizePlan::Impl::RESIZE_BITEXACT && plan.ssize.height < ringrows)
+        memset(ring.data(), 0, ringrows*ringstep); // the missing rows are multiplied by zero coefficients
+}
+
+void ResizeStream::Impl::reset()
+{
+    consumed = produced = ytabpos = 0;
+}
+
+int ResizeStream::Impl::firstSrcRow(int dy) const
+{
+    int src_height = plan.ssize.height;
+    if (copy)
+        return dy;
+
+    switch (plan.mode)
+    {
+    case ResizePlan::Impl::RESIZE_BITEXACT:
+        return dy < plan.be_tab.min_y ? 0 : dy >= plan.be_tab.max_y ? src_height - 1 : plan.be_tab.yoffsets[dy];
+    case ResizePlan::Impl::RESIZE_AREA_FAST:
+        return std::min(dy*plan.iscale_y, src_height - 1);
+    case ResizePlan::Impl::RESIZE_AREA:
+        return plan.ytab[plan.tabofs[dy]].si;
+    case ResizePlan::Impl::RESIZE_GENERIC:
+        return clip(plan.yofs[dy] - plan.ksize/2 + 1, 0, src_height);
+    case ResizePlan::Impl::RESIZE_RESAMPLE:
+        return plan.yofs[dy];
+    default:
+        return lastSrcRow(dy);
+    }
+}
+
+int ResizeStream::Impl::lastSrcRow(int dy) const
+{
+    int src_height = plan.ssize.height;
+    if (copy)
+        return dy;
+
+    switch (plan.mode)
+    {
+    case ResizePlan::Impl::RESIZE_NN:
+        {
+            double fy = 1./plan.inv_scale_y;
+            return std::min(cvFloor(dy*fy), src_height - 1);
+        }
+    case ResizePlan::Impl::RESIZE_NN_EXACT:
+        return std::min((ify*dy + ify0) >> 16, src_height - 1);
+    case ResizePlan::Impl::RESIZE_BITEXACT:
+        return dy < plan.be_tab.min_y ? 0 : dy >= plan.be_tab.max_y ? src_height - 1 :
+               std::min(plan.be_tab.yoffsets[dy] + plan.be_funcs.len, src_height) - 1;
+    case ResizePlan::Impl::RESIZE_AREA_FAST:
+        return std::min((dy + 1)*plan.iscale_y, src_height) - 1;
+    case ResizePlan::Impl::RESIZE_AREA:
+        return plan.ytab[plan.tabofs[dy + 1] - 1].si;
+    case ResizePlan::Impl::RESIZE_RESAMPLE:
+        return plan.yofs[dy] + plan.ycnt[dy] - 1;
+    default:
+        return clip(plan.yofs[dy] + plan.ksize/2, 0, src_height);
+    }
+}
+
+// consumes the next source row and stores the destination rows completed by it into dst,
+// where dst_row0 is the index of the destination row stored into the first row of dst
+void ResizeStream::Impl::pushRow(const uchar* S, Mat& dst, int dst_row0)
+{
+    int sy = consumed++;
+    int cn = CV_MAT_CN(plan.type);
+    int src_height = plan.ssize.height, dst_height = plan.dsize.height;
+    int width = plan.dsize.width*cn;
+
+    if (copy)
+    {
+        memcpy(dst.ptr(sy - dst_row0), S, dst.cols*dst.elemSize());
+        produced++;
+        return;
+    }
+
+    // source rows which are not used by the pending destination rows (e.g. when downscaling) are skipped
+    bool needed = produced < dst_height && sy >= firstSrcRow(produced);
+    switch (plan.mode)
+    {
+    case ResizePlan::Impl::RESIZE_NN:
+    case ResizePlan::Impl::RESIZE_NN_EXACT:
+        break;
+    case ResizePlan::Impl::RESIZE_BITEXACT:
+        if (needed)
+            plan.be_funcs.hrow(plan.be_tab, S, plan.ssize.width, plan.dsize.width, cn,
+                               ring.data() + (sy % ringrows)*ringstep);
+        break;
+    case ResizePlan::Impl::RESIZE_AREA_FAST:
+    case ResizePlan::Impl::RESIZE_RESAMPLE:
+        if (needed)
+            memcpy(ring.data() + (sy % ringrows)*ringstep, S, ringstep);
+        break;
+    case ResizePlan::Impl::RESIZE_AREA:
+        {
+            // a source row contributes to one or two adjacent destination rows,
+            // their sums are accumulated in the same order as in resizeArea_
+            uchar* buf = ring.data();
+            bool hdone = false;
+            for( ; ytabpos < plan.ytab_size && plan.ytab[ytabpos].si == sy; ytabpos++ )
+            {
+                int dy = plan.ytab[ytabpos].di;
+                uchar* sum = buf + (1 + (dy & 1))*ringstep;
+                if (!hdone)
+                {
+                    plan.area_funcs.hrow(S, buf, plan.xtab, plan.xtab_size, cn, width);
+                    hdone = true;
+                }
+                plan.area_funcs.vrow(buf, sum, plan.ytab[ytabpos].alpha, ytabpos == plan.tabofs[dy], width);
+                if (ytabpos == plan.tabofs[dy + 1] - 1)
+                {
+                    plan.area_funcs.store(sum, dst.ptr(dy - dst_row0), width);
+                    produced = dy + 1;
+                }
+            }
+        }
+        return;
+    default:
+        if (needed)
+            plan.funcs.hrow(S, ring.data() + (sy % ringrows)*ringstep, plan.xofs, plan.alpha,
+                            plan.ssize.width*cn, width, cn, plan.xmin*cn, plan.xmax*cn);
+    }
+
+    for( ; produced < dst_height && lastSrcRow(produced) <= sy; produced++ )
+    {
+        int dy = produced;
+        uchar* D = dst.ptr(dy - dst_row0);
+        CV_DbgAssert(lastSrcRow(dy) == sy);
+
+        switch (plan.mode)
+        {
+        case ResizePlan::Impl::RESIZE_NN:
+        case ResizePlan::Impl::RESIZE_NN_EXACT:
+            {
+                // resize of the single source row to the single destination row picks the same columns
+                Mat srow(1, plan.ssize.width, plan.type, const_cast<uchar*>(S));
+                Mat drow(1, plan.dsize.width, plan.type, D);
+                if (plan.mode == ResizePlan::Impl::RESIZE_NN)
+                    resizeNN(srow, drow, plan.xofs, 1., Range(0, 1));
+                else
+                    resizeNN_bitexact(srow, drow, plan.xofs, Range(0, 1));
+            }
+            break;
+        case ResizePlan::Impl::RESIZE_BITEXACT:
+            if (dy < plan.be_tab.min_y || dy >= plan.be_tab.max_y)
+                plan.be_funcs.setrow(ring.data() + (sy % ringrows)*ringstep, D, plan.dsize.width, cn);
+            else
+                plan.be_funcs.vrow(plan.be_tab, ring.data(), plan.be_tab.yoffsets[dy] % ringrows, dy,
+                                   D, plan.dsize.width, cn);
+            break;
+        case ResizePlan::Impl::RESIZE_AREA_FAST:
+            {
+                int sy0 = dy*plan.iscale_y;
+                if (sy0 >= src_height)
+                {
+                    memset(D, 0, width*CV_ELEM_SIZE1(plan.type));
+                    break;
+                }
+                Mat band(std::min(plan.iscale_y, src_height - sy0), plan.ssize.width, plan.type, ring.data(), ringstep);
+                Mat drow(1, plan.dsize.width, plan.type, D);
+                plan.areafast_func(band, drow, areaofs.data(), plan.xofs, plan.iscale_x, plan.iscale_y, Range(0, 1));
+            }
+            break;
+        case ResizePlan::Impl::RESIZE_RESAMPLE:
+            {
+                int n = plan.ycnt[dy];
+                AutoBuffer<const uchar*> _rows(n);
+                const uchar** rows = _rows.data();
+                for( int k = 0; k < n; k++ )
+                    rows[k] = ring.data() + ((plan.yofs[dy] + k) % ringrows)*ringstep;
+                plan.resample_funcs.vrow(rows, rowbuf.data(), (const uchar*)plan.beta + dy*betastep, n, plan.ssize.width*cn);
+                plan.resample_funcs.hrow(rowbuf.data(), D, plan.xofs, plan.xcnt, plan.alpha, plan.xksize,
+                                         plan.ssize.width, plan.dsize.width, cn);
+            }
+            break;
+        default:
+            {
+                const uchar* rows[MAX_ESIZE];
+                int sy0 = plan.yofs[dy], ksize2 = plan.ksize/2;
+                for( int k = 0; k < plan.ksize; k++ )
+                    rows[k] = ring.data() + (clip(sy0 - ksize2 + 1 + k, 0, src_height) % ringrows)*ringstep;
+                plan.funcs.vrow(rows, D, (const uchar*)plan.beta + dy*betastep, width);
+            }
+        }
+    }
+}
 
+static void normalizeResizeParams( Size ssize, int depth, Size& dsize,
+                                   double& inv_scale_x, double& inv_scale_y, int& interpolation )
+{
     CV_Assert( !ssize.empty() );
     if( dsize.empty() )
     {
@@ -4164,8 +5517,133 @@ void cv::resize( InputArray _src, OutputArray _dst, Size dsize,
         CV_Assert(inv_scale_x > 0); CV_Assert(inv_scale_y > 0);
     }
 
-    if (interpolation == INTER_LINEAR_EXACT && (_src.depth() == CV_32F || _src.depth() == CV_64F))
+    if (interpolation == INTER_LINEAR_EXACT && (depth == CV_32F || depth == CV_64F))
         interpolation = INTER_LINEAR; // If depth isn't supported fallback to generic resize
+    if (interpolation == INTER_CUBIC_EXACT && (depth == CV_32F || depth == CV_64F))
+        interpolation = INTER_CUBIC;
+
+    if (interpolation & INTER_ANTIALIAS)
+    {
+        int interp = interpolation & ~INTER_ANTIALIAS;
+        if (interp != INTER_LINEAR && interp != INTER_CUBIC && interp != INTER_LANCZOS4)
+            CV_Error(cv::Error::StsBadArg, "INTER_ANTIALIAS can only be combined with INTER_LINEAR, INTER_CUBIC or INTER_LANCZOS4");
+    }
+}
+
+// INTER_ANTIALIAS and INTER_CUBIC_EXACT are unknown to the HAL and IPP implementations,
+// some of which would fall back to the plain interpolation instead of rejecting the call
+static inline bool isExternalResizeInterpolation(int interpolation)
+{
+    return (interpolation & INTER_ANTIALIAS) == 0 && interpolation != INTER_CUBIC_EXACT;
+}
+
+// tries the HAL and IPP implementations, which process the whole image; done is set if one of them did the job
+static void applyPlanExternal( const ResizePlan::Impl& plan,
+                               const uchar* src_data, size_t src_step, uchar* dst_data, size_t dst_step, bool& done )
+{
+    done = false;
+    if (!isExternalResizeInterpolation(plan.interpolation))
+        return;
+
+    done = true;
+
+    CALL_HAL(resize, cv_hal_resize, plan.type, src_data, src_step, plan.ssize.width, plan.ssize.height, dst_data, dst_step, plan.dst_width, plan.dst_height, plan.inv_scale_x, plan.inv_scale_y, plan.interpolation);
+
+    CV_IPP_RUN_FAST(ipp_resize(src_data, src_step, plan.ssize.width, plan.ssize.height, dst_data, dst_step, plan.dsize.width, plan.dsize.height, plan.inv_scale_x, plan.inv_scale_y, CV_MAT_DEPTH(plan.type), CV_MAT_CN(plan.type), plan.interpolation))
+
+    done = false;
+}
+
+static void applyPlan( const ResizePlan::Impl& plan,
+                       const uchar* src_data, size_t src_step, uchar* dst_data, size_t dst_step )
+{
+    bool done = false;
+    applyPlanExternal(plan, src_data, src_step, dst_data, dst_step, done);
+    if (!done)
+        plan.run(src_data, src_step, dst_data, dst_step, Range(0, plan.dsize.height));
+}
+
+// resizes a batch of images in a single parallel job over (image, row stripe) pairs
+class ResizeBatchInvoker : public ParallelLoopBody
+{
+public:
+    ResizeBatchInvoker(const std::vector<Mat>& _src, std::vector<Mat>& _dst,
+                       const std::vector<const ResizePlan::Impl*>& _plans, const std::vector<uchar>& _done,
+                       int _nstripes) :
+        ParallelLoopBody(), src(_src), dst(_dst), plans(_plans), done(_done), nstripes(_nstripes)
+    {
+    }
+
+    virtual void operator() (const Range& range) const CV_OVERRIDE
+    {
+        for (int t = range.start; t < range.end; t++)
+        {
+            int i = t / nstripes, stripe = t % nstripes;
+            const Mat& S = src[i];
+            Mat& D = dst[i];
+            Range rows(stripe*D.rows/nstripes, (stripe + 1)*D.rows/nstripes);
+            if (rows.empty())
+                continue;
+
+            const ResizePlan::Impl* plan = plans[i];
+            if (!plan)
+                S.rowRange(rows).copyTo(D.rowRange(rows));
+            else if (nstripes == 1)
+                applyPlan(*plan, S.data, S.step, D.data, D.step);
+            else if (!done[i]) // the nested parallel_for_ calls of the stripe are executed sequentially
+                plan->run(S.data, S.step, D.data, D.step, rows);
+        }
+    }
+
+private:
+    const std::vector<Mat>& src;
+    std::vector<Mat>& dst;
+    const std::vector<const ResizePlan::Impl*>& plans;
+    const std::vector<uchar>& done;
+    int nstripes;
+
+    ResizeBatchInvoker(const ResizeBatchInvoker&);
+    ResizeBatchInvoker& operator=(const ResizeBatchInvoker&);
+};
+
+//==================================================================================================
+
+namespace hal {
+
+void resize(int src_type,
+            const uchar * src_data, size_t src_step, int src_width, int src_height,
+            uchar * dst_data, size_t dst_step, int dst_width, int dst_height,
+            double inv_scale_x, double inv_scale_y, int interpolation)
+{
+    CV_INSTRUMENT_REGION();
+
+    ResizePlan::Impl plan(src_type, src_width, src_height, dst_width, dst_height,
+                          inv_scale_x, inv_scale_y, interpolation);
+
+    if (isExternalResizeInterpolation(interpolation))
+    {
+        CALL_HAL(resize, cv_hal_resize, src_type, src_data, src_step, src_width, src_height, dst_data, dst_step, dst_width, dst_height, plan.inv_scale_x, plan.inv_scale_y, interpolation);
+
+        CV_IPP_RUN_FAST(ipp_resize(src_data, src_step, src_width, src_height, dst_data, dst_step, plan.dsize.width, plan.dsize.height, plan.inv_scale_x, plan.inv_scale_y, CV_MAT_DEPTH(src_type), CV_MAT_CN(src_type), interpolation))
+    }
+
+    plan.computeTabs();
+    plan.run(src_data, src_step, dst_data, dst_step, Range(0, plan.dsize.height));
+}
+
+} // cv::hal::
+} // cv::
+
+//==================================================================================================
+
+void cv::resize( InputArray _src, OutputArray _dst, Size dsize,
+                 double inv_scale_x, double inv_scale_y, int interpolation )
+{
+    CV_INSTRUMENT_REGION();
+
+    Size ssize = _src.size();
+
+    normalizeResizeParams(ssize, _src.depth(), dsize, inv_scale_x, inv_scale_y, interpolation);
 
     CV_OCL_RUN(_src.dims() <= 2 && _dst.isUMat() && _src.cols() > 10 && _src.rows() > 10,
                ocl_resize(_src, _dst, dsize, inv_scale_x, inv_scale_y, interpolation))
@@ -4189,6 +5667,239 @@ void cv::resize( InputArray _src, OutputArray _dst, Size dsize,
     hal::resize(src.type(), src.data, src.step, src.cols, src.rows, dst.data, dst.step, dst.cols, dst.rows, inv_scale_x, inv_scale_y, interpolation);
 }
 
+void cv::resizeBatch( InputArrayOfArrays _src, OutputArrayOfArrays _dst, Size dsize, int interpolation )
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert( !dsize.empty() );
+
+    std::vector<Mat> src;
+    _src.getMatVector(src);
+    if (src.empty())
+    {
+        _dst.release();
+        return;
+    }
+
+    int n = (int)src.size();
+    _dst.create(n, 1, src[0].type(), -1, true);
+    for (int i = 0; i < n; i++)
+        _dst.create(dsize, src[i].type(), i, true);
+    std::vector<Mat> dst;
+    _dst.getMatVector(dst);
+
+    // the tables are computed once for every distinct source geometry
+    std::vector<std::shared_ptr<ResizePlan::Impl> > uniquePlans;
+    std::vector<const ResizePlan::Impl*> plans(n, (const ResizePlan::Impl*)0);
+    for (int i = 0; i < n; i++)
+    {
+        const Mat& s = src[i];
+        CV_Assert( s.dims <= 2 );
+        if (s.size() == dsize)
+            continue;
+
+        int interp = interpolation;
+        double inv_scale_x = 0, inv_scale_y = 0;
+        Size sz = dsize;
+        normalizeResizeParams(s.size(), s.depth(), sz, inv_scale_x, inv_scale_y, interp);
+
+        for (size_t j = 0; j < uniquePlans.size(); j++)
+        {
+            const ResizePlan::Impl& p = *uniquePlans[j];
+            if (p.ssize == s.size() && p.type == s.type())
+            {
+                plans[i] = &p;
+                break;
+            }
+        }
+        if (!plans[i])
+        {
+            uniquePlans.push_back(std::make_shared<ResizePlan::Impl>(s.type(), s.cols, s.rows, dsize.width, dsize.height,
+                                                                     inv_scale_x, inv_scale_y, interp));
+            uniquePlans.back()->computeTabs();
+            plans[i] = uniquePlans.back().get();
+        }
+    }
+
+    // large batches are split by images only; for small ones the images are also split into stripes,
+    // so that every thread gets a few tasks
+    int nthreads = getNumThreads();
+    int nstripes = nthreads > 1 ? std::min(dsize.height, std::max(1, (nthreads*4 + n - 1) / n)) : 1;
+
+    // HAL and IPP can't process a stripe, they get the whole images first, so that the results match cv::resize
+    std::vector<uchar> done(n, (uchar)0);
+    if (nstripes > 1)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (!plans[i])
+                continue;
+            bool ok = false;
+            applyPlanExternal(*plans[i], src[i].data, src[i].step, dst[i].data, dst[i].step, ok);
+            done[i] = ok;
+        }
+    }
+
+    ResizeBatchInvoker invoker(src, dst, plans, done, nstripes);
+    parallel_for_(Range(0, n*nstripes), invoker);
+}
+
+//==================================================================================================
+
+cv::ResizePlan::ResizePlan()
+{
+    // nothing
+}
+
+cv::ResizePlan::ResizePlan( Size ssize, int type, Size dsize,
+                            double inv_scale_x, double inv_scale_y, int interpolation )
+{
+    CV_INSTRUMENT_REGION();
+
+    normalizeResizeParams(ssize, CV_MAT_DEPTH(type), dsize, inv_scale_x, inv_scale_y, interpolation);
+
+    impl = std::make_shared<Impl>(type, ssize.width, ssize.height, dsize.width, dsize.height,
+                                  inv_scale_x, inv_scale_y, interpolation);
+    if (dsize != ssize)
+        impl->computeTabs();
+}
+
+bool cv::ResizePlan::empty() const
+{
+    return !impl;
+}
+
+cv::Size cv::ResizePlan::srcSize() const
+{
+    return impl ? impl->ssize : Size();
+}
+
+cv::Size cv::ResizePlan::dstSize() const
+{
+    return impl ? Size(impl->dst_width, impl->dst_height) : Size();
+}
+
+int cv::ResizePlan::type() const
+{
+    return impl ? impl->type : -1;
+}
+
+void cv::ResizePlan::apply( InputArray _src, OutputArray _dst ) const
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert(!empty());
+    const Impl& plan = *impl;
+    CV_CheckTypeEQ(_src.type(), plan.type, "Source type doesn't match the resize plan");
+    CV_CheckEQ(_src.size(), plan.ssize, "Source size doesn't match the resize plan");
+
+    // Fake reference to source. Resolves issue 13577 in case of src == dst.
+    UMat srcUMat;
+    if (_src.isUMat())
+        srcUMat = _src.getUMat();
+
+    Mat src = _src.getMat();
+    _dst.create(dstSize(), plan.type);
+    Mat dst = _dst.getMat();
+
+    if (dst.size() == plan.ssize)
+    {
+        src.copyTo(dst);
+        return;
+    }
+
+    applyPlan(plan, src.data, src.step, dst.data, dst.step);
+}
+
+//==================================================================================================
+
+cv::ResizeStream::ResizeStream()
+{
+    // nothing
+}
+
+cv::ResizeStream::ResizeStream( Size ssize, int type, Size dsize,
+                                double inv_scale_x, double inv_scale_y, int interpolation )
+{
+    CV_INSTRUMENT_REGION();
+
+    normalizeResizeParams(ssize, CV_MAT_DEPTH(type), dsize, inv_scale_x, inv_scale_y, interpolation);
+
+    impl = std::make_shared<Impl>(type, ssize, dsize, inv_scale_x, inv_scale_y, interpolation);
+}
+
+int cv::ResizeStream::push( InputArray _rows, OutputArray _dst )
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert(!empty());
+    Impl& stream = *impl;
+    Mat rows = _rows.getMat();
+    CV_CheckTypeEQ(rows.type(), stream.plan.type, "Rows type doesn't match the resize stream");
+    CV_CheckEQ(rows.cols, stream.plan.ssize.width, "Rows width doesn't match the resize stream");
+    CV_CheckLE(stream.consumed + rows.rows, stream.plan.ssize.height, "Too many source rows have been pushed");
+
+    int src_end = stream.consumed + rows.rows;
+    int dst_row0 = stream.produced, dst_end = dst_row0;
+    while (dst_end < stream.plan.dsize.height && stream.lastSrcRow(dst_end) < src_end)
+        dst_end++;
+
+    Mat dst;
+    if (dst_end > dst_row0)
+    {
+        _dst.create(dst_end - dst_row0, stream.plan.dsize.width, stream.plan.type);
+        dst = _dst.getMat();
+    }
+    else
+        _dst.release();
+
+    for (int i = 0; i < rows.rows; i++)
+        stream.pushRow(rows.ptr(i), dst, dst_row0);
+    CV_Assert(stream.produced == dst_end);
+
+    return dst_end - dst_row0;
+}
+
+void cv::ResizeStream::reset()
+{
+    CV_Assert(!empty());
+    impl->reset();
+}
+
+int cv::ResizeStream::consumedRows() const
+{
+    return impl ? impl->consumed : 0;
+}
+
+int cv::ResizeStream::producedRows() const
+{
+    return impl ? impl->produced : 0;
+}
+
+bool cv::ResizeStream::finished() const
+{
+    return impl && impl->produced == impl->plan.dsize.height;
+}
+
+bool cv::ResizeStream::empty() const
+{
+    return !impl;
+}
+
+cv::Size cv::ResizeStream::srcSize() const
+{
+    return impl ? impl->plan.ssize : Size();
+}
+
+cv::Size cv::ResizeStream::dstSize() const
+{
+    return impl ? impl->plan.dsize : Size();
+}
+
+int cv::ResizeStream::type() const
+{
+    return impl ? impl->plan.type : -1;
+}
 
 CV_IMPL void
 cvResize( const CvArr* srcarr, CvArr* dstarr, int method )
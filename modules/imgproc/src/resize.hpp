@@ -58,6 +58,15 @@ namespace opt_AVX2
 #if CV_TRY_AVX2
 void resizeNN2_AVX2(const Range&, const Mat&, Mat&, int*, double);
 void resizeNN4_AVX2(const Range&, const Mat&, Mat&, int*, double);
+
+int HResizeCubicVec_8u32s_AVX2(const uchar** src, int** dst, int count, const int* xofs,
+    const short* alpha, int swidth, int dwidth, int cn, int xmin, int xmax);
+int HResizeLanczos4Vec_8u32s_AVX2(const uchar** src, int** dst, int count, const int* xofs,
+    const short* alpha, int swidth, int dwidth, int cn, int xmin, int xmax);
+
+int hlineResizeCubicExact_8u_AVX2(const uchar* src, int cn, const int* ofst, const int* m, int* dst,
+    int i, int dst_max, int dst_width);
+int vlineResizeCubicExact_8u_AVX2(const int* src, size_t src_step, const int* beta, uchar* dst, int dst_width);
 #endif
 }
 
@@ -68,6 +77,23 @@ void resizeNN2_SSE4_1(const Range&, const Mat&, Mat&, int*, double);
 void resizeNN4_SSE4_1(const Range&, const Mat&, Mat&, int*, double);
 
 int VResizeLanczos4Vec_32f16u_SSE41(const float** src, ushort* dst, const float* beta, int width);
+
+int HResizeCubicVec_8u32s_SSE4_1(const uchar** src, int** dst, int count, const int* xofs,
+    const short* alpha, int swidth, int dwidth, int cn, int xmin, int xmax);
+int HResizeCubicVec_16u32f_SSE4_1(const ushort** src, float** dst, int count, const int* xofs,
+    const float* alpha, int swidth, int dwidth, int cn, int xmin, int xmax);
+int HResizeCubicVec_16s32f_SSE4_1(const short** src, float** dst, int count, const int* xofs,
+    const float* alpha, int swidth, int dwidth, int cn, int xmin, int xmax);
+int HResizeLanczos4Vec_8u32s_SSE4_1(const uchar** src, int** dst, int count, const int* xofs,
+    const short* alpha, int swidth, int dwidth, int cn, int xmin, int xmax);
+int HResizeLanczos4Vec_16u32f_SSE4_1(const ushort** src, float** dst, int count, const int* xofs,
+    const float* alpha, int swidth, int dwidth, int cn, int xmin, int xmax);
+int HResizeLanczos4Vec_16s32f_SSE4_1(const short** src, float** dst, int count, const int* xofs,
+    const float* alpha, int swidth, int dwidth, int cn, int xmin, int xmax);
+
+int hlineResizeCubicExact_8u_SSE4_1(const uchar* src, int cn, const int* ofst, const int* m, int* dst,
+    int i, int dst_max, int dst_width);
+int vlineResizeCubicExact_8u_SSE4_1(const int* src, size_t src_step, const int* beta, uchar* dst, int dst_width);
 #endif
 }
 
@@ -48,6 +48,7 @@
 // */
 
 #include "precomp.hpp"
+#include "opencv2/core/hal/intrin.hpp"
 #include "resize.hpp"
 
 namespace cv
@@ -225,6 +226,57 @@ int VResizeLanczos4Vec_32f16u_SSE41(const float** src, ushort* dst, const float*
     return x;
 }
 
+
+#include "resize_hresize.inc.hpp"
+#include "resize_bitexact.inc.hpp"
+
+int HResizeCubicVec_8u32s_SSE4_1(const uchar** src, int** dst, int count, const int* xofs,
+    const short* alpha, int swidth, int, int cn, int xmin, int xmax)
+{
+    return hresizeCubicVec_8u32s(src, dst, count, xofs, alpha, swidth, cn, xmin, xmax);
+}
+
+int HResizeCubicVec_16u32f_SSE4_1(const ushort** src, float** dst, int count, const int* xofs,
+    const float* alpha, int swidth, int, int cn, int xmin, int xmax)
+{
+    return hresizeCubicVec_16x32f(src, dst, count, xofs, alpha, swidth, cn, xmin, xmax);
+}
+
+int HResizeCubicVec_16s32f_SSE4_1(const short** src, float** dst, int count, const int* xofs,
+    const float* alpha, int swidth, int, int cn, int xmin, int xmax)
+{
+    return hresizeCubicVec_16x32f(src, dst, count, xofs, alpha, swidth, cn, xmin, xmax);
+}
+
+int HResizeLanczos4Vec_8u32s_SSE4_1(const uchar** src, int** dst, int count, const int* xofs,
+    const short* alpha, int swidth, int, int cn, int xmin, int xmax)
+{
+    return hresizeLanczos4Vec_8u32s(src, dst, count, xofs, alpha, swidth, cn, xmin, xmax);
+}
+
+int HResizeLanczos4Vec_16u32f_SSE4_1(const ushort** src, float** dst, int count, const int* xofs,
+    const float* alpha, int swidth, int, int cn, int xmin, int xmax)
+{
+    return hresizeLanczos4Vec_16x32f(src, dst, count, xofs, alpha, swidth, cn, xmin, xmax);
+}
+
+int HResizeLanczos4Vec_16s32f_SSE4_1(const short** src, float** dst, int count, const int* xofs,
+    const float* alpha, int swidth, int, int cn, int xmin, int xmax)
+{
+    return hresizeLanczos4Vec_16x32f(src, dst, count, xofs, alpha, swidth, cn, xmin, xmax);
+}
+
+int hlineResizeCubicExact_8u_SSE4_1(const uchar* src, int cn, const int* ofst, const int* m, int* dst,
+    int i, int dst_max, int dst_width)
+{
+    return hlineResizeCubicExact_8u(src, cn, ofst, m, dst, i, dst_max, dst_width);
+}
+
+int vlineResizeCubicExact_8u_SSE4_1(const int* src, size_t src_step, const int* beta, uchar* dst, int dst_width)
+{
+    return vlineResizeCubicExact_8u(src, src_step, beta, dst, dst_width);
+}
+
 }
 }
 /* End of file. */
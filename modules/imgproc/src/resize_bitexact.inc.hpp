@@ -0,0 +1,107 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+// INTER_CUBIC_EXACT kernels for 8-bit images shared by resize.cpp (baseline), resize.sse4_1.cpp and resize.avx2.cpp.
+// The file is included inside the namespace of each of them, so it must not include anything.
+//
+// The coefficients are fixedpoint32 values with INTER_RESIZE_COEF_BITS (11) fractional bits, i.e. their raw 16.16
+// representation is a multiple of 32, so the kernels work with 16-bit coefficients and 16x16->32 bit dot products.
+// The horizontally resized rows are stored as raw fixedpoint32 values; the vertical pass reduces them to 6 fractional
+// bits. All the operations are exact integer ones, so the results are identical to the scalar code in resize.cpp.
+// Every kernel processes the points starting from i and returns the first one it has not processed.
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+
+static int hlineResizeCubicExact_8u(const uchar* src, int cn, const int* ofst, const int* m, int* dst,
+                                    int i, int dst_max, int dst_width)
+{
+    if (cn == 1)
+    {
+        const int VECSZ = VTraits<v_int32>::vlanes();
+        for (; i <= dst_max - VECSZ; i += VECSZ)
+        {
+            // the 4 taps of a point are adjacent, so the dot products give the sums of the tap pairs of every point
+            const int* c = m + 4*i;
+            v_uint16 v_src0, v_src1;
+            v_expand(vx_lut_quads(src, ofst + i), v_src0, v_src1);
+            v_int16 v_coeffs0 = v_pack(v_shr<5>(vx_load(c)), v_shr<5>(vx_load(c + VECSZ)));
+            v_int16 v_coeffs1 = v_pack(v_shr<5>(vx_load(c + 2*VECSZ)), v_shr<5>(vx_load(c + 3*VECSZ)));
+            v_uint64 v_res0 = v_reinterpret_as_u64(v_dotprod(v_reinterpret_as_s16(v_src0), v_coeffs0));
+            v_uint64 v_res1 = v_reinterpret_as_u64(v_dotprod(v_reinterpret_as_s16(v_src1), v_coeffs1));
+            v_int32 v_res = v_reinterpret_as_s32(v_pack(v_add(v_res0, v_shr<32>(v_res0)), v_add(v_res1, v_shr<32>(v_res1))));
+            v_store(dst + i, v_shl<5>(v_res));
+        }
+    }
+#if CV_SIMD128
+    else if (cn == 3 || cn == 4)
+    {
+        // the taps are reordered into (tap0, tap1), (tap2, tap3) pairs of every channel. For 3 channels every
+        // group starts one byte before the tap, so the taps are read without crossing the end of the row,
+        // the garbage 1st lane is rotated out and the stored 4th lane is overwritten by the next point
+        for (; i < dst_max && (cn == 4 || (i < dst_width - 1 && ofst[i] > 0)); i++)
+        {
+            v_uint8x16 v_src;
+            if (cn == 4)
+                v_src = v_load(src + 4*ofst[i]);
+            else
+            {
+                int ofs = 3*ofst[i] - 1;
+                int idx[4] = { ofs, ofs + 3, ofs + 6, ofs + 9 };
+                v_src = v_lut_quads(src, idx);
+            }
+            v_int32x4 v_coeffs = v_shr<5>(v_load(m + 4*i));
+            v_int32x4 v_coeffs16 = v_reinterpret_as_s32(v_pack(v_coeffs, v_coeffs));
+            v_uint16x8 v_src01, v_src23;
+            v_expand(v_src, v_src01, v_src23);
+            v_int32x4 v_res = v_add(v_dotprod(v_interleave_quads(v_reinterpret_as_s16(v_src01)), v_reinterpret_as_s16(v_broadcast_element<0>(v_coeffs16))),
+                                    v_dotprod(v_interleave_quads(v_reinterpret_as_s16(v_src23)), v_reinterpret_as_s16(v_broadcast_element<1>(v_coeffs16))));
+            if (cn == 3)
+                v_res = v_rotate_right<1>(v_res);
+            v_store(dst + cn*i, v_shl<5>(v_res));
+        }
+    }
+#endif
+    return i;
+}
+
+// beta holds the coefficients with 11 fractional bits
+static int vlineResizeCubicExact_8u(const int* src, size_t src_step, const int* beta, uchar* dst, int dst_width)
+{
+    const int* src0 = src;
+    const int* src1 = src0 + src_step;
+    const int* src2 = src1 + src_step;
+    const int* src3 = src2 + src_step;
+    const int VECSZ = VTraits<v_uint8>::vlanes();
+    const int QSZ = VTraits<v_int32>::vlanes();
+    const v_int32 v_fixedRound = vx_setall_s32(1 << 16);
+    const v_int16 v_b01 = v_reinterpret_as_s16(vx_setall_s32((beta[1] << 16) | (beta[0] & 0xFFFF)));
+    const v_int16 v_b23 = v_reinterpret_as_s16(vx_setall_s32((beta[3] << 16) | (beta[2] & 0xFFFF)));
+    int i = 0;
+    for (; i <= dst_width - VECSZ; i += VECSZ)
+    {
+        v_int32 v_res[4];
+        for (int k = 0; k < 4; k += 2)
+        {
+            int j = i + k*QSZ;
+            v_int16 v_src0 = v_pack(v_shr<10>(vx_load(src0 + j)), v_shr<10>(vx_load(src0 + j + QSZ)));
+            v_int16 v_src1 = v_pack(v_shr<10>(vx_load(src1 + j)), v_shr<10>(vx_load(src1 + j + QSZ)));
+            v_int16 v_src2 = v_pack(v_shr<10>(vx_load(src2 + j)), v_shr<10>(vx_load(src2 + j + QSZ)));
+            v_int16 v_src3 = v_pack(v_shr<10>(vx_load(src3 + j)), v_shr<10>(vx_load(src3 + j + QSZ)));
+            v_int16 v_src01_0, v_src01_1, v_src23_0, v_src23_1;
+            v_zip(v_src0, v_src1, v_src01_0, v_src01_1);
+            v_zip(v_src2, v_src3, v_src23_0, v_src23_1);
+            v_res[k]     = v_shr<17>(v_add(v_add(v_dotprod(v_src01_0, v_b01), v_dotprod(v_src23_0, v_b23)), v_fixedRound));
+            v_res[k + 1] = v_shr<17>(v_add(v_add(v_dotprod(v_src01_1, v_b01), v_dotprod(v_src23_1, v_b23)), v_fixedRound));
+        }
+        v_store(dst + i, v_pack_u(v_pack(v_res[0], v_res[1]), v_pack(v_res[2], v_res[3])));
+    }
+    return i;
+}
+
+#else
+
+static int hlineResizeCubicExact_8u(const uchar*, int, const int*, const int*, int*, int i, int, int) { return i; }
+static int vlineResizeCubicExact_8u(const int*, size_t, const int*, uchar*, int) { return 0; }
+
+#endif
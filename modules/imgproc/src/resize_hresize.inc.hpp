@@ -0,0 +1,239 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+// Horizontal INTER_CUBIC / INTER_LANCZOS4 kernels shared by resize.sse4_1.cpp and resize.avx2.cpp.
+// The file is included inside the opt_<CPU> namespace of each of them, so it must not include anything.
+//
+// Every kernel handles the interior part [xmin, xmax) of a row, where all the taps are inside
+// the source row, and returns the first dx it has not processed. The caller finishes the row
+// with the scalar code. xmin and xmax are always multiples of cn.
+
+#if CV_SIMD128
+
+static inline v_float32x4 hresize_load4_f32(const ushort* ptr)
+{
+    return v_cvt_f32(v_reinterpret_as_s32(v_load_expand(ptr)));
+}
+
+static inline v_float32x4 hresize_load4_f32(const short* ptr)
+{
+    return v_cvt_f32(v_load_expand(ptr));
+}
+
+// 8u, 4 taps; sums are exact, so the result is bit-identical to the scalar loop
+static int hresizeCubicVec_8u32s(const uchar** src, int** dst, int count, const int* xofs,
+                                 const short* alpha, int swidth, int cn, int xmin, int xmax)
+{
+    int dx = xmin;
+    for( int k = 0; k < count; k++ )
+    {
+        const uchar* S = src[k];
+        int* D = dst[k];
+        dx = xmin;
+        if( cn == 1 )
+        {
+            for( ; dx <= xmax - 8; dx += 8 )
+            {
+                v_int32x4 a01_l, a23_l, a01_h, a23_h;
+                v_load_deinterleave((const int*)(alpha + dx*4), a01_l, a23_l);
+                v_load_deinterleave((const int*)(alpha + dx*4 + 16), a01_h, a23_h);
+                v_uint16x8 s01_l, s01_h, s23_l, s23_h;
+                v_expand(v_lut_pairs(S - 1, xofs + dx), s01_l, s01_h);
+                v_expand(v_lut_pairs(S + 1, xofs + dx), s23_l, s23_h);
+                v_store(D + dx, v_add(v_dotprod(v_reinterpret_as_s16(s01_l), v_reinterpret_as_s16(a01_l)),
+                                      v_dotprod(v_reinterpret_as_s16(s23_l), v_reinterpret_as_s16(a23_l))));
+                v_store(D + dx + 4, v_add(v_dotprod(v_reinterpret_as_s16(s01_h), v_reinterpret_as_s16(a01_h)),
+                                          v_dotprod(v_reinterpret_as_s16(s23_h), v_reinterpret_as_s16(a23_h))));
+            }
+        }
+        else if( cn == 3 || cn == 4 )
+        {
+            // the 4 taps of a pixel are gathered as 4 groups of 4 channels and
+            // reordered into (tap0, tap1), (tap2, tap3) pairs of each channel;
+            // for cn == 3 the 4th lane is garbage and is overwritten by the next pixel
+            for( ; dx < xmax - 3 && xofs[dx] + cn*2 + 4 <= swidth; dx += cn )
+            {
+                int sx = xofs[dx];
+                v_uint8x16 s;
+                if( cn == 4 )
+                    s = v_load(S + sx - 4);
+                else
+                {
+                    int idx[4] = { sx - 3, sx, sx + 3, sx + 6 };
+                    s = v_lut_quads(S, idx);
+                }
+                v_uint16x8 s01, s23;
+                v_expand(s, s01, s23);
+                v_int32x4 a = v_reinterpret_as_s32(v_load(alpha + dx*4));
+                v_store(D + dx, v_add(v_dotprod(v_interleave_quads(v_reinterpret_as_s16(s01)), v_reinterpret_as_s16(v_broadcast_element<0>(a))),
+                                      v_dotprod(v_interleave_quads(v_reinterpret_as_s16(s23)), v_reinterpret_as_s16(v_broadcast_element<1>(a)))));
+            }
+        }
+    }
+    return dx;
+}
+
+// 8u, 8 taps
+static int hresizeLanczos4Vec_8u32s(const uchar** src, int** dst, int count, const int* xofs,
+                                    const short* alpha, int swidth, int cn, int xmin, int xmax)
+{
+    int dx = xmin;
+    for( int k = 0; k < count; k++ )
+    {
+        const uchar* S = src[k];
+        int* D = dst[k];
+        dx = xmin;
+        if( cn == 1 )
+        {
+            for( ; dx <= xmax - 8; dx += 8 )
+            {
+                v_uint16x8 s01_l, s01_h, s23_l, s23_h, s45_l, s45_h, s67_l, s67_h;
+                v_expand(v_lut_pairs(S - 3, xofs + dx), s01_l, s01_h);
+                v_expand(v_lut_pairs(S - 1, xofs + dx), s23_l, s23_h);
+                v_expand(v_lut_pairs(S + 1, xofs + dx), s45_l, s45_h);
+                v_expand(v_lut_pairs(S + 3, xofs + dx), s67_l, s67_h);
+                v_int32x4 a01, a23, a45, a67;
+                v_load_deinterleave((const int*)(alpha + dx*8), a01, a23, a45, a67);
+                v_store(D + dx, v_add(v_add(v_dotprod(v_reinterpret_as_s16(s01_l), v_reinterpret_as_s16(a01)),
+                                            v_dotprod(v_reinterpret_as_s16(s23_l), v_reinterpret_as_s16(a23))),
+                                      v_add(v_dotprod(v_reinterpret_as_s16(s45_l), v_reinterpret_as_s16(a45)),
+                                            v_dotprod(v_reinterpret_as_s16(s67_l), v_reinterpret_as_s16(a67)))));
+                v_load_deinterleave((const int*)(alpha + dx*8 + 32), a01, a23, a45, a67);
+                v_store(D + dx + 4, v_add(v_add(v_dotprod(v_reinterpret_as_s16(s01_h), v_reinterpret_as_s16(a01)),
+                                                v_dotprod(v_reinterpret_as_s16(s23_h), v_reinterpret_as_s16(a23))),
+                                          v_add(v_dotprod(v_reinterpret_as_s16(s45_h), v_reinterpret_as_s16(a45)),
+                                                v_dotprod(v_reinterpret_as_s16(s67_h), v_reinterpret_as_s16(a67)))));
+            }
+        }
+        else if( cn == 3 || cn == 4 )
+        {
+            for( ; dx < xmax - 3 && xofs[dx] + cn*4 + 4 <= swidth; dx += cn )
+            {
+                int sx = xofs[dx];
+                v_uint8x16 s0, s1;
+                if( cn == 4 )
+                {
+                    s0 = v_load(S + sx - 12);
+                    s1 = v_load(S + sx + 4);
+                }
+                else
+                {
+                    int idx[8] = { sx - 9, sx - 6, sx - 3, sx, sx + 3, sx + 6, sx + 9, sx + 12 };
+                    s0 = v_lut_quads(S, idx);
+                    s1 = v_lut_quads(S, idx + 4);
+                }
+                v_uint16x8 s01, s23, s45, s67;
+                v_expand(s0, s01, s23);
+                v_expand(s1, s45, s67);
+                v_int32x4 a = v_reinterpret_as_s32(v_load(alpha + dx*8));
+                v_store(D + dx, v_add(v_add(v_dotprod(v_interleave_quads(v_reinterpret_as_s16(s01)), v_reinterpret_as_s16(v_broadcast_element<0>(a))),
+                                            v_dotprod(v_interleave_quads(v_reinterpret_as_s16(s23)), v_reinterpret_as_s16(v_broadcast_element<1>(a)))),
+                                      v_add(v_dotprod(v_interleave_quads(v_reinterpret_as_s16(s45)), v_reinterpret_as_s16(v_broadcast_element<2>(a))),
+                                            v_dotprod(v_interleave_quads(v_reinterpret_as_s16(s67)), v_reinterpret_as_s16(v_broadcast_element<3>(a))))));
+            }
+        }
+    }
+    return dx;
+}
+
+// 16u/16s -> 32f; the taps are accumulated in the same order as in the scalar loop, so the result
+// is bit-identical to it as long as the multiply-adds are not fused (the kernels are not built for AVX2)
+template<typename T>
+static int hresizeCubicVec_16x32f(const T** src, float** dst, int count, const int* xofs,
+                                  const float* alpha, int swidth, int cn, int xmin, int xmax)
+{
+    int dx = xmin;
+    for( int k = 0; k < count; k++ )
+    {
+        const T* S = src[k];
+        float* D = dst[k];
+        dx = xmin;
+        if( cn == 1 )
+        {
+            for( ; dx <= xmax - 4; dx += 4 )
+            {
+                v_float32x4 s0 = hresize_load4_f32(S + xofs[dx] - 1), s1 = hresize_load4_f32(S + xofs[dx+1] - 1),
+                            s2 = hresize_load4_f32(S + xofs[dx+2] - 1), s3 = hresize_load4_f32(S + xofs[dx+3] - 1);
+                v_float32x4 t0, t1, t2, t3, a0, a1, a2, a3;
+                v_transpose4x4(s0, s1, s2, s3, t0, t1, t2, t3);
+                v_load_deinterleave(alpha + dx*4, a0, a1, a2, a3);
+                v_store(D + dx, v_add(v_add(v_add(v_mul(t0, a0), v_mul(t1, a1)), v_mul(t2, a2)), v_mul(t3, a3)));
+            }
+        }
+        else if( cn == 3 || cn == 4 )
+        {
+            for( ; dx < xmax - 3 && xofs[dx] + cn*2 + 4 <= swidth; dx += cn )
+            {
+                const T* Sx = S + xofs[dx];
+                const float* a = alpha + dx*4;
+                v_store(D + dx, v_add(v_add(v_add(v_mul(hresize_load4_f32(Sx - cn), v_setall_f32(a[0])),
+                                                  v_mul(hresize_load4_f32(Sx), v_setall_f32(a[1]))),
+                                            v_mul(hresize_load4_f32(Sx + cn), v_setall_f32(a[2]))),
+                                      v_mul(hresize_load4_f32(Sx + cn*2), v_setall_f32(a[3]))));
+            }
+        }
+    }
+    return dx;
+}
+
+template<typename T>
+static int hresizeLanczos4Vec_16x32f(const T** src, float** dst, int count, const int* xofs,
+                                     const float* alpha, int swidth, int cn, int xmin, int xmax)
+{
+    int dx = xmin;
+    for( int k = 0; k < count; k++ )
+    {
+        const T* S = src[k];
+        float* D = dst[k];
+        dx = xmin;
+        if( cn == 1 )
+        {
+            for( ; dx <= xmax - 4; dx += 4 )
+            {
+                const T *S0 = S + xofs[dx], *S1 = S + xofs[dx+1], *S2 = S + xofs[dx+2], *S3 = S + xofs[dx+3];
+                v_float32x4 t0, t1, t2, t3, t4, t5, t6, t7;
+                v_transpose4x4(hresize_load4_f32(S0 - 3), hresize_load4_f32(S1 - 3),
+                               hresize_load4_f32(S2 - 3), hresize_load4_f32(S3 - 3), t0, t1, t2, t3);
+                v_transpose4x4(hresize_load4_f32(S0 + 1), hresize_load4_f32(S1 + 1),
+                               hresize_load4_f32(S2 + 1), hresize_load4_f32(S3 + 1), t4, t5, t6, t7);
+                // alpha holds 8 taps per element; split them into 2 deinterleaved groups of 4
+                v_float32x4 a0, a1, a2, a3, a4, a5, a6, a7;
+                v_transpose4x4(v_load(alpha + dx*8), v_load(alpha + dx*8 + 8),
+                               v_load(alpha + dx*8 + 16), v_load(alpha + dx*8 + 24), a0, a1, a2, a3);
+                v_transpose4x4(v_load(alpha + dx*8 + 4), v_load(alpha + dx*8 + 12),
+                               v_load(alpha + dx*8 + 20), v_load(alpha + dx*8 + 28), a4, a5, a6, a7);
+                v_float32x4 v = v_add(v_add(v_add(v_mul(t0, a0), v_mul(t1, a1)), v_mul(t2, a2)), v_mul(t3, a3));
+                v_store(D + dx, v_add(v_add(v_add(v_add(v, v_mul(t4, a4)), v_mul(t5, a5)), v_mul(t6, a6)), v_mul(t7, a7)));
+            }
+        }
+        else if( cn == 3 || cn == 4 )
+        {
+            for( ; dx < xmax - 3 && xofs[dx] + cn*4 + 4 <= swidth; dx += cn )
+            {
+                const T* Sx = S + xofs[dx];
+                const float* a = alpha + dx*8;
+                v_float32x4 v = v_mul(hresize_load4_f32(Sx - cn*3), v_setall_f32(a[0]));
+                v = v_add(v, v_mul(hresize_load4_f32(Sx - cn*2), v_setall_f32(a[1])));
+                v = v_add(v, v_mul(hresize_load4_f32(Sx - cn), v_setall_f32(a[2])));
+                v = v_add(v, v_mul(hresize_load4_f32(Sx), v_setall_f32(a[3])));
+                v = v_add(v, v_mul(hresize_load4_f32(Sx + cn), v_setall_f32(a[4])));
+                v = v_add(v, v_mul(hresize_load4_f32(Sx + cn*2), v_setall_f32(a[5])));
+                v = v_add(v, v_mul(hresize_load4_f32(Sx + cn*3), v_setall_f32(a[6])));
+                v_store(D + dx, v_add(v, v_mul(hresize_load4_f32(Sx + cn*4), v_setall_f32(a[7]))));
+            }
+        }
+    }
+    return dx;
+}
+
+#else
+
+static int hresizeCubicVec_8u32s(const uchar**, int**, int, const int*, const short*, int, int, int xmin, int) { return xmin; }
+static int hresizeLanczos4Vec_8u32s(const uchar**, int**, int, const int*, const short*, int, int, int xmin, int) { return xmin; }
+template<typename T>
+static int hresizeCubicVec_16x32f(const T**, float**, int, const int*, const float*, int, int, int xmin, int) { return xmin; }
+template<typename T>
+static int hresizeLanczos4Vec_16x32f(const T**, float**, int, const int*, const float*, int, int, int xmin, int) { return xmin; }
+
+#endif
@@ -3194,6 +3194,96 @@ TEST(ImgProc_cvtColorTwoPlane, y_plane_padding_differs_from_uv_plane_padding_170
     EXPECT_DOUBLE_EQ(cvtest::norm(rgb_reference_mat, rgb_uv_padded_mat, NORM_INF), .0);
 }
 
+static Mat resizeYUV420Reference(const Mat& src, Size dsize, int code, int interpolation)
+{
+    // resize every plane separately and convert the resized frame
+    Size ysz(src.cols, src.rows * 2 / 3);
+    Mat yuv(dsize.height * 3 / 2, dsize.width, CV_8UC1), ydst = yuv.rowRange(0, dsize.height);
+    resize(src.rowRange(0, ysz.height), ydst, dsize, 0, 0, interpolation);
+    Size uvsz(ysz.width / 2, ysz.height / 2), duvsz(dsize.width / 2, dsize.height / 2);
+    bool twoPlane = code == COLOR_YUV2BGR_NV12 || code == COLOR_YUV2RGBA_NV21;
+    if (twoPlane)
+    {
+        Mat uvdst(duvsz, CV_8UC2, yuv.ptr(dsize.height));
+        resize(Mat(uvsz, CV_8UC2, (void*)src.ptr(ysz.height)), uvdst, duvsz, 0, 0, interpolation);
+    }
+    else
+    {
+        Mat plane = src.rowRange(ysz.height, src.rows).clone().reshape(1, 2 * uvsz.height);
+        Mat dplane(2 * duvsz.height, duvsz.width, CV_8UC1, yuv.ptr(dsize.height));
+        for (int i = 0; i < 2; i++)
+        {
+            Mat cdst = dplane.rowRange(i * duvsz.height, (i + 1) * duvsz.height);
+            resize(plane.rowRange(i * uvsz.height, (i + 1) * uvsz.height), cdst, duvsz, 0, 0, interpolation);
+        }
+    }
+    Mat dst;
+    cvtColor(yuv, dst, code);
+    return dst;
+}
+
+TEST(ImgProc_resizeYUV2BGR, accuracy)
+{
+    const int codes[] = { COLOR_YUV2BGR_NV12, COLOR_YUV2RGBA_NV21, COLOR_YUV2BGR_I420, COLOR_YUV2RGBA_YV12 };
+    const int interps[] = { INTER_NEAREST, INTER_LINEAR, INTER_CUBIC, INTER_AREA };
+    const Size dsizes[] = { Size(64, 36), Size(100, 50), Size(250, 150) };
+    RNG& rng = theRNG();
+
+    Mat src(180 * 3 / 2, 320, CV_8UC1);
+    rng.fill(src, RNG::UNIFORM, 16, 236);
+
+    for (int code : codes)
+        for (int interp : interps)
+            for (Size dsize : dsizes)
+            {
+                SCOPED_TRACE(cv::format("code=%d interpolation=%d dsize=%dx%d", code, interp, dsize.width, dsize.height));
+                Mat dst;
+                resizeYUV2BGR(src, dst, dsize, code, interp);
+                ASSERT_EQ(dst.size(), dsize);
+                EXPECT_EQ(0, cvtest::norm(dst, resizeYUV420Reference(src, dsize, code, interp), NORM_INF));
+            }
+}
+
+TEST(ImgProc_resizeYUV2BGR, gray)
+{
+    Mat src(120 * 3 / 2, 160, CV_8UC1), dst, ref;
+    theRNG().fill(src, RNG::UNIFORM, 0, 256);
+    resizeYUV2BGR(src, dst, Size(41, 29), COLOR_YUV2GRAY_420, INTER_AREA);
+    resize(src.rowRange(0, 120), ref, Size(41, 29), 0, 0, INTER_AREA);
+    EXPECT_EQ(0, cvtest::norm(dst, ref, NORM_INF));
+}
+
+TEST(ImgProc_resizeYUV2BGR, same_as_cvtColor_and_resize_on_flat_image)
+{
+    Mat src(240 * 3 / 2, 320, CV_8UC1);
+    src.rowRange(0, 240).setTo(120);
+    src.rowRange(240, src.rows).setTo(90);
+    for (int code : { COLOR_YUV2BGR_NV12, COLOR_YUV2BGR_I420 })
+    {
+        Mat dst, full, ref;
+        resizeYUV2BGR(src, dst, Size(64, 48), code, INTER_LINEAR);
+        cvtColor(src, full, code);
+        resize(full, ref, Size(64, 48), 0, 0, INTER_LINEAR);
+        EXPECT_EQ(0, cvtest::norm(dst, ref, NORM_INF)) << "code=" << code;
+    }
+}
+
+TEST(ImgProc_resizeYUV2BGR, padded_source)
+{
+    Mat src(90 * 3 / 2, 160, CV_8UC1);
+    theRNG().fill(src, RNG::UNIFORM, 16, 236);
+    Mat padded(src.rows, src.cols + 16, CV_8UC1, Scalar::all(255));
+    Mat roi = padded.colRange(0, src.cols);
+    src.copyTo(roi);
+    for (int code : { COLOR_YUV2BGR_NV21, COLOR_YUV2BGR_YV12 })
+    {
+        Mat dst, ref;
+        resizeYUV2BGR(roi, dst, Size(40, 30), code, INTER_LINEAR);
+        resizeYUV2BGR(src, ref, Size(40, 30), code, INTER_LINEAR);
+        EXPECT_EQ(0, cvtest::norm(dst, ref, NORM_INF)) << "code=" << code;
+    }
+}
+
 TEST(ImgProc_RGB2Lab, NaN_21111)
 {
     const float kNaN = std::numeric_limits<float>::quiet_NaN();
@@ -1504,6 +1504,248 @@ TEST(Resize, nearest_regression_15075)
     EXPECT_EQ(C, cvtest::norm(dst, NORM_L1)) << src.size;
 }
 
+TEST(Resize, plan_bitexact)
+{
+    static const int inter_types[] = { INTER_NEAREST, INTER_LINEAR, INTER_CUBIC, INTER_AREA,
+                                       INTER_LANCZOS4, INTER_LINEAR_EXACT, INTER_NEAREST_EXACT };
+    static const int types[] = { CV_8UC1, CV_8UC3, CV_8UC4, CV_16UC1, CV_16SC3, CV_32FC1, CV_32FC4, CV_64FC1 };
+    static const Size dst_sizes[] = { Size(224, 224), Size(320, 240), Size(1280, 960), Size(80, 60) };
+    const Size src_size(640, 480);
+
+    RNG& rng = theRNG();
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++)
+    {
+        Mat src(src_size, types[t]), src2(src_size, types[t]);
+        rng.fill(src, RNG::UNIFORM, 0, 255);
+        rng.fill(src2, RNG::UNIFORM, 0, 255);
+        for (size_t i = 0; i < sizeof(inter_types) / sizeof(inter_types[0]); i++)
+        {
+            for (size_t d = 0; d < sizeof(dst_sizes) / sizeof(dst_sizes[0]); d++)
+            {
+                SCOPED_TRACE(cv::format("type=%s interpolation=%d dsize=%dx%d", typeToString(types[t]).c_str(),
+                                        inter_types[i], dst_sizes[d].width, dst_sizes[d].height));
+                ResizePlan plan(src_size, types[t], dst_sizes[d], 0, 0, inter_types[i]);
+                ASSERT_FALSE(plan.empty());
+                EXPECT_EQ(dst_sizes[d], plan.dstSize());
+
+                Mat expected, expected2, actual;
+                cv::resize(src, expected, dst_sizes[d], 0, 0, inter_types[i]);
+                cv::resize(src2, expected2, dst_sizes[d], 0, 0, inter_types[i]);
+
+                plan.apply(src, actual);
+                EXPECT_EQ(0, cvtest::norm(expected, actual, NORM_INF));
+
+                // the plan is reused and the destination buffer is not reallocated
+                const uchar* data = actual.data;
+                plan.apply(src2, actual);
+                EXPECT_EQ(data, actual.data);
+                EXPECT_EQ(0, cvtest::norm(expected2, actual, NORM_INF));
+            }
+        }
+    }
+}
+
+TEST(Resize, plan_scale_factors)
+{
+    Mat src(97, 131, CV_8UC3), expected, actual;
+    randu(src, 0, 256);
+
+    ResizePlan plan(src.size(), src.type(), Size(), 0.37, 0.61, INTER_AREA);
+    cv::resize(src, expected, Size(), 0.37, 0.61, INTER_AREA);
+    plan.apply(src, actual);
+    EXPECT_EQ(expected.size(), plan.dstSize());
+    EXPECT_EQ(0, cvtest::norm(expected, actual, NORM_INF));
+
+    Mat wrong(src.rows + 1, src.cols, src.type());
+    EXPECT_THROW(plan.apply(wrong, actual), cv::Exception);
+    EXPECT_THROW(ResizePlan().apply(src, actual), cv::Exception);
+}
+
+// restores the IPP usage on leaving the scope, also when an assertion fails
+class UseIPPScope
+{
+public:
+    explicit UseIPPScope(bool use) : prevUseIPP(cv::ipp::useIPP()) { cv::ipp::setUseIPP(use); }
+    ~UseIPPScope() { cv::ipp::setUseIPP(prevUseIPP); }
+private:
+    bool prevUseIPP;
+};
+
+TEST(Resize, stream_bands)
+{
+    static const int inter_types[] = { INTER_NEAREST, INTER_LINEAR, INTER_CUBIC, INTER_AREA,
+                                       INTER_LANCZOS4, INTER_LINEAR_EXACT, INTER_NEAREST_EXACT, INTER_CUBIC_EXACT,
+                                       INTER_LINEAR | INTER_ANTIALIAS, INTER_CUBIC | INTER_ANTIALIAS,
+                                       INTER_LANCZOS4 | INTER_ANTIALIAS };
+    static const int types[] = { CV_8UC1, CV_8UC3, CV_16UC4, CV_16SC1, CV_32FC3, CV_64FC1 };
+    // explicit sizes and integer factors (the latter take the fast INTER_AREA path with incomplete last cells)
+    static const Size dst_sizes[] = { Size(30, 20), Size(35, 23), Size(61, 45), Size(150, 101), Size(97, 67) };
+    static const double factors[] = { 0.5, 1. / 3 };
+    const Size src_size(97, 67);
+    const int ncases = (int)(sizeof(dst_sizes) / sizeof(dst_sizes[0]) + sizeof(factors) / sizeof(factors[0]));
+
+    // the stream reproduces the built-in implementation only
+    UseIPPScope noIPP(false);
+
+    RNG& rng = theRNG();
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++)
+    {
+        Mat src(src_size, types[t]);
+        rng.fill(src, RNG::UNIFORM, 0, 255);
+        for (size_t i = 0; i < sizeof(inter_types) / sizeof(inter_types[0]); i++)
+        {
+            for (int d = 0; d < ncases; d++)
+            {
+                const int nsizes = (int)(sizeof(dst_sizes) / sizeof(dst_sizes[0]));
+                Size dsize = d < nsizes ? dst_sizes[d] : Size();
+                double f = d < nsizes ? 0 : factors[d - nsizes];
+                SCOPED_TRACE(cv::format("type=%s interpolation=%d dsize=%dx%d f=%g", typeToString(types[t]).c_str(),
+                                        inter_types[i], dsize.width, dsize.height, f));
+                Mat expected;
+                cv::resize(src, expected, dsize, f, f, inter_types[i]);
+
+                ResizeStream stream(src_size, types[t], dsize, f, f, inter_types[i]);
+                EXPECT_FALSE(stream.empty());
+                EXPECT_EQ(expected.size(), stream.dstSize());
+                for (int iter = 0; iter < 2; iter++)
+                {
+                    Mat actual(stream.dstSize(), types[t], Scalar::all(0)), rows;
+                    while (stream.consumedRows() < src_size.height)
+                    {
+                        int y = stream.consumedRows();
+                        int n = std::min(rng.uniform(1, 8), src_size.height - y);
+                        int dy = stream.producedRows();
+                        int produced = stream.push(src.rowRange(y, y + n), rows);
+                        EXPECT_EQ(produced, rows.rows);
+                        if (!rows.empty())
+                            rows.copyTo(actual.rowRange(dy, dy + rows.rows));
+                        EXPECT_EQ(dy + rows.rows, stream.producedRows());
+                    }
+                    EXPECT_TRUE(stream.finished());
+                    EXPECT_EQ(0, cvtest::norm(expected, actual, NORM_INF));
+                    stream.reset();
+                }
+            }
+        }
+    }
+
+    ResizeStream stream(src_size, CV_8UC1, Size(), 0.5, 0.5, INTER_LINEAR);
+    Mat rows;
+    EXPECT_THROW(stream.push(Mat(1, src_size.width, CV_8UC3), rows), cv::Exception);
+    EXPECT_THROW(stream.push(Mat(src_size.height + 1, src_size.width, CV_8UC1), rows), cv::Exception);
+}
+
+TEST(Resize, batch)
+{
+    static const int inter_types[] = { INTER_NEAREST, INTER_LINEAR, INTER_CUBIC, INTER_AREA,
+                                       INTER_LANCZOS4, INTER_LINEAR_EXACT, INTER_NEAREST_EXACT,
+                                       INTER_CUBIC | INTER_ANTIALIAS };
+    static const int types[] = { CV_8UC3, CV_8UC1, CV_32FC3 };
+    const Size dsize(56, 48);
+    const int nthreads = cv::getNumThreads();
+
+    RNG& rng = theRNG();
+    // a single thread processes whole images, several threads split small batches into row stripes
+    for (int threads = 1; threads <= 4; threads += 3)
+    {
+        cv::setNumThreads(threads);
+        for (size_t i = 0; i < sizeof(inter_types) / sizeof(inter_types[0]); i++)
+        {
+            for (int n = 1; n <= 40; n += 13)
+            {
+                SCOPED_TRACE(cv::format("threads=%d interpolation=%d n=%d", threads, inter_types[i], n));
+                // some of the images share the size, one matches dsize
+                std::vector<Mat> src(n);
+                for (int k = 0; k < n; k++)
+                {
+                    Size sz = k % 3 == 0 ? Size(112, 96) : Size(rng.uniform(20, 150), rng.uniform(20, 150));
+                    if (k == 4)
+                        sz = dsize;
+                    src[k].create(sz, types[k % 3]);
+                    rng.fill(src[k], RNG::UNIFORM, 0, 255);
+                }
+
+                std::vector<Mat> dst;
+                cv::resizeBatch(src, dst, dsize, inter_types[i]);
+                EXPECT_EQ((size_t)n, dst.size());
+                for (int k = 0; k < n && k < (int)dst.size(); k++)
+                {
+                    Mat expected;
+                    cv::resize(src[k], expected, dsize, 0, 0, inter_types[i]);
+                    EXPECT_EQ(expected.type(), dst[k].type());
+                    EXPECT_EQ(0, cvtest::norm(expected, dst[k], NORM_INF)) << "image " << k;
+                }
+            }
+        }
+    }
+    cv::setNumThreads(nthreads);
+}
+
+TEST(Resize, antialias)
+{
+    static const int inter_types[] = { INTER_LINEAR, INTER_CUBIC, INTER_LANCZOS4 };
+    static const int borders[] = { 1, 2, 4 };
+    static const Size dst_sizes[] = { Size(224, 224), Size(97, 31), Size(300, 210), Size(1000, 750) };
+    const Size src_size(640, 480);
+
+    RNG& rng = theRNG();
+    for (int cn = 1; cn <= 4; cn++)
+    {
+        Mat src8u(src_size, CV_8UC(cn)), src32f;
+        rng.fill(src8u, RNG::UNIFORM, 0, 256);
+        GaussianBlur(src8u, src8u, Size(5, 5), 1.5);
+        src8u.convertTo(src32f, CV_32F);
+        for (size_t i = 0; i < sizeof(inter_types) / sizeof(inter_types[0]); i++)
+        {
+            for (size_t d = 0; d < sizeof(dst_sizes) / sizeof(dst_sizes[0]); d++)
+            {
+                const Size dsize = dst_sizes[d];
+                const int interpolation = inter_types[i] | INTER_ANTIALIAS;
+                SCOPED_TRACE(cv::format("cn=%d interpolation=%d dsize=%dx%d", cn, inter_types[i], dsize.width, dsize.height));
+
+                // the fixed-point path follows the floating-point one
+                Mat dst8u, dst32f, dst32f_8u;
+                cv::resize(src8u, dst8u, dsize, 0, 0, interpolation);
+                cv::resize(src32f, dst32f, dsize, 0, 0, interpolation);
+                ASSERT_EQ(dsize, dst8u.size());
+                dst32f.convertTo(dst32f_8u, CV_8U);
+                EXPECT_LE(cvtest::norm(dst8u, dst32f_8u, NORM_INF), 1);
+
+                // without downscaling the kernels are the ones of the base method, except near the borders
+                if (dsize.width > src_size.width && dsize.height > src_size.height)
+                {
+                    Mat expected;
+                    cv::resize(src32f, expected, dsize, 0, 0, inter_types[i]);
+                    int b = cvCeil(borders[i]*(double)dsize.width/src_size.width) + 1;
+                    Rect inner(b, b, dsize.width - 2*b, dsize.height - 2*b);
+                    EXPECT_LE(cvtest::norm(expected(inner), dst32f(inner), NORM_INF), 1e-2);
+                }
+            }
+        }
+    }
+
+    // a flat image stays flat, also in the fixed point
+    Mat flat(src_size, CV_8UC3, Scalar(0, 77, 255)), dst;
+    cv::resize(flat, dst, Size(213, 161), 0, 0, INTER_LANCZOS4 | INTER_ANTIALIAS);
+    EXPECT_EQ(0, cvtest::norm(dst, Mat(dst.size(), dst.type(), Scalar(0, 77, 255)), NORM_INF));
+
+    // the finest pattern is averaged out instead of being aliased
+    Mat board(src_size, CV_8UC1);
+    for (int y = 0; y < board.rows; y++)
+        for (int x = 0; x < board.cols; x++)
+            board.at<uchar>(y, x) = (x + y) % 2 ? 255 : 0;
+    cv::resize(board, dst, Size(193, 151), 0, 0, INTER_LINEAR);
+    EXPECT_GT(cvtest::norm(dst, Mat(dst.size(), CV_8UC1, Scalar::all(128)), NORM_INF), 64);
+    for (size_t i = 0; i < sizeof(inter_types) / sizeof(inter_types[0]); i++)
+    {
+        cv::resize(board, dst, Size(193, 151), 0, 0, inter_types[i] | INTER_ANTIALIAS);
+        EXPECT_LE(cvtest::norm(dst, Mat(dst.size(), CV_8UC1, Scalar::all(128)), NORM_INF), 16) << inter_types[i];
+    }
+
+    EXPECT_THROW(cv::resize(flat, dst, Size(100, 100), 0, 0, INTER_AREA | INTER_ANTIALIAS), cv::Exception);
+    EXPECT_THROW(cv::resize(flat, dst, Size(100, 100), 0, 0, INTER_NEAREST | INTER_ANTIALIAS), cv::Exception);
+}
+
 TEST(Imgproc_Warp, multichannel)
 {
     static const int inter_types[] = {INTER_NEAREST, INTER_AREA, INTER_CUBIC,
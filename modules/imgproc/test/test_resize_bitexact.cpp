@@ -152,6 +152,259 @@ TEST(Resize_Bitexact, Linear8U)
         }
 }
 
+// source indices and fixed-point weights of the bit-exact bicubic interpolation: the Keys kernel with
+// A = -0.75 for the position rounded to 1/65536, the weights of the taps replicated by the border are
+// merged before rounding to 11 bits
+static int cubicTaps(softdouble scale, int d, int size, int* idx, int64_t* coeffs)
+{
+    static const int64_t fixedOne = 1 << 11;
+    softdouble f = scale*(softdouble(d) + softdouble(0.5)) - softdouble(0.5);
+    int fi = cvFloor(f);
+    int64_t t = cvRound((f - softdouble(fi))*softdouble(65536));
+    int64_t w[4];
+    for (int k = 0; k < 4; k++)
+    {
+        // 4*w(x) with 48 fractional bits, x is the distance to the tap
+        int64_t x = std::abs(t - 65536*(k - 1));
+        w[k] = x <= 65536 ? 5*x*x*x - 9*x*x*65536 + ((int64_t)4 << 48) :
+                     x <  131072 ? -3*x*x*x + 15*x*x*65536 - 24*x*65536*65536 + ((int64_t)12 << 48) : 0;
+    }
+
+    int n = 0;
+    int64_t mw[4];
+    for (int k = 0; k < 4; k++)
+    {
+        int i = std::min(std::max(fi - 1 + k, 0), size - 1);
+        if (n > 0 && idx[n - 1] == i)
+            mw[n - 1] += w[k];
+        else
+        {
+            idx[n] = i;
+            mw[n++] = w[k];
+        }
+    }
+    int64_t sum = 0;
+    int kmax = 0;
+    for (int k = 0; k < n; k++)
+    {
+        coeffs[k] = (mw[k] + ((int64_t)1 << 38)) >> 39;
+        sum += coeffs[k];
+        kmax = coeffs[k] > coeffs[kmax] ? k : kmax;
+    }
+    coeffs[kmax] += fixedOne - sum;
+    return n;
+}
+
+TEST(Resize_Bitexact, Cubic8U)
+{
+    struct testmode
+    {
+        int type;
+        Size ssz, dsz;
+    } modes[] = {
+        { CV_8UC1, Size(1024, 768), Size( 512, 384) }, //   1/2      1/2
+        { CV_8UC3, Size(1024, 768), Size( 512, 384) },
+        { CV_8UC4, Size(1024, 768), Size( 342, 256) }, //   1/3      1/3
+        { CV_8UC2, Size(1024, 768), Size( 931, 698) }, //  10/11    10/11
+        { CV_8UC1, Size(1024, 768), Size(1004, 753) }, // 251/256  251/256
+        { CV_8UC3, Size(1024, 768), Size(1004, 753) },
+        { CV_8UC1, Size(1024, 768), Size(1301, 977) }, //  ~1.27
+        { CV_8UC3, Size(1024, 768), Size(1301, 977) },
+        { CV_8UC4, Size(1024, 768), Size(1301, 977) },
+        { CV_8UC1, Size( 640, 480), Size(1280, 960) }, //    2        2
+        { CV_8UC3, Size( 640, 480), Size(1920, 1440) }, //   3        3
+        { CV_8UC(5), Size( 160, 120), Size( 333, 250) },
+        { CV_8UC1, Size(   3,   2), Size(  17,  11) }, // the source is smaller than the kernel
+        { CV_8UC3, Size(   1,   5), Size(   4,  13) }
+    };
+
+    for (int modeind = 0, _modecnt = sizeof(modes) / sizeof(modes[0]); modeind < _modecnt; ++modeind)
+    {
+        int type = modes[modeind].type, cn = CV_MAT_CN(type);
+        int cols = modes[modeind].ssz.width, rows = modes[modeind].ssz.height;
+        int dcols = modes[modeind].dsz.width, drows = modes[modeind].dsz.height;
+        softdouble scale_x = softdouble::one() / softdouble((double)dcols / cols);
+        softdouble scale_y = softdouble::one() / softdouble((double)drows / rows);
+
+        Mat src(rows, cols, type), refdst(drows, dcols, type), dst;
+        RNG rnd(0x123456789abcdefULL);
+        rnd.fill(src, RNG::UNIFORM, 0, 256);
+        // large flat regions and sharp edges make the kernel overshoot
+        src(Rect(0, 0, cols / 2, rows / 2)).setTo(255);
+        src(Rect(cols / 4, rows / 4, cols / 8, rows / 8)).setTo(0);
+
+        std::vector<int64_t> hrows((size_t)rows*dcols*cn);
+        for (int j = 0; j < rows; j++)
+            for (int i = 0; i < dcols; i++)
+            {
+                int idx[4]; int64_t coeffs[4];
+                int n = cubicTaps(scale_x, i, cols, idx, coeffs);
+                for (int c = 0; c < cn; c++)
+                {
+                    int64_t val = 0;
+                    for (int k = 0; k < n; k++)
+                        val += coeffs[k] * src.ptr<uint8_t>(j)[idx[k]*cn + c];
+                    hrows[((size_t)j*dcols + i)*cn + c] = val >> 5; // 6 fractional bits
+                }
+            }
+        for (int j = 0; j < drows; j++)
+        {
+            int idx[4]; int64_t coeffs[4];
+            int n = cubicTaps(scale_y, j, rows, idx, coeffs);
+            for (int i = 0; i < dcols*cn; i++)
+            {
+                int64_t val = 0;
+                for (int k = 0; k < n; k++)
+                    val += coeffs[k] * hrows[(size_t)idx[k]*dcols*cn + i];
+                refdst.ptr<uint8_t>(j)[i] = saturate_cast<uint8_t>((val + (1 << 16)) >> 17);
+            }
+        }
+
+        cv::resize(src, dst, Size(dcols, drows), 0, 0, cv::INTER_CUBIC_EXACT);
+        EXPECT_GE(0, cvtest::norm(refdst, dst, cv::NORM_L1))
+            << "Resize " << cn << "-chan mat from " << cols << "x" << rows << " to " << dcols << "x" << drows << " failed with max diff " << cvtest::norm(refdst, dst, cv::NORM_INF);
+        // the result is close to the floating-point bicubic interpolation
+        Mat dstCubic;
+        cv::resize(src, dstCubic, Size(dcols, drows), 0, 0, cv::INTER_CUBIC);
+        EXPECT_LE(cvtest::norm(dstCubic, dst, cv::NORM_INF), 1.)
+            << "Resize " << cn << "-chan mat from " << cols << "x" << rows << " to " << dcols << "x" << drows;
+    }
+
+    // the functions which mask the interpolation code see the plain bicubic interpolation
+    EXPECT_EQ((int)INTER_CUBIC, INTER_CUBIC_EXACT & INTER_MAX);
+}
+
+// fixed-point scale of the 8U coefficients of the generic resize
+static const int resizeCoefScale = 1 << 11;
+
+// the coefficients of the generic INTER_CUBIC and INTER_LANCZOS4 resize, see interpolateCubic() and interpolateLanczos4()
+static void genericResizeCoeffs(int interpolation, float x, float* coeffs)
+{
+    if (interpolation == INTER_CUBIC)
+    {
+        const float A = -0.75f;
+        coeffs[0] = ((A*(x + 1) - 5*A)*(x + 1) + 8*A)*(x + 1) - 4*A;
+        coeffs[1] = ((A + 2)*x - (A + 3))*x*x + 1;
+        coeffs[2] = ((A + 2)*(1 - x) - (A + 3))*(1 - x)*(1 - x) + 1;
+        coeffs[3] = 1.f - coeffs[0] - coeffs[1] - coeffs[2];
+        return;
+    }
+    static const double s45 = 0.70710678118654752440084436210485;
+    static const double cs[][2] = {{1, 0}, {-s45, -s45}, {0, 1}, {s45, -s45}, {-1, 0}, {s45, s45}, {0, -1}, {-s45, s45}};
+    float sum = 0;
+    double y0 = -(x + 3)*CV_PI*0.25, s0 = std::sin(y0), c0 = std::cos(y0);
+    for (int i = 0; i < 8; i++)
+    {
+        float y0_ = (x + 3 - i);
+        if (fabs(y0_) >= 1e-6f)
+        {
+            double y = -y0_*CV_PI*0.25;
+            coeffs[i] = (float)((cs[i][0]*s0 + cs[i][1]*c0)/(y*y));
+        }
+        else
+            coeffs[i] = 1e30f;
+        sum += coeffs[i];
+    }
+    sum = 1.f/sum;
+    for (int i = 0; i < 8; i++)
+        coeffs[i] *= sum;
+}
+
+// the horizontal pass of the generic resize in the scalar form: 8U sums the products with the coefficients
+// scaled to 2^11, 16U/16S accumulate the float products from the leftmost tap
+template <typename T>
+static void genericResizeHorizontal(const Mat& src, int dwidth, int interpolation, Mat& dst)
+{
+    const int cn = src.channels(), swidth = src.cols;
+    const int ksize = interpolation == INTER_CUBIC ? 4 : 8;
+    const bool fixpt = src.depth() == CV_8U;
+    const double scale_x = 1. / ((double)dwidth / swidth);
+    dst.create(src.rows, dwidth, CV_MAKETYPE(fixpt ? CV_32S : CV_32F, cn));
+    for (int dx = 0; dx < dwidth; dx++)
+    {
+        float fx = (float)((dx + 0.5)*scale_x - 0.5);
+        int sx = cvFloor(fx);
+        fx -= sx;
+        float coeffs[8];
+        genericResizeCoeffs(interpolation, fx, coeffs);
+        for (int y = 0; y < src.rows; y++)
+            for (int c = 0; c < cn; c++)
+            {
+                int isum = 0;
+                float fsum = 0;
+                for (int k = 0; k < ksize; k++)
+                {
+                    int x = std::min(std::max(sx - ksize/2 + 1 + k, 0), swidth - 1);
+                    T v = src.ptr<T>(y)[x*cn + c];
+                    if (fixpt)
+                        isum += v * saturate_cast<short>(coeffs[k]*resizeCoefScale);
+                    else
+                        fsum += v * coeffs[k];
+                }
+                if (fixpt)
+                    dst.ptr<int>(y)[dx*cn + c] = isum;
+                else
+                    dst.ptr<float>(y)[dx*cn + c] = fsum;
+            }
+    }
+}
+
+TEST(Resize_Bitexact, CubicLanczos4Horizontal)
+{
+    // odd widths, upscale and downscale, interior parts which end in the middle of a vector
+    static const Size widths[] = { Size(7, 19), Size(19, 7), Size(33, 64), Size(64, 33), Size(100, 257),
+                                   Size(257, 100), Size(61, 184), Size(128, 45), Size(1024, 1497) };
+    static const int depths[] = { CV_8U, CV_16U, CV_16S };
+    static const int inter_types[] = { INTER_CUBIC, INTER_LANCZOS4 };
+    const int rows = 3;
+
+    RNG rng(0x123456789abcdefULL);
+    for (size_t d = 0; d < sizeof(depths) / sizeof(depths[0]); d++)
+        for (int cn = 1; cn <= 4; cn++)
+            for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+            {
+                const int depth = depths[d], type = CV_MAKETYPE(depth, cn);
+                const int swidth = widths[w].width, dwidth = widths[w].height;
+                Mat src(rows, swidth, type);
+                rng.fill(src, RNG::UNIFORM, depth == CV_16S ? -32768 : 0, depth == CV_8U ? 256 : 65536);
+                for (size_t i = 0; i < sizeof(inter_types) / sizeof(inter_types[0]); i++)
+                {
+                    SCOPED_TRACE(cv::format("type=%s interpolation=%d width %d->%d", typeToString(type).c_str(),
+                                            inter_types[i], swidth, dwidth));
+                    // the height is kept, so the vertical pass only rounds the result of the horizontal one
+                    Mat dst, hrows;
+                    cv::resize(src, dst, Size(dwidth, rows), 0, 0, inter_types[i]);
+                    int mismatches = 0;
+                    if (depth == CV_8U)
+                    {
+                        genericResizeHorizontal<uint8_t>(src, dwidth, inter_types[i], hrows);
+                        for (int y = 0; y < rows; y++)
+                            for (int x = 0; x < dwidth*cn; x++)
+                            {
+                                // the vectorized vertical pass rounds the ties to even, the scalar one up
+                                int v = hrows.ptr<int>(y)[x];
+                                uint8_t r0 = saturate_cast<uint8_t>((v*resizeCoefScale + (1 << 21)) >> 22);
+                                uint8_t r1 = saturate_cast<uint8_t>(cvRound(v / (double)resizeCoefScale));
+                                uint8_t actual = dst.ptr<uint8_t>(y)[x];
+                                mismatches += actual != r0 && actual != r1;
+                            }
+                    }
+                    else
+                    {
+                        Mat expected, diff;
+                        if (depth == CV_16U)
+                            genericResizeHorizontal<uint16_t>(src, dwidth, inter_types[i], hrows);
+                        else
+                            genericResizeHorizontal<int16_t>(src, dwidth, inter_types[i], hrows);
+                        hrows.convertTo(expected, depth);
+                        cv::absdiff(expected, dst, diff);
+                        mismatches = countNonZero(diff.reshape(1));
+                    }
+                    EXPECT_EQ(0, mismatches);
+                }
+            }
+}
+
 PARAM_TEST_CASE(Resize_Bitexact, int)
 {
 public:
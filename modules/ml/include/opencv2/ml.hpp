@@ -1152,6 +1152,18 @@ public:
     /** @copybrief getPriors @see getPriors */
     CV_WRAP virtual void setPriors(const cv::Mat &val) = 0;
 
+    /** The maximum number of bins used to quantize each ordered variable.
+    If it is positive, the values of each ordered variable are quantized once before the training
+    into at most maxBins bins using the quantiles of the training samples, and the best split of
+    a node is searched among the bin boundaries using per-bin histograms instead of sorting the
+    node samples. It makes the training much faster on large datasets at the cost of slightly
+    coarser thresholds. Zero means that all the possible thresholds are tried. The value should be
+    0 or in the range [2, 256]. Default value is 0.*/
+    /** @see setMaxBins */
+    CV_WRAP virtual int getMaxBins() const = 0;
+    /** @copybrief getMaxBins @see getMaxBins */
+    CV_WRAP virtual void setMaxBins(int val) = 0;
+
     /** @brief The class represents a decision tree node.
      */
     class CV_EXPORTS Node
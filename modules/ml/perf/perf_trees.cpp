@@ -0,0 +1,66 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+#include "perf_precomp.hpp"
+
+namespace opencv_test { namespace {
+
+// two classes separated by a noisy nonlinear boundary
+static Ptr<TrainData> makeTrainData(int nsamples, int nvars)
+{
+    Mat samples(nsamples, nvars, CV_32F), responses(nsamples, 1, CV_32S);
+    RNG rng(20240805);
+    rng.fill(samples, RNG::UNIFORM, Scalar::all(-1), Scalar::all(1));
+    for (int i = 0; i < nsamples; i++)
+    {
+        const float* x = samples.ptr<float>(i);
+        const float v = x[0] * x[1] + 0.5f * x[2] - x[3] * x[3] + 0.2f * (float)rng.gaussian(1.);
+        responses.at<int>(i) = v > 0 ? 1 : 0;
+    }
+    return TrainData::create(samples, ROW_SAMPLE, responses);
+}
+
+typedef tuple<int, int> Trees_Samples_MaxBins_t;
+typedef TestBaseWithParam<Trees_Samples_MaxBins_t> Trees_Samples_MaxBins;
+
+PERF_TEST_P(Trees_Samples_MaxBins, RTrees_train,
+            testing::Combine(testing::Values(5000, 50000), testing::Values(0, 256)))
+{
+    const int nsamples = get<0>(GetParam()), maxBins = get<1>(GetParam());
+    Ptr<TrainData> data = makeTrainData(nsamples, 50);
+
+    Ptr<RTrees> model = RTrees::create();
+    model->setMaxDepth(10);
+    model->setMinSampleCount(10);
+    model->setMaxBins(maxBins);
+    model->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER, 20, 0));
+
+    TEST_CYCLE()
+    {
+        theRNG().state = 0x12345678;
+        model->train(data);
+    }
+
+    EXPECT_EQ(20, (int)model->getRoots().size());
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Trees_Samples_MaxBins, Boost_train,
+            testing::Combine(testing::Values(5000, 50000), testing::Values(0, 256)))
+{
+    const int nsamples = get<0>(GetParam()), maxBins = get<1>(GetParam());
+    Ptr<TrainData> data = makeTrainData(nsamples, 50);
+
+    Ptr<Boost> model = Boost::create();
+    model->setBoostType(Boost::REAL);
+    model->setWeakCount(20);
+    model->setMaxDepth(3);
+    model->setMaxBins(maxBins);
+
+    TEST_CYCLE() model->train(data);
+
+    EXPECT_EQ(20, (int)model->getRoots().size());
+    SANITY_CHECK_NOTHING();
+}
+
+}} // namespace
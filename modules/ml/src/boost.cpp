@@ -479,6 +479,8 @@ public:
     inline void setRegressionAccuracy(float val) CV_OVERRIDE { impl.params.setRegressionAccuracy(val); }
     inline cv::Mat getPriors() const CV_OVERRIDE { return impl.params.getPriors(); }
     inline void setPriors(const cv::Mat& val) CV_OVERRIDE { impl.params.setPriors(val); }
+    inline int getMaxBins() const CV_OVERRIDE { return impl.params.getMaxBins(); }
+    inline void setMaxBins(int val) CV_OVERRIDE { impl.params.setMaxBins(val); }
 
     String getDefaultName() const CV_OVERRIDE { return "opencv_ml_boost"; }
 
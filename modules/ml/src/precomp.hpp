@@ -165,12 +165,19 @@ namespace ml
                 CV_Error( cv::Error::StsOutOfRange, "params.regression_accuracy should be >= 0" );
             regressionAccuracy = val;
         }
+        inline void setMaxBins(int val)
+        {
+            if( val != 0 && (val < 2 || val > 256) )
+                CV_Error( cv::Error::StsOutOfRange, "max_bins should be 0 (no quantization) or in [2, 256]" );
+            maxBins = val;
+        }
 
         inline int getMaxCategories() const { return maxCategories; }
         inline int getMaxDepth() const { return maxDepth; }
         inline int getMinSampleCount() const { return minSampleCount; }
         inline int getCVFolds() const { return CVFolds; }
         inline float getRegressionAccuracy() const { return regressionAccuracy; }
+        inline int getMaxBins() const { return maxBins; }
 
         inline bool getUseSurrogates() const { return useSurrogates; }
         inline void setUseSurrogates(bool val) { useSurrogates = val; }
@@ -193,6 +200,7 @@ namespace ml
         int   minSampleCount;
         int   CVFolds;
         float regressionAccuracy;
+        int   maxBins;
     };
 
     struct RTreeParams
@@ -282,6 +290,13 @@ namespace ml
             vector<double> ord_responses;
             vector<int> sidx;
             int maxSubsetSize;
+
+            // quantized ordered variables (see TreeParams::maxBins):
+            // row binIdx[vi] of bins contains the bin indices of vi-th variable for all the samples,
+            // bin b of the row r contains the values in (binThresholds[r][b-1], binThresholds[r][b]]
+            vector<int> binIdx;
+            Mat bins;
+            vector<vector<float> > binThresholds;
         };
 
         inline int getMaxCategories() const CV_OVERRIDE { return params.getMaxCategories(); }
@@ -302,6 +317,8 @@ namespace ml
         inline void setRegressionAccuracy(float val) CV_OVERRIDE { params.setRegressionAccuracy(val); }
         inline cv::Mat getPriors() const CV_OVERRIDE { return params.getPriors(); }
         inline void setPriors(const cv::Mat& val) CV_OVERRIDE { params.setPriors(val); }
+        inline int getMaxBins() const CV_OVERRIDE { return params.getMaxBins(); }
+        inline void setMaxBins(int val) CV_OVERRIDE { params.setMaxBins(val); }
 
         DTreesImpl();
         virtual ~DTreesImpl() CV_OVERRIDE;
@@ -335,6 +352,11 @@ namespace ml
         virtual WSplit findSplitOrdReg( int vi, const vector<int>& _sidx, double initQuality );
         virtual WSplit findSplitCatReg( int vi, const vector<int>& _sidx, double initQuality, int* subset );
 
+        virtual void quantizeOrdVars();
+        virtual WSplit findSplitOrdClassHist( int vi, const vector<int>& _sidx, double initQuality );
+        virtual WSplit findSplitOrdRegHist( int vi, const vector<int>& _sidx, double initQuality );
+        virtual WSplit findSplit( int vi, const vector<int>& _sidx, double initQuality, int* subset );
+
         virtual int calcDir( int splitidx, const vector<int>& _sidx, vector<int>& _sleft, vector<int>& _sright );
         virtual int pruneCV( int root );
 
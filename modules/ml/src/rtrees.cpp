@@ -131,6 +131,103 @@ public:
         std::swap(activeVars, b);
     }
 
+    // creates a copy of the trained model with its own work data, which grows the trees independently
+    Ptr<DTreesImplForRTrees> createBuilder() const
+    {
+        Ptr<DTreesImplForRTrees> builder = makePtr<DTreesImplForRTrees>();
+        builder->params = params;
+        builder->rparams = rparams;
+        builder->varIdx = varIdx;
+        builder->compVarIdx = compVarIdx;
+        builder->varType = varType;
+        builder->catOfs = catOfs;
+        builder->catMap = catMap;
+        builder->classLabels = classLabels;
+        builder->missingSubst = missingSubst;
+        builder->_isClassifier = _isClassifier;
+        builder->allVars = allVars;
+        builder->activeVars = activeVars;
+        builder->w = makePtr<WorkData>(*w);
+        return builder;
+    }
+
+    // grows the tree on the bootstrap sample drawn with the given seed
+    int growTree( uint64 seed, vector<uchar>& oobmask )
+    {
+        CV_TRACE_FUNCTION();
+        RNG savedRng = theRNG();
+        RNG &rng = theRNG();
+        rng = RNG(seed);
+
+        int i, j, n = (int)w->sidx.size();
+        vector<int> sidx(n);
+        oobmask.assign(n, (uchar)1);
+        for( i = 0; i < n; i++ )
+        {
+            j = rng.uniform(0, n);
+            sidx[i] = w->sidx[j];
+            oobmask[j] = (uchar)0;
+        }
+
+        // the same active variables are drawn for the tree regardless of the trees grown before
+        std::copy(varIdx.begin(), varIdx.end(), allVars.begin());
+        roots.clear();
+        nodes.clear();
+        splits.clear();
+        subsets.clear();
+        int root = addTree( sidx );
+
+        theRNG() = savedRng;
+        return root;
+    }
+
+    // appends the tree grown by the builder to the forest
+    void addBuilderTree( const DTreesImplForRTrees& builder )
+    {
+        int i, nodeOfs = (int)nodes.size(), splitOfs = (int)splits.size(), subsetOfs = (int)subsets.size();
+        int nnodes = (int)builder.nodes.size(), nsplits = (int)builder.splits.size();
+
+        for( i = 0; i < nnodes; i++ )
+        {
+            Node node = builder.nodes[i];
+            node.parent += node.parent >= 0 ? nodeOfs : 0;
+            node.left += node.left >= 0 ? nodeOfs : 0;
+            node.right += node.right >= 0 ? nodeOfs : 0;
+            node.split += node.split >= 0 ? splitOfs : 0;
+            nodes.push_back(node);
+        }
+        for( i = 0; i < nsplits; i++ )
+        {
+            Split split = builder.splits[i];
+            split.next += split.next >= 0 ? splitOfs : 0;
+            split.subsetOfs += split.subsetOfs >= 0 ? subsetOfs : 0;
+            splits.push_back(split);
+        }
+        subsets.insert(subsets.end(), builder.subsets.begin(), builder.subsets.end());
+        roots.push_back(builder.roots.back() + nodeOfs);
+    }
+
+    class GrowTreeInvoker CV_FINAL : public ParallelLoopBody
+    {
+    public:
+        GrowTreeInvoker( vector<Ptr<DTreesImplForRTrees> >& _builders, const vector<uint64>& _seeds,
+                         vector<vector<uchar> >& _oobmasks, vector<int>& _roots )
+            : builders(&_builders), seeds(&_seeds), oobmasks(&_oobmasks), roots(&_roots)
+        {
+        }
+
+        void operator()( const Range& range ) const CV_OVERRIDE
+        {
+            for( int k = range.start; k < range.end; k++ )
+                (*roots)[k] = (*builders)[k]->growTree((*seeds)[k], (*oobmasks)[k]);
+        }
+
+        vector<Ptr<DTreesImplForRTrees> >* builders;
+        const vector<uint64>* seeds;
+        vector<vector<uchar> >* oobmasks;
+        vector<int>* roots;
+    };
+
     bool train( const Ptr<TrainData>& trainData, int flags ) CV_OVERRIDE
     {
         CV_TRACE_FUNCTION();
@@ -143,8 +240,11 @@ public:
         int nclasses = (int)classLabels.size();
         double eps = (rparams.termCrit.type & TermCriteria::EPS) != 0 &&
             rparams.termCrit.epsilon > 0 ? rparams.termCrit.epsilon : 0.;
-        vector<int> sidx(n);
-        vector<uchar> oobmask(n);
+        int b, nbuilders = std::max(std::min(getNumThreads(), ntrees), 1);
+        vector<Ptr<DTreesImplForRTrees> > builders(nbuilders);
+        vector<uint64> seeds(nbuilders);
+        vector<vector<uchar> > oobmasks(nbuilders);
+        vector<int> broots(nbuilders);
         vector<int> oobidx;
         vector<int> oobperm;
         vector<double> oobres(n, 0.);
@@ -179,20 +279,28 @@ public:
         if( rparams.calcVarImportance )
             varImportance.resize(nallvars, 0.f);
 
+        // The trees are grown in batches, each tree of a batch by its own builder in parallel.
+        // Every tree is grown with its own seed drawn in the order of trees, and the trees are
+        // added to the forest in the same order, so the result does not depend on the number of threads.
+        for( b = 0; b < nbuilders; b++ )
+            builders[b] = createBuilder();
+        RNG seedRng(rng.next());
+
         for( treeidx = 0; treeidx < ntrees; treeidx++ )
         {
-            for( i = 0; i < n; i++ )
-                oobmask[i] = (uchar)1;
-
-            for( i = 0; i < n; i++ )
+            b = treeidx % nbuilders;
+            if( b == 0 )
             {
-                j = rng.uniform(0, n);
-                sidx[i] = w->sidx[j];
-                oobmask[j] = (uchar)0;
+                int nbatch = std::min(nbuilders, ntrees - treeidx);
+                for( k = 0; k < nbatch; k++ )
+                    seeds[k] = seedRng.next();
+                parallel_for_(Range(0, nbatch), GrowTreeInvoker(builders, seeds, oobmasks, broots));
             }
-            int root = addTree( sidx );
-            if( root < 0 )
+
+            if( broots[b] < 0 )
                 return false;
+            addBuilderTree(*builders[b]);
+            const vector<uchar>& oobmask = oobmasks[b];
 
             if( calcOOBError )
             {
@@ -461,6 +569,8 @@ public:
     inline void setRegressionAccuracy(float val) CV_OVERRIDE { impl.params.setRegressionAccuracy(val); }
     inline cv::Mat getPriors() const CV_OVERRIDE { return impl.params.getPriors(); }
     inline void setPriors(const cv::Mat& val) CV_OVERRIDE { impl.params.setPriors(val); }
+    inline int getMaxBins() const CV_OVERRIDE { return impl.params.getMaxBins(); }
+    inline void setMaxBins(int val) CV_OVERRIDE { impl.params.setMaxBins(val); }
     inline void getVotes(InputArray input, OutputArray output, int flags) const CV_OVERRIDE {return impl.getVotes(input,output,flags);}
 
     RTreesImpl() {}
@@ -61,6 +61,7 @@ TreeParams::TreeParams()
     use1SERule = true;
     truncatePrunedTree = true;
     priors = Mat();
+    maxBins = 0;
 }
 
 TreeParams::TreeParams(int _maxDepth, int _minSampleCount,
@@ -78,6 +79,7 @@ TreeParams::TreeParams(int _maxDepth, int _minSampleCount,
     use1SERule = _use1SERule;
     truncatePrunedTree = _truncatePrunedTree;
     priors = _priors;
+    maxBins = 0;
 }
 
 DTrees::Node::Node()
@@ -203,6 +205,9 @@ void DTreesImpl::startTraining( const Ptr<TrainData>& data, int )
     }
     else
         data->getResponses().copyTo(w->ord_responses);
+
+    if( params.getMaxBins() > 0 )
+        quantizeOrdVars();
 }
 
 
@@ -416,37 +421,76 @@ int DTreesImpl::addNodeAndTrySplit( int parent, const vector<int>& sidx )
     return nidx;
 }
 
+// the split candidates of a node are evaluated concurrently only if there is enough work
+static const int64 PARALLEL_SPLIT_MIN_WORK = 1 << 15;
+
+class FindSplitInvoker CV_FINAL : public ParallelLoopBody
+{
+public:
+    FindSplitInvoker( DTreesImpl* _tree, const vector<int>& _vars, const vector<int>& _sidx,
+                      DTreesImpl::WSplit* _splits, int* _subsets, int _subsetStep )
+        : tree(_tree), vars(&_vars), sidx(&_sidx), splits(_splits), subsets(_subsets), subsetStep(_subsetStep)
+    {
+    }
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        for( int i = range.start; i < range.end; i++ )
+            splits[i] = tree->findSplit((*vars)[i], *sidx, 0, subsets + i*subsetStep);
+    }
+
+    DTreesImpl* tree;
+    const vector<int>* vars;
+    const vector<int>* sidx;
+    DTreesImpl::WSplit* splits;
+    int* subsets;
+    int subsetStep;
+};
+
+DTreesImpl::WSplit DTreesImpl::findSplit( int vi, const vector<int>& _sidx, double initQuality, int* subset )
+{
+    if( varType[vi] == VAR_CATEGORICAL )
+    {
+        if( _isClassifier )
+            return findSplitCatClass(vi, _sidx, initQuality, subset);
+        return findSplitCatReg(vi, _sidx, initQuality, subset);
+    }
+    if( !w->binIdx.empty() && w->binIdx[vi] >= 0 )
+    {
+        if( _isClassifier )
+            return findSplitOrdClassHist(vi, _sidx, initQuality);
+        return findSplitOrdRegHist(vi, _sidx, initQuality);
+    }
+    if( _isClassifier )
+        return findSplitOrdClass(vi, _sidx, initQuality);
+    return findSplitOrdReg(vi, _sidx, initQuality);
+}
+
 int DTreesImpl::findBestSplit( const vector<int>& _sidx )
 {
     const vector<int>& activeVars = getActiveVars();
     int splitidx = -1;
-    int vi_, nv = (int)activeVars.size();
-    AutoBuffer<int> buf(w->maxSubsetSize*2);
-    int *subset = buf.data(), *best_subset = subset + w->maxSubsetSize;
-    WSplit split, best_split;
+    int vi_, nv = (int)activeVars.size(), n = (int)_sidx.size();
+    int subsetStep = w->maxSubsetSize;
+    vector<WSplit> splitbuf(nv);
+    AutoBuffer<int> subsetbuf(nv*subsetStep);
+    WSplit best_split;
+    int best_vi_ = -1;
     best_split.quality = 0.;
 
+    FindSplitInvoker invoker(this, activeVars, _sidx, &splitbuf[0], subsetbuf.data(), subsetStep);
+    if( nv > 1 && (int64)n*nv >= PARALLEL_SPLIT_MIN_WORK )
+        parallel_for_(Range(0, nv), invoker);
+    else
+        invoker(Range(0, nv));
+
+    // choose the best split in the order of variables, so the result does not depend on the number of threads
     for( vi_ = 0; vi_ < nv; vi_++ )
     {
-        int vi = activeVars[vi_];
-        if( varType[vi] == VAR_CATEGORICAL )
+        if( splitbuf[vi_].quality > best_split.quality )
         {
-            if( _isClassifier )
-                split = findSplitCatClass(vi, _sidx, 0, subset);
-            else
-                split = findSplitCatReg(vi, _sidx, 0, subset);
-        }
-        else
-        {
-            if( _isClassifier )
-                split = findSplitOrdClass(vi, _sidx, 0);
-            else
-                split = findSplitOrdReg(vi, _sidx, 0);
-        }
-        if( split.quality > best_split.quality )
-        {
-            best_split = split;
-            std::swap(subset, best_subset);
+            best_split = splitbuf[vi_];
+            best_vi_ = vi_;
         }
     }
 
@@ -454,6 +498,7 @@ int DTreesImpl::findBestSplit( const vector<int>& _sidx )
     {
         int best_vi = best_split.varIdx;
         CV_Assert( compVarIdx[best_split.varIdx] >= 0 && best_vi >= 0 );
+        const int* best_subset = subsetbuf.data() + best_vi_*subsetStep;
         int i, prevsz = (int)w->wsubsets.size(), ssize = getSubsetSize(best_vi);
         w->wsubsets.resize(prevsz + ssize);
         for( i = 0; i < ssize; i++ )
@@ -1135,6 +1180,263 @@ DTreesImpl::WSplit DTreesImpl::findSplitCatReg( int vi, const vector<int>& _sidx
     return split;
 }
 
+class QuantizeInvoker CV_FINAL : public ParallelLoopBody
+{
+public:
+    QuantizeInvoker( DTreesImpl::WorkData* _w, const vector<int>& _vars, int _maxBins )
+        : w(_w), vars(&_vars), maxBins(_maxBins)
+    {
+    }
+
+    static float threshold( float a, float b )
+    {
+        float c = (a + b)*0.5f;
+        return c > a && c < b ? c : a;
+    }
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        int i, n = (int)w->sidx.size();
+        const int* sidx = &w->sidx[0];
+        AutoBuffer<float> buf(n*2);
+        float* values = buf.data();
+        float* sorted = values + n;
+
+        for( int vi_ = range.start; vi_ < range.end; vi_++ )
+        {
+            int vi = (*vars)[vi_], row = w->binIdx[vi];
+            vector<float>& thresholds = w->binThresholds[row];
+            uchar* bins = w->bins.ptr(row);
+
+            w->data->getValues(vi, w->sidx, values);
+            std::copy(values, values + n, sorted);
+            std::sort(sorted, sorted + n);
+
+            int ndistinct = n > 0 ? 1 : 0;
+            for( i = 1; i < n; i++ )
+                ndistinct += sorted[i] > sorted[i-1];
+
+            thresholds.clear();
+            if( ndistinct <= maxBins )
+            {
+                for( i = 1; i < n; i++ )
+                    if( sorted[i] > sorted[i-1] )
+                        thresholds.push_back(threshold(sorted[i-1], sorted[i]));
+            }
+            else
+            {
+                // the bin boundaries are placed at the quantiles of the variable,
+                // a boundary inside a run of equal values is moved to the end of the run
+                for( int k = 1; k < maxBins; k++ )
+                {
+                    int p = (int)((int64)n*k/maxBins);
+                    if( p == 0 )
+                        continue;
+                    float a = sorted[p-1];
+                    p = (int)(std::upper_bound(sorted + p, sorted + n, a) - sorted);
+                    if( p >= n )
+                        break;
+                    float c = threshold(a, sorted[p]);
+                    if( thresholds.empty() || c > thresholds.back() )
+                        thresholds.push_back(c);
+                }
+            }
+
+            for( i = 0; i < n; i++ )
+                bins[sidx[i]] = (uchar)(std::lower_bound(thresholds.begin(), thresholds.end(), values[i]) - thresholds.begin());
+        }
+    }
+
+    DTreesImpl::WorkData* w;
+    const vector<int>* vars;
+    int maxBins;
+};
+
+void DTreesImpl::quantizeOrdVars()
+{
+    CV_TRACE_FUNCTION();
+    int i, nvars = (int)varIdx.size(), nrows = 0;
+    vector<int> ordVars;
+
+    w->binIdx.assign(varType.size(), -1);
+    for( i = 0; i < nvars; i++ )
+    {
+        int vi = varIdx[i];
+        if( varType[vi] == VAR_ORDERED )
+        {
+            w->binIdx[vi] = nrows++;
+            ordVars.push_back(vi);
+        }
+    }
+
+    // one row of bin indices per variable, so the histograms of a node are built from contiguous memory
+    w->bins = Mat::zeros(nrows, w->data->getNSamples(), CV_8U);
+    w->binThresholds.resize(nrows);
+    parallel_for_(Range(0, nrows), QuantizeInvoker(w.get(), ordVars, params.getMaxBins()));
+}
+
+DTreesImpl::WSplit DTreesImpl::findSplitOrdClassHist( int vi, const vector<int>& _sidx, double initQuality )
+{
+    int row = w->binIdx[vi];
+    const vector<float>& thresholds = w->binThresholds[row];
+    int n = (int)_sidx.size();
+    int m = (int)classLabels.size();
+    int nbins = (int)thresholds.size() + 1;
+
+    AutoBuffer<double> buf(m*(nbins + 2));
+    AutoBuffer<int> countbuf(nbins);
+    const int* sidx = &_sidx[0];
+    const int* responses = &w->cat_responses[0];
+    const double* weights = &w->sample_weights[0];
+    const uchar* bins = w->bins.ptr(row);
+    double* lcw = buf.data();
+    double* rcw = lcw + m;
+    double* hist = rcw + m;
+    int* counts = countbuf.data();
+    int i, b, k, best_b = -1, nleft = 0;
+    double best_val = initQuality;
+
+    for( i = 0; i < m*(nbins + 2); i++ )
+        lcw[i] = 0.;
+    for( b = 0; b < nbins; b++ )
+        counts[b] = 0;
+
+    // hist_{bk} - weight of the samples that fall into b-th bin and have response = k
+    for( i = 0; i < n; i++ )
+    {
+        int si = sidx[i];
+        b = bins[si];
+        hist[b*m + responses[si]] += weights[si];
+        counts[b]++;
+    }
+
+    for( b = 0; b < nbins; b++ )
+        for( k = 0; k < m; k++ )
+            rcw[k] += hist[b*m + k];
+
+    double L = 0, R = 0, lsum2 = 0, rsum2 = 0;
+    for( k = 0; k < m; k++ )
+    {
+        double wval = rcw[k];
+        R += wval;
+        rsum2 += wval*wval;
+    }
+
+    for( b = 0; b < nbins - 1; b++ )
+    {
+        if( counts[b] == 0 )
+            continue;
+        nleft += counts[b];
+        if( nleft == n )
+            break;
+
+        const double* h = hist + b*m;
+        for( k = 0; k < m; k++ )
+        {
+            double wval = h[k], lv = lcw[k], rv = rcw[k];
+            L += wval; R -= wval;
+            lsum2 += 2*lv*wval + wval*wval;
+            rsum2 -= 2*rv*wval - wval*wval;
+            lcw[k] = lv + wval; rcw[k] = rv - wval;
+        }
+
+        if( L > FLT_EPSILON && R > FLT_EPSILON )
+        {
+            double val = (lsum2*R + rsum2*L)/(L*R);
+            if( best_val < val )
+            {
+                best_val = val;
+                best_b = b;
+            }
+        }
+    }
+
+    WSplit split;
+    if( best_b >= 0 )
+    {
+        split.varIdx = vi;
+        split.c = thresholds[best_b];
+        split.inversed = false;
+        split.quality = (float)best_val;
+    }
+    return split;
+}
+
+DTreesImpl::WSplit DTreesImpl::findSplitOrdRegHist( int vi, const vector<int>& _sidx, double initQuality )
+{
+    int row = w->binIdx[vi];
+    const vector<float>& thresholds = w->binThresholds[row];
+    int n = (int)_sidx.size();
+    int nbins = (int)thresholds.size() + 1;
+
+    AutoBuffer<double> buf(nbins*2);
+    AutoBuffer<int> countbuf(nbins);
+    const int* sidx = &_sidx[0];
+    const double* responses = &w->ord_responses[0];
+    const double* weights = &w->sample_weights[0];
+    const uchar* bins = w->bins.ptr(row);
+    double* wsum = buf.data();
+    double* sum = wsum + nbins;
+    int* counts = countbuf.data();
+    int i, b, best_b = -1, nleft = 0;
+    double L = 0, R = 0, best_val = initQuality, lsum = 0, rsum = 0;
+
+    for( b = 0; b < nbins; b++ )
+    {
+        wsum[b] = sum[b] = 0.;
+        counts[b] = 0;
+    }
+
+    // calculate sum response and weight of the samples in each bin
+    for( i = 0; i < n; i++ )
+    {
+        int si = sidx[i];
+        double wval = weights[si];
+        b = bins[si];
+        wsum[b] += wval;
+        sum[b] += responses[si]*wval;
+        counts[b]++;
+    }
+
+    for( b = 0; b < nbins; b++ )
+    {
+        R += wsum[b];
+        rsum += sum[b];
+    }
+
+    for( b = 0; b < nbins - 1; b++ )
+    {
+        if( counts[b] == 0 )
+            continue;
+        nleft += counts[b];
+        if( nleft == n )
+            break;
+
+        L += wsum[b]; R -= wsum[b];
+        lsum += sum[b]; rsum -= sum[b];
+
+        if( L > FLT_EPSILON && R > FLT_EPSILON )
+        {
+            double val = (lsum*lsum*R + rsum*rsum*L)/(L*R);
+            if( best_val < val )
+            {
+                best_val = val;
+                best_b = b;
+            }
+        }
+    }
+
+    WSplit split;
+    if( best_b >= 0 )
+    {
+        split.varIdx = vi;
+        split.c = thresholds[best_b];
+        split.inversed = false;
+        split.quality = (float)best_val;
+    }
+    return split;
+}
+
 int DTreesImpl::calcDir( int splitidx, const vector<int>& _sidx,
                          vector<int>& _sleft, vector<int>& _sright )
 {
@@ -1551,6 +1853,9 @@ void DTreesImpl::writeTrainingParams(FileStorage& fs) const
 
     if( !params.priors.empty() )
         fs << "priors" << params.priors;
+
+    if( params.getMaxBins() > 0 )
+        fs << "max_bins" << params.getMaxBins();
 }
 
 void DTreesImpl::writeParams(FileStorage& fs) const
@@ -1723,6 +2028,7 @@ void DTreesImpl::readParams( const FileNode& fn )
         }
 
         tparams_node["priors"] >> params0.priors;
+        params0.setMaxBins((int)tparams_node["max_bins"]);
     }
 
     readVectorOrMat(fn["var_idx"], varIdx);
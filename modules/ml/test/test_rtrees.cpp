@@ -83,11 +83,14 @@ TEST(ML_RTrees, 11142_sample_weights_classification)
     Mat labels = (Mat_<int>(n,1) << 0,0,0,0, 1,1,1,1, 2,2,2,2);
     Mat weights = (Mat_<float>(n, 1) << 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10);
 
+    // the same random state gives the same forest, only the weights are different
+    RNG rng = theRNG();
     rt->train(data, ml::ROW_SAMPLE, labels);
-    rt->clear();
     double error_without_weights = round(rt->getOOBError());
+    rt->clear();
     Ptr<TrainData> trainDataWithWeights = TrainData::create(data, ml::ROW_SAMPLE, labels, Mat(), Mat(), weights );
-    rt->train(data, ml::ROW_SAMPLE, labels);
+    theRNG() = rng;
+    rt->train(trainDataWithWeights);
     double error_with_weights = round(rt->getOOBError());
     std::cout << error_without_weights << std::endl;
     std::cout << error_with_weights << std::endl;
@@ -115,5 +118,180 @@ TEST(ML_RTrees, bug_12974_throw_exception_when_predict_different_feature_count)
     ASSERT_THROW(model->predict(test), Exception);
 }
 
+static void makeTreesTrainData(int n, bool classification, Mat& samples, Mat& responses)
+{
+    samples.create(n, 8, CV_32F);
+    randu(samples, 0, 10);
+    responses.create(n, 1, classification ? CV_32S : CV_32F);
+    for (int i = 0; i < n; i++)
+    {
+        const float* x = samples.ptr<float>(i);
+        float y = x[0] + 2*x[1] - x[2]*x[3]/10 + (float)theRNG().uniform(-1., 1.);
+        if (classification)
+            responses.at<int>(i) = y < 5 ? 0 : y < 10 ? 1 : 2;
+        else
+            responses.at<float>(i) = y;
+    }
+}
+
+static void checkSameTrees(const Ptr<DTrees>& a, const Ptr<DTrees>& b)
+{
+    ASSERT_EQ(a->getRoots(), b->getRoots());
+    ASSERT_EQ(a->getSubsets(), b->getSubsets());
+    const std::vector<DTrees::Node>& anodes = a->getNodes();
+    const std::vector<DTrees::Node>& bnodes = b->getNodes();
+    ASSERT_EQ(anodes.size(), bnodes.size());
+    for (size_t i = 0; i < anodes.size(); i++)
+    {
+        EXPECT_EQ(anodes[i].value, bnodes[i].value) << i;
+        EXPECT_EQ(anodes[i].left, bnodes[i].left) << i;
+        EXPECT_EQ(anodes[i].right, bnodes[i].right) << i;
+        EXPECT_EQ(anodes[i].split, bnodes[i].split) << i;
+    }
+    const std::vector<DTrees::Split>& asplits = a->getSplits();
+    const std::vector<DTrees::Split>& bsplits = b->getSplits();
+    ASSERT_EQ(asplits.size(), bsplits.size());
+    for (size_t i = 0; i < asplits.size(); i++)
+    {
+        EXPECT_EQ(asplits[i].varIdx, bsplits[i].varIdx) << i;
+        EXPECT_EQ(asplits[i].c, bsplits[i].c) << i;
+        EXPECT_EQ(asplits[i].quality, bsplits[i].quality) << i;
+    }
+}
+
+typedef testing::TestWithParam<int> ML_RTrees_Threads;
+
+TEST_P(ML_RTrees_Threads, parallel_determinism)
+{
+    const int maxBins = GetParam();
+    const int nthreads = cv::getNumThreads();
+    Mat samples, responses;
+    makeTreesTrainData(3000, true, samples, responses);
+    Ptr<TrainData> data = TrainData::create(samples, ml::ROW_SAMPLE, responses);
+
+    Ptr<RTrees> rt[2];
+    for (int k = 0; k < 2; k++)
+    {
+        rt[k] = RTrees::create();
+        rt[k]->setMaxDepth(10);
+        rt[k]->setMaxBins(maxBins);
+        rt[k]->setCalculateVarImportance(true);
+        rt[k]->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER, 13, 0));
+        cv::setNumThreads(k == 0 ? 1 : 4);
+        theRNG() = RNG(12345);
+        rt[k]->train(data);
+    }
+    cv::setNumThreads(nthreads);
+
+    ASSERT_EQ(13u, rt[0]->getRoots().size());
+    checkSameTrees(rt[0], rt[1]);
+    EXPECT_EQ(rt[0]->getOOBError(), rt[1]->getOOBError());
+    EXPECT_EQ(0, cvtest::norm(rt[0]->getVarImportance(), rt[1]->getVarImportance(), NORM_INF));
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, ML_RTrees_Threads, testing::Values(0, 32));
+
+TEST(ML_DTrees, parallel_split_search)
+{
+    const int nthreads = cv::getNumThreads();
+    Mat samples, responses;
+    makeTreesTrainData(20000, false, samples, responses);
+    Ptr<TrainData> data = TrainData::create(samples, ml::ROW_SAMPLE, responses);
+
+    Ptr<DTrees> dt[2];
+    for (int k = 0; k < 2; k++)
+    {
+        dt[k] = DTrees::create();
+        dt[k]->setMaxDepth(8);
+        dt[k]->setCVFolds(0);
+        cv::setNumThreads(k == 0 ? 1 : 4);
+        dt[k]->train(data);
+    }
+    cv::setNumThreads(nthreads);
+
+    checkSameTrees(dt[0], dt[1]);
+}
+
+typedef testing::TestWithParam<bool> ML_Trees_MaxBins;
+
+TEST_P(ML_Trees_MaxBins, accuracy)
+{
+    const bool classification = GetParam();
+    Mat samples, responses;
+    makeTreesTrainData(6000, classification, samples, responses);
+    Ptr<TrainData> data = TrainData::create(samples, ml::ROW_SAMPLE, responses);
+    data->setTrainTestSplitRatio(0.5, false);
+
+    Ptr<StatModel> models[3];
+    double errors[3][2];
+    for (int bins = 0; bins < 2; bins++)
+    {
+        Ptr<DTrees> dt = DTrees::create();
+        dt->setMaxDepth(8);
+        dt->setCVFolds(0);
+        Ptr<RTrees> rt = RTrees::create();
+        rt->setMaxDepth(8);
+        rt->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER, 20, 0));
+        dt->setMaxBins(bins ? 64 : 0);
+        rt->setMaxBins(bins ? 64 : 0);
+        models[0] = dt;
+        models[1] = rt;
+        models[2].release();
+        if (classification)
+        {
+            Ptr<Boost> boost = Boost::create();
+            boost->setMaxDepth(2);
+            boost->setWeakCount(20);
+            boost->setMaxBins(bins ? 64 : 0);
+            models[2] = boost;
+        }
+        for (int k = 0; k < 3; k++)
+        {
+            if (!models[k])
+                continue;
+            theRNG() = RNG(12345);
+            ASSERT_TRUE(models[k]->train(data)) << k;
+            errors[k][bins] = models[k]->calcError(data, true, noArray());
+        }
+    }
+    for (int k = 0; k < 3; k++)
+    {
+        if (!models[k])
+            continue;
+        // the quantization must not affect the accuracy much
+        EXPECT_LE(errors[k][1], errors[k][0] * 1.1 + (classification ? 1. : 0.05)) << k;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, ML_Trees_MaxBins, testing::Bool());
+
+TEST(ML_DTrees, maxBins_save_load)
+{
+    Mat samples, responses;
+    makeTreesTrainData(500, true, samples, responses);
+    Ptr<DTrees> dt = DTrees::create();
+    dt->setMaxDepth(10);
+    dt->setCVFolds(0);
+    dt->setMaxBins(16);
+    ASSERT_TRUE(dt->train(samples, ml::ROW_SAMPLE, responses));
+
+    ASSERT_FALSE(dt->getSplits().empty());
+
+    string filename = cv::tempfile(".xml");
+    dt->save(filename);
+    Ptr<DTrees> loaded = Algorithm::load<DTrees>(filename);
+    remove(filename.c_str());
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(16, loaded->getMaxBins());
+
+    Mat r0, r1;
+    dt->predict(samples, r0);
+    loaded->predict(samples, r1);
+    EXPECT_EQ(0, cvtest::norm(r0, r1, NORM_INF));
+
+    EXPECT_THROW(dt->setMaxBins(1), Exception);
+    EXPECT_THROW(dt->setMaxBins(257), Exception);
+}
+
 
 }} // namespace
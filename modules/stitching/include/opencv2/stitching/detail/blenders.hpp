@@ -122,6 +122,49 @@ private:
 
 inline FeatherBlender::FeatherBlender(float _sharpness) { setSharpness(_sharpness); }
 
+/** @brief Base class for loaders of the source images of a panorama blended strip by strip.
+
+@sa MultiBandBlender::blendStrips
+ */
+class CV_EXPORTS BlenderStripSource
+{
+public:
+    virtual ~BlenderStripSource() {}
+
+    /** @brief Loads a part of a source image and of its mask.
+
+    It is called for the images intersecting the current strip only, so an implementation can keep
+    the images on disk and load just the requested rows of them.
+
+    @param idx Index of the source image
+    @param roi Part of the image to load, in the image coordinates
+    @param img Loaded part of the image (CV_16SC3 or CV_8UC3) of roi.size()
+    @param mask Loaded part of the image mask (CV_8U) of roi.size()
+     */
+    virtual void read(int idx, const Rect& roi, Mat& img, Mat& mask) = 0;
+};
+
+/** @brief Base class for receivers of a panorama blended strip by strip.
+
+@sa MultiBandBlender::blendStrips
+ */
+class CV_EXPORTS BlenderStripWriter
+{
+public:
+    virtual ~BlenderStripWriter() {}
+
+    /** @brief Receives the next strip of the panorama.
+
+    The strips come from top to bottom and cover the whole panorama. An implementation can pass
+    them to an image encoder writing images by strips or save them as separate tiles.
+
+    @param strip Blended rows of the panorama (CV_16SC3)
+    @param strip_mask Mask of the rows (CV_8U)
+    @param y Index of the first row of the strip in the panorama
+     */
+    virtual void write(const Mat& strip, const Mat& strip_mask, int y) = 0;
+};
+
 /** @brief Blender which uses multi-band blending algorithm (see @cite BA83).
  */
 class CV_EXPORTS_W MultiBandBlender : public Blender
@@ -136,7 +179,36 @@ public:
     CV_WRAP void feed(InputArray img, InputArray mask, Point tl) CV_OVERRIDE;
     CV_WRAP void blend(CV_IN_OUT InputOutputArray dst, CV_IN_OUT InputOutputArray dst_mask) CV_OVERRIDE;
 
+    /** @brief Blends the images strip by strip.
+
+    Unlike prepare(), feed() and blend(), which keep the Laplacian pyramids of the whole panorama,
+    only the pyramids of one strip of the panorama (with a margin required by the pyramids) are kept
+    in memory at once. The images intersecting the strip are fed into it, and the blended rows are
+    passed to the writer. Only the parts of the images intersecting the strip are requested from the
+    source. The result is the same as the one of blend().
+
+    @param corners Source images top-left corners
+    @param sizes Source images sizes
+    @param source Loader of the source images and masks
+    @param strip_height Height of the strips, it is rounded up to a multiple of 2^numBands()
+    @param writer Receiver of the blended strips
+     */
+    void blendStrips(const std::vector<Point> &corners, const std::vector<Size> &sizes, BlenderStripSource &source,
+                     int strip_height, BlenderStripWriter &writer);
+
+    /** @overload
+    @param imgs Source images (CV_16SC3 or CV_8UC3), they are kept in memory by the caller
+    @param masks Source image masks (CV_8U)
+    @param corners Source images top-left corners
+    @param strip_height Height of the strips, it is rounded up to a multiple of 2^numBands()
+    @param writer Receiver of the blended strips
+     */
+    void blendStrips(InputArrayOfArrays imgs, InputArrayOfArrays masks, const std::vector<Point> &corners,
+                     int strip_height, BlenderStripWriter &writer);
+
 private:
+    void prepareBands(Rect dst_roi);
+
     int actual_num_bands_, num_bands_;
     std::vector<UMat> dst_pyr_laplace_;
     std::vector<UMat> dst_band_weights_;
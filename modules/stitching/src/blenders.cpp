@@ -65,6 +65,101 @@ namespace detail {
 
 static const float WEIGHT_EPS = 1e-5f;
 
+// Adds the weighted source image to the destination image and the weights to the destination weights
+struct AddWeightedBody : ParallelLoopBody
+{
+    AddWeightedBody(const Mat& _src, const Mat& _weight, Mat& _dst, Mat& _dst_weight)
+        : src(_src), weight(_weight), dst(_dst), dst_weight(_dst_weight) {}
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        if (weight.type() == CV_32F)
+        {
+            for (int y = range.start; y < range.end; ++y)
+            {
+                const Point3_<short>* src_row = src.ptr<Point3_<short> >(y);
+                Point3_<short>* dst_row = dst.ptr<Point3_<short> >(y);
+                const float* weight_row = weight.ptr<float>(y);
+                float* dst_weight_row = dst_weight.ptr<float>(y);
+
+                for (int x = 0; x < dst.cols; ++x)
+                {
+                    dst_row[x].x += static_cast<short>(src_row[x].x * weight_row[x]);
+                    dst_row[x].y += static_cast<short>(src_row[x].y * weight_row[x]);
+                    dst_row[x].z += static_cast<short>(src_row[x].z * weight_row[x]);
+                    dst_weight_row[x] += weight_row[x];
+                }
+            }
+        }
+        else // weight.type() == CV_16S
+        {
+            for (int y = range.start; y < range.end; ++y)
+            {
+                const Point3_<short>* src_row = src.ptr<Point3_<short> >(y);
+                Point3_<short>* dst_row = dst.ptr<Point3_<short> >(y);
+                const short* weight_row = weight.ptr<short>(y);
+                short* dst_weight_row = dst_weight.ptr<short>(y);
+
+                for (int x = 0; x < dst.cols; ++x)
+                {
+                    dst_row[x].x += short((src_row[x].x * weight_row[x]) >> 8);
+                    dst_row[x].y += short((src_row[x].y * weight_row[x]) >> 8);
+                    dst_row[x].z += short((src_row[x].z * weight_row[x]) >> 8);
+                    dst_weight_row[x] += weight_row[x];
+                }
+            }
+        }
+    }
+
+    const Mat& src;
+    const Mat& weight;
+    Mat& dst;
+    Mat& dst_weight;
+};
+
+struct NormalizeUsingWeightMapBody : ParallelLoopBody
+{
+    NormalizeUsingWeightMapBody(const Mat& _weight, Mat& _src) : weight(_weight), src(_src) {}
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        if (weight.type() == CV_32FC1)
+        {
+            for (int y = range.start; y < range.end; ++y)
+            {
+                Point3_<short> *row = src.ptr<Point3_<short> >(y);
+                const float *weight_row = weight.ptr<float>(y);
+
+                for (int x = 0; x < src.cols; ++x)
+                {
+                    row[x].x = static_cast<short>(row[x].x / (weight_row[x] + WEIGHT_EPS));
+                    row[x].y = static_cast<short>(row[x].y / (weight_row[x] + WEIGHT_EPS));
+                    row[x].z = static_cast<short>(row[x].z / (weight_row[x] + WEIGHT_EPS));
+                }
+            }
+        }
+        else // weight.type() == CV_16SC1
+        {
+            for (int y = range.start; y < range.end; ++y)
+            {
+                const short *weight_row = weight.ptr<short>(y);
+                Point3_<short> *row = src.ptr<Point3_<short> >(y);
+
+                for (int x = 0; x < src.cols; ++x)
+                {
+                    int w = weight_row[x] + 1;
+                    row[x].x = static_cast<short>((row[x].x << 8) / w);
+                    row[x].y = static_cast<short>((row[x].y << 8) / w);
+                    row[x].z = static_cast<short>((row[x].z << 8) / w);
+                }
+            }
+        }
+    }
+
+    const Mat& weight;
+    Mat& src;
+};
+
 Ptr<Blender> Blender::createDefault(int type, bool try_gpu)
 {
     if (type == NO)
@@ -153,24 +248,9 @@ void FeatherBlender::feed(InputArray _img, InputArray mask, Point tl)
     Mat weight_map = weight_map_.getMat(ACCESS_READ);
     Mat dst_weight_map = dst_weight_map_.getMat(ACCESS_RW);
 
-    int dx = tl.x - dst_roi_.x;
-    int dy = tl.y - dst_roi_.y;
-
-    for (int y = 0; y < img.rows; ++y)
-    {
-        const Point3_<short>* src_row = img.ptr<Point3_<short> >(y);
-        Point3_<short>* dst_row = dst.ptr<Point3_<short> >(dy + y);
-        const float* weight_row = weight_map.ptr<float>(y);
-        float* dst_weight_row = dst_weight_map.ptr<float>(dy + y);
-
-        for (int x = 0; x < img.cols; ++x)
-        {
-            dst_row[dx + x].x += static_cast<short>(src_row[x].x * weight_row[x]);
-            dst_row[dx + x].y += static_cast<short>(src_row[x].y * weight_row[x]);
-            dst_row[dx + x].z += static_cast<short>(src_row[x].z * weight_row[x]);
-            dst_weight_row[dx + x] += weight_row[x];
-        }
-    }
+    Rect roi(tl.x - dst_roi_.x, tl.y - dst_roi_.y, img.cols, img.rows);
+    Mat dst_img = dst(roi), dst_weight = dst_weight_map(roi);
+    parallel_for_(Range(0, img.rows), AddWeightedBody(img, weight_map, dst_img, dst_weight));
 }
 
 
@@ -232,12 +312,17 @@ MultiBandBlender::MultiBandBlender(int try_gpu, int num_bands, int weight_type)
 
 void MultiBandBlender::prepare(Rect dst_roi)
 {
-    dst_roi_final_ = dst_roi;
-
     // Crop unnecessary bands
     double max_len = static_cast<double>(std::max(dst_roi.width, dst_roi.height));
     num_bands_ = std::min(actual_num_bands_, static_cast<int>(ceil(std::log(max_len) / std::log(2.0))));
 
+    prepareBands(dst_roi);
+}
+
+void MultiBandBlender::prepareBands(Rect dst_roi)
+{
+    dst_roi_final_ = dst_roi;
+
     // Add border to the final image, to ensure sizes are divided by (1 << num_bands_)
     dst_roi.width += ((1 << num_bands_) - dst_roi.width % (1 << num_bands_)) % (1 << num_bands_);
     dst_roi.height += ((1 << num_bands_) - dst_roi.height % (1 << num_bands_)) % (1 << num_bands_);
@@ -546,42 +631,8 @@ void MultiBandBlender::feed(InputArray _img, InputArray mask, Point tl)
             Mat _dst_pyr_laplace = dst_pyr_laplace_[i](rc).getMat(ACCESS_RW);
             Mat _weight_pyr_gauss = weight_pyr_gauss[i].getMat(ACCESS_READ);
             Mat _dst_band_weights = dst_band_weights_[i](rc).getMat(ACCESS_RW);
-            if (weight_type_ == CV_32F)
-            {
-                for (int y = 0; y < rc.height; ++y)
-                {
-                    const Point3_<short>* src_row = _src_pyr_laplace.ptr<Point3_<short> >(y);
-                    Point3_<short>* dst_row = _dst_pyr_laplace.ptr<Point3_<short> >(y);
-                    const float* weight_row = _weight_pyr_gauss.ptr<float>(y);
-                    float* dst_weight_row = _dst_band_weights.ptr<float>(y);
-
-                    for (int x = 0; x < rc.width; ++x)
-                    {
-                        dst_row[x].x += static_cast<short>(src_row[x].x * weight_row[x]);
-                        dst_row[x].y += static_cast<short>(src_row[x].y * weight_row[x]);
-                        dst_row[x].z += static_cast<short>(src_row[x].z * weight_row[x]);
-                        dst_weight_row[x] += weight_row[x];
-                    }
-                }
-            }
-            else // weight_type_ == CV_16S
-            {
-                for (int y = 0; y < y_br - y_tl; ++y)
-                {
-                    const Point3_<short>* src_row = _src_pyr_laplace.ptr<Point3_<short> >(y);
-                    Point3_<short>* dst_row = _dst_pyr_laplace.ptr<Point3_<short> >(y);
-                    const short* weight_row = _weight_pyr_gauss.ptr<short>(y);
-                    short* dst_weight_row = _dst_band_weights.ptr<short>(y);
-
-                    for (int x = 0; x < x_br - x_tl; ++x)
-                    {
-                        dst_row[x].x += short((src_row[x].x * weight_row[x]) >> 8);
-                        dst_row[x].y += short((src_row[x].y * weight_row[x]) >> 8);
-                        dst_row[x].z += short((src_row[x].z * weight_row[x]) >> 8);
-                        dst_weight_row[x] += weight_row[x];
-                    }
-                }
-            }
+            parallel_for_(Range(0, rc.height),
+                          AddWeightedBody(_src_pyr_laplace, _weight_pyr_gauss, _dst_pyr_laplace, _dst_band_weights));
         }
 #ifdef HAVE_OPENCL
         else
@@ -690,6 +741,97 @@ void MultiBandBlender::blend(InputOutputArray dst, InputOutputArray dst_mask)
 }
 
 
+namespace {
+
+class ArraysStripSource : public BlenderStripSource
+{
+public:
+    ArraysStripSource(InputArrayOfArrays imgs, InputArrayOfArrays masks) : imgs_(imgs), masks_(masks) {}
+
+    void read(int idx, const Rect& roi, Mat& img, Mat& mask) CV_OVERRIDE
+    {
+        img = imgs_.getMat(idx)(roi);
+        mask = masks_.getMat(idx)(roi);
+    }
+
+private:
+    const _InputArray& imgs_;
+    const _InputArray& masks_;
+};
+
+} // namespace
+
+void MultiBandBlender::blendStrips(InputArrayOfArrays _imgs, InputArrayOfArrays _masks,
+                                   const std::vector<Point> &corners, int strip_height,
+                                   BlenderStripWriter &writer)
+{
+    size_t num_images = corners.size();
+    CV_Assert(_imgs.total() == num_images && _masks.total() == num_images);
+
+    std::vector<Size> sizes(num_images);
+    for (size_t i = 0; i < num_images; ++i)
+        sizes[i] = _imgs.size((int)i);
+
+    ArraysStripSource source(_imgs, _masks);
+    blendStrips(corners, sizes, source, strip_height, writer);
+}
+
+
+void MultiBandBlender::blendStrips(const std::vector<Point> &corners, const std::vector<Size> &sizes,
+                                   BlenderStripSource &source, int strip_height,
+                                   BlenderStripWriter &writer)
+{
+    CV_INSTRUMENT_REGION();
+
+    size_t num_images = corners.size();
+    CV_Assert(sizes.size() == num_images);
+    CV_Assert(strip_height > 0);
+
+    Rect dst_roi = resultRoi(corners, sizes);
+
+    // Use the bands of the whole panorama for every strip
+    double max_len = static_cast<double>(std::max(dst_roi.width, dst_roi.height));
+    int num_bands = std::min(actual_num_bands_, static_cast<int>(ceil(std::log(max_len) / std::log(2.0))));
+
+    // Strips are aligned to the coarsest level of the pyramids, and the margin covers the rows
+    // which affect the rows of the strip through the pyramids of the images and their weights
+    int align = 1 << num_bands;
+    int margin = 8 * align;
+    strip_height = alignSize(strip_height, align);
+
+    MultiBandBlender blender(false, num_bands, weight_type_);
+    blender.num_bands_ = num_bands;
+
+    for (int y = 0; y < dst_roi.height; y += strip_height)
+    {
+        int y0 = std::max(y - margin, 0);
+        int y1 = std::min(y + strip_height + margin, dst_roi.height);
+        Rect strip_roi(dst_roi.x, dst_roi.y + y0, dst_roi.width, y1 - y0);
+
+        blender.prepareBands(strip_roi);
+        for (size_t i = 0; i < num_images; ++i)
+        {
+            Rect roi = Rect(corners[i], sizes[i]) & strip_roi;
+            if (roi.empty())
+                continue;
+            Rect src_roi(roi.tl() - corners[i], roi.size());
+            Mat img, mask;
+            source.read((int)i, src_roi, img, mask);
+            CV_Assert(img.size() == src_roi.size() && mask.size() == src_roi.size());
+            if (countNonZero(mask) == 0)
+                continue;
+            blender.feed(img, mask, roi.tl());
+        }
+
+        Mat strip, strip_mask;
+        blender.blend(strip, strip_mask);
+
+        Range rows(y - y0, std::min(y + strip_height, dst_roi.height) - y0);
+        writer.write(strip.rowRange(rows), strip_mask.rowRange(rows), y);
+    }
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 // Auxiliary functions
 
@@ -728,40 +870,9 @@ void normalizeUsingWeightMap(InputArray _weight, InputOutputArray _src)
         weight = _weight.getMat();
 
         CV_Assert(src.type() == CV_16SC3);
+        CV_Assert(weight.type() == CV_32FC1 || weight.type() == CV_16SC1);
 
-        if (weight.type() == CV_32FC1)
-        {
-            for (int y = 0; y < src.rows; ++y)
-            {
-                Point3_<short> *row = src.ptr<Point3_<short> >(y);
-                const float *weight_row = weight.ptr<float>(y);
-
-                for (int x = 0; x < src.cols; ++x)
-                {
-                    row[x].x = static_cast<short>(row[x].x / (weight_row[x] + WEIGHT_EPS));
-                    row[x].y = static_cast<short>(row[x].y / (weight_row[x] + WEIGHT_EPS));
-                    row[x].z = static_cast<short>(row[x].z / (weight_row[x] + WEIGHT_EPS));
-                }
-            }
-        }
-        else
-        {
-            CV_Assert(weight.type() == CV_16SC1);
-
-            for (int y = 0; y < src.rows; ++y)
-            {
-                const short *weight_row = weight.ptr<short>(y);
-                Point3_<short> *row = src.ptr<Point3_<short> >(y);
-
-                for (int x = 0; x < src.cols; ++x)
-                {
-                    int w = weight_row[x] + 1;
-                    row[x].x = static_cast<short>((row[x].x << 8) / w);
-                    row[x].y = static_cast<short>((row[x].y << 8) / w);
-                    row[x].z = static_cast<short>((row[x].z << 8) / w);
-                }
-            }
-        }
+        parallel_for_(Range(0, src.rows), NormalizeUsingWeightMapBody(weight, src));
     }
 #ifdef HAVE_OPENCL
     else
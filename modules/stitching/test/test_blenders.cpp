@@ -76,4 +76,162 @@ TEST(MultiBandBlender, CanBlendTwoImages)
     EXPECT_GE(psnr, 50);
 }
 
+struct StripCollector : public detail::BlenderStripWriter
+{
+    Mat dst, dst_mask;
+    int next_y;
+
+    StripCollector(Size size, int type) : dst(size, type, Scalar::all(0)), dst_mask(size, CV_8U, Scalar::all(0)), next_y(0) {}
+
+    void write(const Mat& strip, const Mat& strip_mask, int y) CV_OVERRIDE
+    {
+        ASSERT_EQ(next_y, y);
+        ASSERT_EQ(strip.rows, strip_mask.rows);
+        strip.copyTo(dst.rowRange(y, y + strip.rows));
+        strip_mask.copyTo(dst_mask.rowRange(y, y + strip.rows));
+        next_y = y + strip.rows;
+    }
+};
+
+void makeBlenderInputs(std::vector<Mat>& images, std::vector<Mat>& masks, std::vector<Point>& corners)
+{
+    RNG rng(12345);
+    const Size size(320, 240);
+    const Point offsets[] = { Point(0, 0), Point(200, 30), Point(90, 170), Point(260, 210) };
+    for (size_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++)
+    {
+        Mat img(size, CV_8UC3), img_s;
+        rng.fill(img, RNG::UNIFORM, Scalar::all(0), Scalar::all(256));
+        GaussianBlur(img, img, Size(5, 5), 0);
+        img.convertTo(img_s, CV_16S);
+
+        Mat mask(size, CV_8U, Scalar::all(0));
+        ellipse(mask, Point(size.width / 2, size.height / 2), Size(size.width / 2 - 5, size.height / 2 - 5),
+                0, 0, 360, Scalar::all(255), FILLED);
+
+        images.push_back(img_s);
+        masks.push_back(mask);
+        corners.push_back(offsets[i]);
+    }
+}
+
+// loads the images from memory, remembering which rows were requested
+struct StripSourceLog : public detail::BlenderStripSource
+{
+    const std::vector<Mat>& images;
+    const std::vector<Mat>& masks;
+    std::vector<std::vector<Rect> > requests;
+
+    StripSourceLog(const std::vector<Mat>& images_, const std::vector<Mat>& masks_)
+        : images(images_), masks(masks_), requests(images_.size()) {}
+
+    void read(int idx, const Rect& roi, Mat& img, Mat& mask) CV_OVERRIDE
+    {
+        requests[idx].push_back(roi);
+        images[idx](roi).copyTo(img);
+        masks[idx](roi).copyTo(mask);
+    }
+};
+
+typedef testing::TestWithParam<int> MultiBandBlenderStrips;
+
+TEST_P(MultiBandBlenderStrips, SameAsBlend)
+{
+    const int weight_type = GetParam();
+    std::vector<Mat> images, masks;
+    std::vector<Point> corners;
+    makeBlenderInputs(images, masks, corners);
+
+    std::vector<Size> sizes;
+    for (size_t i = 0; i < images.size(); i++)
+        sizes.push_back(images[i].size());
+    const Rect dst_roi = detail::resultRoi(corners, sizes);
+
+    detail::MultiBandBlender blender(false, 5, weight_type);
+    blender.prepare(dst_roi);
+    for (size_t i = 0; i < images.size(); i++)
+        blender.feed(images[i], masks[i], corners[i]);
+    Mat expected, expected_mask;
+    blender.blend(expected, expected_mask);
+
+    const int strip_heights[] = { 1, 100, 1000 };
+    for (size_t i = 0; i < sizeof(strip_heights) / sizeof(strip_heights[0]); i++)
+    {
+        SCOPED_TRACE(cv::format("strip_height=%d", strip_heights[i]));
+        StripCollector writer(dst_roi.size(), expected.type());
+        detail::MultiBandBlender strip_blender(false, 5, weight_type);
+        strip_blender.blendStrips(images, masks, corners, strip_heights[i], writer);
+
+        ASSERT_EQ(dst_roi.height, writer.next_y);
+        EXPECT_EQ(0, cvtest::norm(expected, writer.dst, NORM_INF));
+        EXPECT_EQ(0, cvtest::norm(expected_mask, writer.dst_mask, NORM_INF));
+    }
+}
+
+TEST_P(MultiBandBlenderStrips, LoadsCrossingImagesOnly)
+{
+    const int weight_type = GetParam();
+    std::vector<Mat> images, masks;
+    std::vector<Point> corners;
+    makeBlenderInputs(images, masks, corners);
+
+    std::vector<Size> sizes;
+    for (size_t i = 0; i < images.size(); i++)
+        sizes.push_back(images[i].size());
+    const Rect dst_roi = detail::resultRoi(corners, sizes);
+
+    // 2 bands keep the margin of the strips (8 << 2 rows) smaller than the images
+    const int num_bands = 2, strip_height = 16;
+    const int num_strips = (dst_roi.height + strip_height - 1) / strip_height;
+    StripCollector expected(dst_roi.size(), CV_16SC3);
+    detail::MultiBandBlender(false, num_bands, weight_type).blendStrips(images, masks, corners, strip_height, expected);
+
+    StripSourceLog source(images, masks);
+    StripCollector writer(dst_roi.size(), CV_16SC3);
+    detail::MultiBandBlender(false, num_bands, weight_type).blendStrips(corners, sizes, source, strip_height, writer);
+
+    ASSERT_EQ(dst_roi.height, writer.next_y);
+    EXPECT_EQ(0, cvtest::norm(expected.dst, writer.dst, NORM_INF));
+    EXPECT_EQ(0, cvtest::norm(expected.dst_mask, writer.dst_mask, NORM_INF));
+    for (size_t i = 0; i < images.size(); i++)
+    {
+        // an image is read by parts, for the strips crossing it only
+        ASSERT_FALSE(source.requests[i].empty());
+        EXPECT_LT((int)source.requests[i].size(), num_strips) << "image " << i;
+        for (size_t j = 0; j < source.requests[i].size(); j++)
+            EXPECT_LT(source.requests[i][j].height, sizes[i].height) << "image " << i << " request " << j;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(Stitching, MultiBandBlenderStrips, testing::Values((int)CV_32F, (int)CV_16S));
+
+TEST(Blender, ParallelSameAsSerial)
+{
+    std::vector<Mat> images, masks;
+    std::vector<Point> corners;
+    makeBlenderInputs(images, masks, corners);
+
+    const int types[] = { detail::Blender::FEATHER, detail::Blender::MULTI_BAND };
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++)
+    {
+        Mat results[2];
+        for (int k = 0; k < 2; k++)
+        {
+            const int threads = getNumThreads();
+            setNumThreads(k == 0 ? 1 : 4);
+            Ptr<detail::Blender> blender = detail::Blender::createDefault(types[t], false);
+            std::vector<Size> sizes;
+            for (size_t i = 0; i < images.size(); i++)
+                sizes.push_back(images[i].size());
+            blender->prepare(corners, sizes);
+            for (size_t i = 0; i < images.size(); i++)
+                blender->feed(images[i], masks[i], corners[i]);
+            Mat result_mask;
+            blender->blend(results[k], result_mask);
+            setNumThreads(threads);
+        }
+        EXPECT_EQ(0, cvtest::norm(results[0], results[1], NORM_INF)) << "blender type " << types[t];
+    }
+}
+
 }} // namespace
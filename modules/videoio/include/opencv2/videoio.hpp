@@ -211,6 +211,10 @@ enum VideoCaptureProperties {
        CAP_PROP_CODEC_EXTRADATA_INDEX = 68, //!< Positive index indicates that returning extra data is supported by the video back end.  This can be retrieved as cap.retrieve(data, <returned index>).  E.g. When reading from a h264 encoded RTSP stream, the FFmpeg backend could return the SPS and/or PPS if available (if sent in reply to a DESCRIBE request), from calls to cap.retrieve(data, <returned index>).
        CAP_PROP_FRAME_TYPE = 69, //!< (read-only) FFmpeg back-end only - Frame type ascii code (73 = 'I', 80 = 'P', 66 = 'B' or 63 = '?' if unknown) of the most recently read frame.
        CAP_PROP_N_THREADS = 70, //!< (**open-only**) Set the maximum number of threads to use. Use 0 to use as many threads as CPU cores (applicable for FFmpeg back-end only).
+       CAP_PROP_DECODE_QUEUE_SIZE = 71, //!< (**open-only**) Number of frames decoded and converted ahead in the background threads. 0 (default) disables asynchronous decoding. Can't be combined with raw stream mode (CAP_PROP_FORMAT = -1) (applicable for FFmpeg back-end only).
+       CAP_PROP_OUTPUT_FORMAT = 72, //!< Format of the retrieved frames, see cv::VideoCaptureOutputFormats (applicable for FFmpeg back-end only).
+       CAP_PROP_OUTPUT_WIDTH = 73, //!< Width of the retrieved frames, the frames are resized in the same pass as the color conversion. 0 (default) keeps the frame width, or scales it with the aspect ratio if only CAP_PROP_OUTPUT_HEIGHT is set. #CAP_PROP_FRAME_WIDTH and #CAP_PROP_FRAME_HEIGHT report the resulting size (applicable for FFmpeg back-end only).
+       CAP_PROP_OUTPUT_HEIGHT = 74, //!< Height of the retrieved frames, see CAP_PROP_OUTPUT_WIDTH (applicable for FFmpeg back-end only).
 #ifndef CV_DOXYGEN
        CV__CAP_PROP_LATEST
 #endif
@@ -268,6 +272,33 @@ enum VideoAccelerationType
 
 //! @} Hardware acceleration support
 
+/** @name Output formats
+    @{
+*/
+
+/** @brief Formats of the frames retrieved from cv::VideoCapture
+ *
+ * Used as value in #CAP_PROP_OUTPUT_FORMAT.
+ *
+ * YUV frames are retrieved without color conversion. If the decoded frame already has the requested layout and
+ * no resize is requested, the planes are returned as Mat headers referencing the buffers of the decoder (no copy),
+ * the buffers are kept alive while these headers exist. The buffers which the decoder still uses as references
+ * for the next frames are copied, so the returned planes may be modified. Pass `std::vector<Mat>` to VideoCapture::retrieve()
+ * to get the planes separately; a single Mat receives the planes packed one after another, the layout expected
+ * by cv::cvtColor (e.g. #COLOR_YUV2BGR_NV12), so the packed NV12 and I420 frames are always copies.
+ *
+ * @note Orientation of the video (#CAP_PROP_ORIENTATION_AUTO) is applied to GRAY frames, but not to NV12 and I420 frames.
+ */
+enum VideoCaptureOutputFormats
+{
+    CAP_OUTPUT_FORMAT_BGR   = 0,  //!< BGR, 8UC3 (default). See also #CAP_PROP_CONVERT_RGB.
+    CAP_OUTPUT_FORMAT_GRAY  = 1,  //!< Luma plane, 8UC1. The value range of the video stream is kept.
+    CAP_OUTPUT_FORMAT_NV12  = 2,  //!< Y plane (8UC1) and interleaved UV plane (8UC2, half size).
+    CAP_OUTPUT_FORMAT_I420  = 3,  //!< Y, U and V planes (8UC1, the chroma planes are half size).
+};
+
+//! @} Output formats
+
 /** @name IEEE 1394 drivers
     @{
 */
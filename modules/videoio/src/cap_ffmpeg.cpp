@@ -103,7 +103,26 @@ public:
             }
         }
 
+        const bool separatePlanes = frame.kind() == _InputArray::STD_VECTOR_MAT &&
+                                    ffmpegCapture->output_format != CAP_OUTPUT_FORMAT_BGR;
         if (flag == 0) {
+            // YUV planes of the decoded picture, without copying
+            std::vector<cv::Mat> planes;
+            if (ffmpegCapture->retrieveFramePlanes(planes, separatePlanes)) {
+                // GRAY is rotated like BGR in both forms, NV12 and I420 are never rotated
+                if (!isPackedYUVOutput(ffmpegCapture->output_format))
+                    applyMetadataRotation(*this, planes[0]);
+                if (separatePlanes) {
+                    frame.create((int)planes.size(), 1, CV_8UC1);
+                    for (size_t i = 0; i < planes.size(); i++)
+                        frame.getMatRef((int)i) = planes[i];
+                }
+                else {
+                    frame.assign(planes[0]);
+                }
+                return true;
+            }
+
             if (!icvRetrieveFrame2_FFMPEG_p(ffmpegCapture, &data, &step, &width, &height, &cn, &depth))
                 return false;
         }
@@ -113,7 +132,12 @@ public:
         }
 
         cv::Mat tmp(height, width, CV_MAKETYPE(depth, cn), data, step);
-        applyMetadataRotation(*this, tmp);
+        if (!isPackedYUVOutput(ffmpegCapture->output_format))
+            applyMetadataRotation(*this, tmp);
+        if (flag == 0 && separatePlanes) {
+            copyPlanes(tmp, ffmpegCapture->output_format, frame);
+            return true;
+        }
         tmp.copyTo(frame);
 
         return true;
@@ -137,6 +161,29 @@ public:
     virtual int getCaptureDomain() CV_OVERRIDE { return CV_CAP_FFMPEG; }
 
 protected:
+    // splits the packed YUV frame (see CAP_PROP_OUTPUT_FORMAT) into planes
+    static void copyPlanes(const cv::Mat& packed, int format, cv::OutputArray planes)
+    {
+        const int width = packed.cols;
+        const int height = isPackedYUVOutput(format) ? packed.rows * 2 / 3 : packed.rows;
+        std::vector<cv::Mat> src;
+        src.push_back(packed.rowRange(0, height));
+        if (format == CAP_OUTPUT_FORMAT_NV12)
+        {
+            src.push_back(cv::Mat(height / 2, width / 2, CV_8UC2, (void*)packed.ptr(height), packed.step));
+        }
+        else if (format == CAP_OUTPUT_FORMAT_I420)
+        {
+            CV_Assert(packed.isContinuous());
+            const uchar* u = packed.ptr(height);
+            src.push_back(cv::Mat(height / 2, width / 2, CV_8UC1, (void*)u));
+            src.push_back(cv::Mat(height / 2, width / 2, CV_8UC1, (void*)(u + (width / 2) * (height / 2))));
+        }
+        planes.create((int)src.size(), 1, CV_8UC1);
+        for (size_t i = 0; i < src.size(); i++)
+            src[i].copyTo(planes.getMatRef((int)i));
+    }
+
     CvCapture_FFMPEG* ffmpegCapture;
 };
 
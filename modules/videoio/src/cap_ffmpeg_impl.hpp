@@ -51,8 +51,14 @@ using namespace cv;
 # include <pthread.h>
 #endif
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <limits>
+#include <mutex>
 #include <string.h>
+#include <thread>
+#include <vector>
 
 #ifndef __OPENCV_BUILD
 #define CV_FOURCC(c1, c2, c3, c4) (((c1) & 255) + (((c2) & 255) << 8) + (((c3) & 255) << 16) + (((c4) & 255) << 24))
@@ -524,6 +530,19 @@ inline static std::string _opencv_ffmpeg_get_error_string(int error_code)
         return std::string("Unknown error");
 }
 
+class FFmpegDecodeQueue;
+
+// conversion of a decoded picture into the output format (CAP_PROP_OUTPUT_*)
+struct OutputConversion
+{
+    AVPixelFormat src_format, dst_format;
+    int src_width, src_height;        // input of sws_scale
+    int buffer_width, buffer_height;  // output of sws_scale
+    int width, height;                // retrieved frame
+    bool exact_size;  // converted at the output size, otherwise at the coded size of the stream
+    bool luma_only;   // the first plane of the picture is converted as GRAY8 image
+};
+
 struct CvCapture_FFMPEG
 {
     bool open(const char* filename, const VideoCaptureParameters& params);
@@ -532,8 +551,13 @@ struct CvCapture_FFMPEG
     double getProperty(int) const;
     bool setProperty(int, double);
     bool grabFrame();
+    bool readFrame();
     bool retrieveFrame(int flag, unsigned char** data, int* step, int* width, int* height, int* cn, int* depth);
     bool retrieveHWFrame(cv::OutputArray output);
+    bool retrieveFramePlanes(std::vector<cv::Mat>& planes, bool separate_planes);
+    void getOutputConversion(const AVFrame* src, int width, int height, int coded_width, int coded_height,
+                             OutputConversion& conv) const;
+    cv::Size getOutputSize(int width, int height) const;
     void rotateFrame(cv::Mat &mat) const;
 
     void init();
@@ -592,6 +616,8 @@ struct CvCapture_FFMPEG
     bool rawModeInitialized;
     bool rawSeek;
     bool convertRGB;
+    int output_format;  // VideoCaptureOutputFormats
+    int output_width, output_height;
     AVPacket packet_filtered;
 #if LIBAVFORMAT_BUILD >= CALC_FFMPEG_VERSION(58, 20, 100)
     AVBSFContext* bsfc;
@@ -602,6 +628,193 @@ struct CvCapture_FFMPEG
     int hw_device;
     int use_opencl;
     int extraDataIdx;
+    FFmpegDecodeQueue* decode_queue;  // asynchronous decoding (CAP_PROP_DECODE_QUEUE_SIZE)
+};
+
+static void getPictureFormatType(AVPixelFormat result_format, int* depth, int* cn)
+{
+    switch (result_format)
+    {
+    case AV_PIX_FMT_BGR24: *depth = CV_8U; *cn = 3; break;
+    case AV_PIX_FMT_GRAY8: *depth = CV_8U; *cn = 1; break;
+    case AV_PIX_FMT_GRAY16LE: *depth = CV_16U; *cn = 1; break;
+    // packed planes (CAP_OUTPUT_FORMAT_NV12/I420)
+    case AV_PIX_FMT_NV12:
+    case AV_PIX_FMT_YUV420P:
+    case AV_PIX_FMT_YUVJ420P: *depth = CV_8U; *cn = 1; break;
+    default:
+        CV_LOG_WARNING(NULL, "Unknown/unsupported picture format: " << av_get_pix_fmt_name(result_format)
+                       << ", will be treated as 8UC1.");
+        *depth = CV_8U;
+        *cn = 1;
+        break; // TODO: return false?
+    }
+}
+
+static inline bool isPackedYUVOutput(int output_format)
+{
+    return output_format == CAP_OUTPUT_FORMAT_NV12 || output_format == CAP_OUTPUT_FORMAT_I420;
+}
+
+// 8-bit formats with the luma in the first plane
+static bool hasLumaPlane(AVPixelFormat format)
+{
+    switch (format)
+    {
+    case AV_PIX_FMT_GRAY8:
+    case AV_PIX_FMT_NV12:
+    case AV_PIX_FMT_NV21:
+    case AV_PIX_FMT_YUV420P:
+    case AV_PIX_FMT_YUVJ420P:
+    case AV_PIX_FMT_YUVA420P:
+    case AV_PIX_FMT_YUV422P:
+    case AV_PIX_FMT_YUVJ422P:
+    case AV_PIX_FMT_YUV440P:
+    case AV_PIX_FMT_YUVJ440P:
+    case AV_PIX_FMT_YUV444P:
+    case AV_PIX_FMT_YUVJ444P:
+    case AV_PIX_FMT_YUV411P:
+    case AV_PIX_FMT_YUV410P:
+        return true;
+    default:
+        return false;
+    }
+}
+
+cv::Size CvCapture_FFMPEG::getOutputSize(int width, int height) const
+{
+    cv::Size size(width, height);
+    if (output_width > 0 || output_height > 0)
+    {
+        size.width = output_width > 0 ? output_width : std::max(1, cvRound((double)width * output_height / height));
+        size.height = output_height > 0 ? output_height : std::max(1, cvRound((double)height * output_width / width));
+    }
+    if (isPackedYUVOutput(output_format))
+    {
+        // 4:2:0 subsampled planes
+        size.width = std::max(2, size.width & ~1);
+        size.height = std::max(2, size.height & ~1);
+    }
+    return size;
+}
+
+void CvCapture_FFMPEG::getOutputConversion(const AVFrame* src, int width, int height, int coded_width, int coded_height,
+                                           OutputConversion& conv) const
+{
+    conv.src_format = (AVPixelFormat)src->format;
+    // the luma is taken as is, without range conversion of sws_scale
+    conv.luma_only = output_format == CAP_OUTPUT_FORMAT_GRAY && hasLumaPlane(conv.src_format);
+    if (conv.luma_only)
+        conv.src_format = AV_PIX_FMT_GRAY8;
+    switch (output_format)
+    {
+    case CAP_OUTPUT_FORMAT_GRAY: conv.dst_format = AV_PIX_FMT_GRAY8; break;
+    case CAP_OUTPUT_FORMAT_NV12: conv.dst_format = AV_PIX_FMT_NV12; break;
+    case CAP_OUTPUT_FORMAT_I420:
+        conv.dst_format = conv.src_format == AV_PIX_FMT_YUVJ420P ? AV_PIX_FMT_YUVJ420P : AV_PIX_FMT_YUV420P;
+        break;
+    default:
+        conv.dst_format = convertRGB ? AV_PIX_FMT_BGR24 : conv.src_format;
+        break;
+    }
+
+    const cv::Size size = getOutputSize(width, height);
+    conv.width = size.width;
+    conv.height = size.height;
+
+    conv.exact_size = isPackedYUVOutput(output_format) || conv.width != width || conv.height != height;
+    if (conv.exact_size)
+    {
+        conv.src_width = src->width;
+        conv.src_height = src->height;
+        conv.buffer_width = conv.width;
+        conv.buffer_height = conv.height;
+    }
+    else
+    {
+        // Some sws_scale optimizations have some assumptions about alignment of data/step/width/height
+        // Also we use coded_width/height to workaround problem with legacy ffmpeg versions (like n0.8)
+        conv.src_width = conv.buffer_width = coded_width;
+        conv.src_height = conv.buffer_height = coded_height;
+    }
+}
+
+/*
+ * Asynchronous decoding (CAP_PROP_DECODE_QUEUE_SIZE)
+ *
+ * The decoding thread demuxes and decodes the frames ahead of the consumer with the synchronous
+ * CvCapture_FFMPEG::readFrame() and puts references to the decoded pictures into a bounded queue.
+ * The conversion threads take the decoded pictures from the queue and convert them with their own
+ * sws contexts into the buffers of the queue entries, so several frames are converted in parallel.
+ * The entries (and their buffers) are recycled. grabFrame() waits until the first entry of the
+ * queue is converted, retrieveFrame() returns its buffer.
+ *
+ * While the queue is running, the capture state used by readFrame() belongs to the decoding thread.
+ * The state reported by getProperty() (position, frame type, key frame flag, bitrate) is copied to
+ * the queue entry with the decoded picture and is taken from the entry of the last grabbed frame.
+ * An exception of the decoding thread is rethrown by grabFrame() after the frames decoded before it.
+ */
+class FFmpegDecodeQueue
+{
+public:
+    FFmpegDecodeQueue(CvCapture_FFMPEG* capture_, int queue_size_);
+    ~FFmpegDecodeQueue();
+
+    void start();
+    void stop();  // drops the decoded frames
+
+    bool grab();
+    bool retrieve(unsigned char** data, int* step, int* width, int* height, int* cn, int* depth) const;
+
+    // capture state at the time the frame was decoded
+    struct FrameInfo
+    {
+        int64_t picture_pts, frame_number;
+        char pict_type;
+        bool key_frame;   // CAP_PROP_LRF_HAS_KEY_FRAME
+        int64_t bitrate;  // CAP_PROP_BITRATE
+    };
+
+    // state of the last grabbed frame
+    const FrameInfo& getFrameInfo() const { return info; }
+
+protected:
+    struct Entry
+    {
+        enum State { DECODED, CONVERTING, READY, FAILED };
+
+        AVFrame* picture;  // decoded picture, released after conversion
+        int coded_width, coded_height;
+        int width, height;
+        FrameInfo info;
+        State state;
+
+        cv::Mat buffer;  // converted picture, the first plane is returned
+        int step, depth, cn;
+        int output_width, output_height;
+    };
+
+    void decodeLoop();
+    void convertLoop();
+    bool convert(Entry& e, struct SwsContext*& ctx) const;
+    Entry* newEntry();
+
+    CvCapture_FFMPEG* const capture;
+    const size_t queue_size;
+    int n_converters;
+
+    std::mutex mutex;
+    std::condition_variable cond;  // all changes of the queue state are notified
+    std::deque<Entry*> queue;      // in decoding order
+    std::vector<Entry*> free_entries;
+    Entry* current;                // last grabbed frame
+    std::vector<std::thread> threads;
+    bool running, stopping, eof;
+    std::exception_ptr error;      // exception of the decoding thread, rethrown by grab()
+
+    FrameInfo info;
+
+    FrameInfo captureFrameInfo() const;
 };
 
 void CvCapture_FFMPEG::init()
@@ -646,6 +859,8 @@ void CvCapture_FFMPEG::init()
     rawModeInitialized = false;
     rawSeek = false;
     convertRGB = true;
+    output_format = CAP_OUTPUT_FORMAT_BGR;
+    output_width = output_height = 0;
     memset(&packet_filtered, 0, sizeof(packet_filtered));
     av_init_packet(&packet_filtered);
     bsfc = NULL;
@@ -653,11 +868,16 @@ void CvCapture_FFMPEG::init()
     hw_device = -1;
     use_opencl = 0;
     extraDataIdx = 1;
+    decode_queue = NULL;
 }
 
 
 void CvCapture_FFMPEG::close()
 {
+    // stop the background threads first, they use the decoder
+    delete decode_queue;
+    decode_queue = NULL;
+
     if( img_convert_ctx )
     {
         sws_freeContext(img_convert_ctx);
@@ -1035,6 +1255,7 @@ bool CvCapture_FFMPEG::open(const char* _filename, const VideoCaptureParameters&
     unsigned i;
     bool valid = false;
     int nThreads = 0;
+    int decodeQueueSize = 0;
 
     close();
 
@@ -1092,6 +1313,17 @@ bool CvCapture_FFMPEG::open(const char* _filename, const VideoCaptureParameters&
             if (params.has(CAP_PROP_HW_ACCELERATION_USE_OPENCL)) {
                 use_opencl = params.get<int>(CAP_PROP_HW_ACCELERATION_USE_OPENCL);
             }
+            if (params.has(CAP_PROP_OUTPUT_FORMAT))
+            {
+                output_format = params.get<int>(CAP_PROP_OUTPUT_FORMAT);
+                if (output_format < CAP_OUTPUT_FORMAT_BGR || output_format > CAP_OUTPUT_FORMAT_I420)
+                {
+                    CV_LOG_ERROR(NULL, "VIDEOIO/FFMPEG: CAP_PROP_OUTPUT_FORMAT parameter value is invalid/unsupported: " << output_format);
+                    return false;
+                }
+            }
+            output_width = std::max(0, params.get<int>(CAP_PROP_OUTPUT_WIDTH, 0));
+            output_height = std::max(0, params.get<int>(CAP_PROP_OUTPUT_HEIGHT, 0));
         }
 #if USE_AV_INTERRUPT_CALLBACK
         if (params.has(CAP_PROP_OPEN_TIMEOUT_MSEC))
@@ -1107,6 +1339,27 @@ bool CvCapture_FFMPEG::open(const char* _filename, const VideoCaptureParameters&
         {
             nThreads = params.get<int>(CAP_PROP_N_THREADS);
         }
+        if (params.has(CAP_PROP_DECODE_QUEUE_SIZE))
+        {
+            decodeQueueSize = params.get<int>(CAP_PROP_DECODE_QUEUE_SIZE);
+            if (decodeQueueSize < 0)
+            {
+                CV_LOG_ERROR(NULL, "VIDEOIO/FFMPEG: CAP_PROP_DECODE_QUEUE_SIZE parameter value is invalid: " << decodeQueueSize);
+                return false;
+            }
+            if (decodeQueueSize > 0 && rawMode)
+            {
+                CV_LOG_ERROR(NULL, "VIDEOIO/FFMPEG: CAP_PROP_DECODE_QUEUE_SIZE can't be used in demuxer only mode. Bailout");
+                return false;
+            }
+#if !USE_AV_FRAME_GET_BUFFER
+            if (decodeQueueSize > 0)
+            {
+                CV_LOG_ERROR(NULL, "VIDEOIO/FFMPEG: FFmpeg backend is build without reference counted frames support. Can't handle CAP_PROP_DECODE_QUEUE_SIZE parameter. Bailout");
+                return false;
+            }
+#endif
+        }
         if (params.warnUnusedParameters())
         {
             CV_LOG_ERROR(NULL, "VIDEOIO/FFMPEG: unsupported parameters in .open(), see logger INFO channel for details. Bailout");
@@ -1354,12 +1607,23 @@ exit_func:
 
     if( !valid )
         close();
+    else if (decodeQueueSize > 0)
+    {
+        CV_LOG_INFO(NULL, "VIDEOIO/FFMPEG: asynchronous decoding, queue size: " << decodeQueueSize);
+        decode_queue = new FFmpegDecodeQueue(this, decodeQueueSize);
+        decode_queue->start();
+    }
 
     return valid;
 }
 
 bool CvCapture_FFMPEG::setRaw()
 {
+    if (decode_queue)
+    {
+        CV_LOG_WARNING(NULL, "VIDEOIO/FFMPEG: demuxer only mode is not supported with asynchronous decoding (CAP_PROP_DECODE_QUEUE_SIZE)");
+        return false;
+    }
     if (!rawMode)
     {
         if (frame_number != 0)
@@ -1471,6 +1735,13 @@ bool CvCapture_FFMPEG::processRawPacket()
 }
 
 bool CvCapture_FFMPEG::grabFrame()
+{
+    if (decode_queue)
+        return decode_queue->grab();
+    return readFrame();
+}
+
+bool CvCapture_FFMPEG::readFrame()
 {
     if (rawSeek) {
         rawSeek = false;
@@ -1633,6 +1904,9 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
         return  ret;
     }
 
+    if (decode_queue)
+        return flag == 0 && decode_queue->retrieve(data, step, width, height, cn, depth);
+
     AVFrame* sw_picture = picture;
 #if USE_AV_HW_CODECS
     // if hardware frame, copy it to system memory
@@ -1650,33 +1924,27 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
         return false;
 
     CV_LOG_DEBUG(NULL, "Input picture format: " << av_get_pix_fmt_name((AVPixelFormat)sw_picture->format));
-    const AVPixelFormat result_format = convertRGB ? AV_PIX_FMT_BGR24 : (AVPixelFormat)sw_picture->format;
-    switch (result_format)
-    {
-    case AV_PIX_FMT_BGR24: *depth = CV_8U; *cn = 3; break;
-    case AV_PIX_FMT_GRAY8: *depth = CV_8U; *cn = 1; break;
-    case AV_PIX_FMT_GRAY16LE: *depth = CV_16U; *cn = 1; break;
-    default:
-        CV_LOG_WARNING(NULL, "Unknown/unsupported picture format: " << av_get_pix_fmt_name(result_format)
-                       << ", will be treated as 8UC1.");
-        *depth = CV_8U;
-        *cn = 1;
-        break; // TODO: return false?
-    }
+    OutputConversion conv;
+    getOutputConversion(sw_picture,
+                        video_st->CV_FFMPEG_CODEC_FIELD->width, video_st->CV_FFMPEG_CODEC_FIELD->height,
+                        context->coded_width, context->coded_height, conv);
+    const AVPixelFormat result_format = conv.dst_format;
+    getPictureFormatType(result_format, depth, cn);
 
     if( img_convert_ctx == NULL ||
         frame.width != video_st->CV_FFMPEG_CODEC_FIELD->width ||
         frame.height != video_st->CV_FFMPEG_CODEC_FIELD->height ||
+        rgb_picture.format != result_format ||
+        rgb_picture.width != conv.buffer_width ||
+        rgb_picture.height != conv.buffer_height ||
         frame.data == NULL )
     {
-        // Some sws_scale optimizations have some assumptions about alignment of data/step/width/height
-        // Also we use coded_width/height to workaround problem with legacy ffmpeg versions (like n0.8)
-        int buffer_width = context->coded_width, buffer_height = context->coded_height;
+        int buffer_width = conv.buffer_width, buffer_height = conv.buffer_height;
 
         img_convert_ctx = sws_getCachedContext(
                 img_convert_ctx,
-                buffer_width, buffer_height,
-                (AVPixelFormat)sw_picture->format,
+                conv.src_width, conv.src_height,
+                conv.src_format,
                 buffer_width, buffer_height,
                 result_format,
                 SWS_BICUBIC,
@@ -1691,19 +1959,37 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
         rgb_picture.format = result_format;
         rgb_picture.width = buffer_width;
         rgb_picture.height = buffer_height;
-        if (0 != av_frame_get_buffer(&rgb_picture, 32))
+        if (isPackedYUVOutput(output_format))
+        {
+            // the planes are stored without gaps, as cvtColor(COLOR_YUV2BGR_NV12/I420) expects
+            rgb_picture.buf[0] = av_buffer_alloc(av_image_get_buffer_size(result_format, buffer_width, buffer_height, 1));
+            if (!rgb_picture.buf[0])
+            {
+                CV_WARN("OutOfMemory");
+                return false;
+            }
+            av_image_fill_arrays(rgb_picture.data, rgb_picture.linesize, rgb_picture.buf[0]->data,
+                                 result_format, buffer_width, buffer_height, 1);
+        }
+        else if (0 != av_frame_get_buffer(&rgb_picture, 32))
         {
             CV_WARN("OutOfMemory");
             return false;
         }
 #else
-        int aligns[AV_NUM_DATA_POINTERS];
-        avcodec_align_dimensions2(video_st->codec, &buffer_width, &buffer_height, aligns);
+        if (!conv.exact_size)
+        {
+            int aligns[AV_NUM_DATA_POINTERS];
+            avcodec_align_dimensions2(video_st->codec, &buffer_width, &buffer_height, aligns);
+        }
         rgb_picture.data[0] = (uint8_t*)realloc(rgb_picture.data[0],
                 _opencv_ffmpeg_av_image_get_buffer_size( result_format,
                                     buffer_width, buffer_height ));
         _opencv_ffmpeg_av_image_fill_arrays(&rgb_picture, rgb_picture.data[0],
                         result_format, buffer_width, buffer_height );
+        rgb_picture.format = result_format;
+        rgb_picture.width = conv.buffer_width;
+        rgb_picture.height = conv.buffer_height;
 #endif
         frame.width = video_st->CV_FFMPEG_CODEC_FIELD->width;
         frame.height = video_st->CV_FFMPEG_CODEC_FIELD->height;
@@ -1711,10 +1997,12 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
         frame.step = rgb_picture.linesize[0];
     }
 
+    uint8_t* luma_data[4] = { sw_picture->data[0], NULL, NULL, NULL };
+    int luma_linesize[4] = { sw_picture->linesize[0], 0, 0, 0 };
     sws_scale(
             img_convert_ctx,
-            sw_picture->data,
-            sw_picture->linesize,
+            conv.luma_only ? luma_data : sw_picture->data,
+            conv.luma_only ? luma_linesize : sw_picture->linesize,
             0, sw_picture->height,
             rgb_picture.data,
             rgb_picture.linesize
@@ -1722,8 +2010,8 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
 
     *data = frame.data;
     *step = frame.step;
-    *width = frame.width;
-    *height = frame.height;
+    *width = conv.width;
+    *height = isPackedYUVOutput(output_format) ? conv.height * 3 / 2 : conv.height;
 
 #if USE_AV_HW_CODECS
     if (sw_picture != picture)
@@ -1737,6 +2025,10 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
 bool CvCapture_FFMPEG::retrieveHWFrame(cv::OutputArray output)
 {
 #if USE_AV_HW_CODECS
+    // decoded pictures are copied to system memory by the decoding thread
+    if (decode_queue)
+        return false;
+
     // check that we have HW frame in GPU memory
     if (!picture || !picture->hw_frames_ctx || !context) {
         return false;
@@ -1750,6 +2042,372 @@ bool CvCapture_FFMPEG::retrieveHWFrame(cv::OutputArray output)
 #endif
 }
 
+FFmpegDecodeQueue::FFmpegDecodeQueue(CvCapture_FFMPEG* capture_, int queue_size_) :
+    capture(capture_), queue_size((size_t)queue_size_), current(NULL),
+    running(false), stopping(false), eof(false)
+{
+    static const size_t max_conversion_threads = cv::utils::getConfigurationParameterSizeT("OPENCV_FFMPEG_CONVERSION_THREADS", 0);
+    n_converters = max_conversion_threads > 0 ? (int)max_conversion_threads
+                                              : std::max(1, cv::getNumberOfCPUs() / 2);  // the rest is left to the decoder
+    n_converters = std::min(n_converters, queue_size_);
+}
+
+FFmpegDecodeQueue::~FFmpegDecodeQueue()
+{
+    stop();
+    for (size_t i = 0; i < free_entries.size(); i++)
+        delete free_entries[i];
+}
+
+FFmpegDecodeQueue::Entry* FFmpegDecodeQueue::newEntry()
+{
+    if (free_entries.empty())
+        return new Entry();
+    Entry* e = free_entries.back();
+    free_entries.pop_back();
+    return e;
+}
+
+FFmpegDecodeQueue::FrameInfo FFmpegDecodeQueue::captureFrameInfo() const
+{
+    FrameInfo fi;
+    fi.picture_pts = capture->picture_pts;
+    fi.frame_number = capture->frame_number;
+    fi.pict_type = av_get_picture_type_char(capture->picture->pict_type);
+    const AVPacket& p = capture->bsfc ? capture->packet_filtered : capture->packet;
+    fi.key_frame = (p.flags & AV_PKT_FLAG_KEY) != 0;
+    fi.bitrate = capture->get_bitrate();
+    return fi;
+}
+
+void FFmpegDecodeQueue::start()
+{
+    CV_Assert(!running);
+    info = captureFrameInfo();
+    stopping = false;
+    eof = false;
+    error = std::exception_ptr();
+    threads.push_back(std::thread(&FFmpegDecodeQueue::decodeLoop, this));
+    for (int i = 0; i < n_converters; i++)
+        threads.push_back(std::thread(&FFmpegDecodeQueue::convertLoop, this));
+    running = true;
+}
+
+void FFmpegDecodeQueue::stop()
+{
+    if (!running)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        cond.notify_all();
+    }
+    for (size_t i = 0; i < threads.size(); i++)
+        threads[i].join();
+    threads.clear();
+    running = false;
+
+    if (current)
+        queue.push_front(current);
+    current = NULL;
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        Entry* e = queue[i];
+        if (e->picture)
+            av_frame_free(&e->picture);
+        free_entries.push_back(e);
+    }
+    queue.clear();
+}
+
+static AVFrame* cloneDecodedPicture(AVFrame* picture)
+{
+#if USE_AV_HW_CODECS
+    if (picture->hw_frames_ctx)
+    {
+        // the pool of the decoder surfaces is small, so the picture is copied to system memory right away
+        AVFrame* sw_picture = av_frame_alloc();
+        if (sw_picture && av_hwframe_transfer_data(sw_picture, picture, 0) < 0)
+        {
+            CV_LOG_ERROR(NULL, "Error copying data from GPU to CPU (av_hwframe_transfer_data)");
+            av_frame_free(&sw_picture);
+        }
+        return sw_picture;
+    }
+#endif
+#if USE_AV_FRAME_GET_BUFFER
+    return av_frame_clone(picture);
+#else
+    CV_UNUSED(picture);
+    return NULL;
+#endif
+}
+
+void FFmpegDecodeQueue::decodeLoop()
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [this] { return stopping || queue.size() < queue_size; });
+            if (stopping)
+                return;
+        }
+
+        bool valid = false;
+        std::exception_ptr exc;
+        try
+        {
+            valid = capture->readFrame();
+        }
+        catch (...)
+        {
+            exc = std::current_exception();
+        }
+        AVFrame* decoded = valid ? cloneDecodedPicture(capture->picture) : NULL;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!valid)
+        {
+            error = exc;
+            eof = true;
+            cond.notify_all();
+            return;
+        }
+        Entry* e = newEntry();
+        e->picture = decoded;
+        e->coded_width = capture->context->coded_width;
+        e->coded_height = capture->context->coded_height;
+        e->width = capture->video_st->CV_FFMPEG_CODEC_FIELD->width;
+        e->height = capture->video_st->CV_FFMPEG_CODEC_FIELD->height;
+        e->info = captureFrameInfo();
+        e->state = decoded ? Entry::DECODED : Entry::FAILED;
+        queue.push_back(e);
+        cond.notify_all();
+    }
+}
+
+void FFmpegDecodeQueue::convertLoop()
+{
+    struct SwsContext* ctx = NULL;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;)
+    {
+        Entry* e = NULL;
+        cond.wait(lock, [&] {
+            for (size_t i = 0; i < queue.size() && !e; i++)
+                if (queue[i]->state == Entry::DECODED)
+                    e = queue[i];
+            return stopping || e != NULL;
+        });
+        if (stopping)
+            break;
+        e->state = Entry::CONVERTING;
+        lock.unlock();
+
+        bool ok = convert(*e, ctx);
+        av_frame_free(&e->picture);
+
+        lock.lock();
+        e->state = ok ? Entry::READY : Entry::FAILED;
+        cond.notify_all();
+    }
+    lock.unlock();
+    sws_freeContext(ctx);
+}
+
+bool FFmpegDecodeQueue::convert(Entry& e, struct SwsContext*& ctx) const
+{
+    AVFrame* picture = e.picture;
+    if (!picture->data[0])
+        return false;
+
+    // the same conversion as in CvCapture_FFMPEG::retrieveFrame()
+    OutputConversion conv;
+    capture->getOutputConversion(picture, e.width, e.height, e.coded_width, e.coded_height, conv);
+    getPictureFormatType(conv.dst_format, &e.depth, &e.cn);
+    ctx = sws_getCachedContext(
+            ctx,
+            conv.src_width, conv.src_height,
+            conv.src_format,
+            conv.buffer_width, conv.buffer_height,
+            conv.dst_format,
+            SWS_BICUBIC,
+            NULL, NULL, NULL
+            );
+    if (ctx == NULL)
+        return false;
+
+#if USE_AV_FRAME_GET_BUFFER
+    // the planes of YUV output are stored without gaps
+    const int align = isPackedYUVOutput(capture->output_format) ? 1 : 64;
+    const int buffer_size = av_image_get_buffer_size(conv.dst_format, conv.buffer_width, conv.buffer_height, align);
+    if (buffer_size <= 0)
+        return false;
+    e.buffer.create(1, buffer_size, CV_8UC1);  // reallocated only if the size is changed
+
+    uint8_t* dst_data[4] = {};
+    int dst_linesize[4] = {};
+    if (av_image_fill_arrays(dst_data, dst_linesize, e.buffer.data, conv.dst_format, conv.buffer_width, conv.buffer_height, align) < 0)
+        return false;
+    uint8_t* luma_data[4] = { picture->data[0], NULL, NULL, NULL };
+    int luma_linesize[4] = { picture->linesize[0], 0, 0, 0 };
+    sws_scale(ctx,
+              conv.luma_only ? luma_data : picture->data,
+              conv.luma_only ? luma_linesize : picture->linesize,
+              0, picture->height, dst_data, dst_linesize);
+    e.step = dst_linesize[0];
+    e.output_width = conv.width;
+    e.output_height = isPackedYUVOutput(capture->output_format) ? conv.height * 3 / 2 : conv.height;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool FFmpegDecodeQueue::grab()
+{
+    if (!running)
+        return false;
+    std::unique_lock<std::mutex> lock(mutex);
+    if (current)
+    {
+        free_entries.push_back(current);
+        current = NULL;
+    }
+    cond.wait(lock, [this] {
+        return (!queue.empty() && queue.front()->state >= Entry::READY) || (eof && queue.empty());
+    });
+    if (queue.empty())
+    {
+        if (error)
+        {
+            std::exception_ptr exc = error;
+            error = std::exception_ptr();
+            std::rethrow_exception(exc);
+        }
+        return false;
+    }
+    current = queue.front();
+    queue.pop_front();
+    cond.notify_all();
+
+    info = current->info;
+    return true;
+}
+
+bool FFmpegDecodeQueue::retrieve(unsigned char** data, int* step, int* width, int* height, int* cn, int* depth) const
+{
+    if (!current || current->state != Entry::READY)
+        return false;
+    *data = current->buffer.data;
+    *step = current->step;
+    *width = current->output_width;
+    *height = current->output_height;
+    *cn = current->cn;
+    *depth = current->depth;
+    return true;
+}
+
+// keeps a reference to the decoded picture while the Mat headers of its planes exist
+class AVFrameMatAllocator CV_FINAL : public cv::MatAllocator
+{
+public:
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step,
+                           cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const CV_OVERRIDE
+    {
+        // Mat::create() of a header which has been referencing a picture
+        return cv::Mat::getDefaultAllocator()->allocate(dims, sizes, type, data, step, flags, usageFlags);
+    }
+    bool allocate(cv::UMatData* u, cv::AccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const CV_OVERRIDE
+    {
+        return cv::Mat::getDefaultAllocator()->allocate(u, accessFlags, usageFlags);
+    }
+    void deallocate(cv::UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        AVFrame* picture = (AVFrame*)u->userdata;
+        av_frame_free(&picture);
+        delete u;
+    }
+
+    static AVFrameMatAllocator* getInstance()
+    {
+        static AVFrameMatAllocator instance;
+        return &instance;
+    }
+};
+
+bool CvCapture_FFMPEG::retrieveFramePlanes(std::vector<cv::Mat>& planes, bool separate_planes)
+{
+    if (output_format == CAP_OUTPUT_FORMAT_BGR || rawMode || decode_queue || !context || !picture || !picture->data[0])
+        return false;
+    // the planes of the decoder are not stored one after another
+    if (!separate_planes && output_format != CAP_OUTPUT_FORMAT_GRAY)
+        return false;
+
+    // the decoder may still reference the buffers of the picture (e.g. for the prediction of the next frames),
+    // such buffers are copied, so the returned planes can be modified
+    AVFrame* ref = cloneDecodedPicture(picture);
+#if USE_AV_FRAME_GET_BUFFER
+    if (ref && av_frame_make_writable(ref) < 0)
+        av_frame_free(&ref);
+#endif
+    if (!ref)
+        return false;
+    const AVPixelFormat format = (AVPixelFormat)ref->format;
+    const int width = ref->width, height = ref->height;
+    bool valid = (output_width <= 0 || output_width == width) && (output_height <= 0 || output_height == height);
+    switch (output_format)
+    {
+    case CAP_OUTPUT_FORMAT_GRAY:
+        valid = valid && hasLumaPlane(format);
+        break;
+    case CAP_OUTPUT_FORMAT_NV12:
+        valid = valid && format == AV_PIX_FMT_NV12 && width % 2 == 0 && height % 2 == 0 && ref->linesize[1] > 0;
+        break;
+    case CAP_OUTPUT_FORMAT_I420:
+        valid = valid && (format == AV_PIX_FMT_YUV420P || format == AV_PIX_FMT_YUVJ420P) &&
+                width % 2 == 0 && height % 2 == 0 && ref->linesize[1] > 0 && ref->linesize[2] > 0;
+        break;
+    default:
+        valid = false;
+    }
+    if (!valid || ref->linesize[0] <= 0)
+    {
+        av_frame_free(&ref);
+        return false;  // converted with sws_scale
+    }
+
+    AVFrameMatAllocator* allocator = AVFrameMatAllocator::getInstance();
+    cv::UMatData* u = new cv::UMatData(allocator);
+    u->data = u->origdata = ref->data[0];
+    u->size = (size_t)ref->linesize[0] * height;
+    u->userdata = ref;
+
+    planes.clear();
+    planes.push_back(cv::Mat(height, width, CV_8UC1, ref->data[0], ref->linesize[0]));
+    if (output_format == CAP_OUTPUT_FORMAT_NV12)
+    {
+        planes.push_back(cv::Mat(height / 2, width / 2, CV_8UC2, ref->data[1], ref->linesize[1]));
+    }
+    else if (output_format == CAP_OUTPUT_FORMAT_I420)
+    {
+        planes.push_back(cv::Mat(height / 2, width / 2, CV_8UC1, ref->data[1], ref->linesize[1]));
+        planes.push_back(cv::Mat(height / 2, width / 2, CV_8UC1, ref->data[2], ref->linesize[2]));
+    }
+    for (size_t i = 0; i < planes.size(); i++)
+    {
+        planes[i].allocator = allocator;
+        planes[i].u = u;
+        planes[i].addref();
+    }
+    return true;
+}
+
 static inline double getCodecTag(const AVCodecID codec_id) {
     const struct AVCodecTag* fallback_tags[] = {
         // APIchanges:
@@ -1783,22 +2441,31 @@ double CvCapture_FFMPEG::getProperty( int property_id ) const
     switch( property_id )
     {
     case CAP_PROP_POS_MSEC:
-        if (picture_pts == AV_NOPTS_VALUE_)
+    {
+        const int64_t pts = decode_queue ? decode_queue->getFrameInfo().picture_pts : picture_pts;
+        if (pts == AV_NOPTS_VALUE_)
         {
             return 0;
         }
-        return (dts_to_sec(picture_pts) * 1000);
+        return (dts_to_sec(pts) * 1000);
+    }
     case CAP_PROP_POS_FRAMES:
-        return (double)frame_number;
+        return (double)(decode_queue ? decode_queue->getFrameInfo().frame_number : frame_number);
     case CAP_PROP_POS_AVI_RATIO:
         return r2d(ic->streams[video_stream]->time_base);
     case CAP_PROP_FRAME_COUNT:
         return (double)get_total_frames();
     case CAP_PROP_FRAME_WIDTH:
-        return (double)((rotation_auto && ((rotation_angle%180) != 0)) ? frame.height : frame.width);
     case CAP_PROP_FRAME_HEIGHT:
-        return (double)((rotation_auto && ((rotation_angle%180) != 0)) ? frame.width : frame.height);
+    {
+        // size of the retrieved frames, NV12 and I420 frames are not rotated
+        const cv::Size size = getOutputSize(frame.width, frame.height);
+        const bool rotated = rotation_auto && (rotation_angle % 180) != 0 && !isPackedYUVOutput(output_format);
+        return (double)((property_id == CAP_PROP_FRAME_WIDTH) != rotated ? size.width : size.height);
+    }
     case CAP_PROP_FRAME_TYPE:
+        if (decode_queue)
+            return (double)decode_queue->getFrameInfo().pict_type;
         return (double)av_get_picture_type_char(picture->pict_type);
     case CAP_PROP_FPS:
         return get_fps();
@@ -1829,14 +2496,22 @@ double CvCapture_FFMPEG::getProperty( int property_id ) const
         break;
     case CAP_PROP_CONVERT_RGB:
         return convertRGB;
+    case CAP_PROP_OUTPUT_FORMAT:
+        return output_format;
+    case CAP_PROP_OUTPUT_WIDTH:
+        return output_width;
+    case CAP_PROP_OUTPUT_HEIGHT:
+        return output_height;
     case CAP_PROP_LRF_HAS_KEY_FRAME: {
+        if (decode_queue)
+            return decode_queue->getFrameInfo().key_frame ? 1 : 0;
         const AVPacket& p = bsfc ? packet_filtered : packet;
         return ((p.flags & AV_PKT_FLAG_KEY) != 0) ? 1 : 0;
     }
     case CAP_PROP_CODEC_EXTRADATA_INDEX:
             return extraDataIdx;
     case CAP_PROP_BITRATE:
-        return static_cast<double>(get_bitrate());
+        return static_cast<double>(decode_queue ? decode_queue->getFrameInfo().bitrate : get_bitrate());
     case CAP_PROP_ORIENTATION_META:
         return static_cast<double>(rotation_angle);
     case CAP_PROP_ORIENTATION_AUTO:
@@ -1964,7 +2639,7 @@ void CvCapture_FFMPEG::seek(int64_t _frame_number)
     // if we have not grabbed a single frame before first seek, let's read the first frame
     // and get some valuable information during the process
     if( first_frame_number < 0 && get_total_frames() > 1 )
-        grabFrame();
+        readFrame();
 
     for(;;)
     {
@@ -1978,7 +2653,7 @@ void CvCapture_FFMPEG::seek(int64_t _frame_number)
             avcodec_flush_buffers(context);
         if( _frame_number > 0 )
         {
-            grabFrame();
+            readFrame();
 
             if( _frame_number > 1 )
             {
@@ -1999,7 +2674,7 @@ void CvCapture_FFMPEG::seek(int64_t _frame_number)
                 }
                 while( frame_number < _frame_number-1 )
                 {
-                    if(!grabFrame())
+                    if(!readFrame())
                         break;
                 }
                 frame_number++;
@@ -2034,6 +2709,9 @@ bool CvCapture_FFMPEG::setProperty( int property_id, double value )
     case CAP_PROP_POS_FRAMES:
     case CAP_PROP_POS_AVI_RATIO:
         {
+            if (decode_queue)
+                decode_queue->stop();
+
             switch( property_id )
             {
             case CAP_PROP_POS_FRAMES:
@@ -2050,6 +2728,9 @@ bool CvCapture_FFMPEG::setProperty( int property_id, double value )
             }
 
             picture_pts=(int64_t)value;
+
+            if (decode_queue)
+                decode_queue->start();
         }
         break;
     case CAP_PROP_FORMAT:
@@ -2057,8 +2738,21 @@ bool CvCapture_FFMPEG::setProperty( int property_id, double value )
             return setRaw();
         return false;
     case CAP_PROP_CONVERT_RGB:
+        if (decode_queue)
+            return false;  // frames are converted in advance
         convertRGB = (value != 0);
         return true;
+    case CAP_PROP_OUTPUT_FORMAT:
+        if (decode_queue || value < CAP_OUTPUT_FORMAT_BGR || value > CAP_OUTPUT_FORMAT_I420)
+            return false;
+        output_format = cvRound(value);
+        return true;
+    case CAP_PROP_OUTPUT_WIDTH:
+    case CAP_PROP_OUTPUT_HEIGHT:
+        if (decode_queue || value < 0)
+            return false;
+        (property_id == CAP_PROP_OUTPUT_WIDTH ? output_width : output_height) = cvRound(value);
+        return true;
     case CAP_PROP_ORIENTATION_AUTO:
 #if LIBAVUTIL_BUILD >= CALC_FFMPEG_VERSION(52, 94, 100)
         rotation_auto = value != 0 ? true : false;
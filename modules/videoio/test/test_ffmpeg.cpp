@@ -808,6 +808,144 @@ TEST(videoio_ffmpeg, create_with_property_badarg)
     EXPECT_FALSE(cap.isOpened());
 }
 
+TEST(videoio_ffmpeg, decode_queue)
+{
+    if (!videoio_registry::hasBackend(CAP_FFMPEG))
+        throw SkipTestException("FFmpeg backend was not found");
+
+    string video_file = findDataFile("video/big_buck_bunny.mp4");
+    VideoCapture cap(video_file, CAP_FFMPEG);
+    VideoCapture capAsync(video_file, CAP_FFMPEG, { CAP_PROP_DECODE_QUEUE_SIZE, 4 });
+    ASSERT_TRUE(cap.isOpened());
+    ASSERT_TRUE(capAsync.isOpened());
+    EXPECT_FALSE(capAsync.set(CAP_PROP_CONVERT_RGB, 0));
+
+    Mat frame, frameAsync;
+    int n = 0;
+    for (;; n++)
+    {
+        SCOPED_TRACE(cv::format("frame=%d", n));
+        if (n == 50)
+        {
+            // seek restarts the decoding threads
+            ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, 100));
+            ASSERT_TRUE(capAsync.set(CAP_PROP_POS_FRAMES, 100));
+        }
+        const bool res = cap.read(frame);
+        ASSERT_EQ(res, capAsync.read(frameAsync));
+        if (!res)
+            break;
+        EXPECT_EQ(cap.get(CAP_PROP_POS_FRAMES), capAsync.get(CAP_PROP_POS_FRAMES));
+        EXPECT_EQ(cap.get(CAP_PROP_POS_MSEC), capAsync.get(CAP_PROP_POS_MSEC));
+        EXPECT_EQ(cap.get(CAP_PROP_FRAME_TYPE), capAsync.get(CAP_PROP_FRAME_TYPE));
+        ASSERT_EQ(0, cvtest::norm(frame, frameAsync, NORM_INF));
+    }
+    EXPECT_EQ(75, n);
+}
+
+TEST(videoio_ffmpeg, decode_queue_badarg)
+{
+    if (!videoio_registry::hasBackend(CAP_FFMPEG))
+        throw SkipTestException("FFmpeg backend was not found");
+
+    string video_file = findDataFile("video/big_buck_bunny.mp4");
+    VideoCapture cap(video_file, CAP_FFMPEG, {
+        CAP_PROP_FORMAT, -1,  // demux only
+        CAP_PROP_DECODE_QUEUE_SIZE, 4
+    });
+    EXPECT_FALSE(cap.isOpened());
+}
+
+TEST(videoio_ffmpeg, output_format_yuv)
+{
+    if (!videoio_registry::hasBackend(CAP_FFMPEG))
+        throw SkipTestException("FFmpeg backend was not found");
+
+    string video_file = findDataFile("video/big_buck_bunny.mp4");
+    VideoCapture capGray(video_file, CAP_FFMPEG, { CAP_PROP_OUTPUT_FORMAT, CAP_OUTPUT_FORMAT_GRAY });
+    VideoCapture capI420(video_file, CAP_FFMPEG, { CAP_PROP_OUTPUT_FORMAT, CAP_OUTPUT_FORMAT_I420 });
+    VideoCapture capNV12(video_file, CAP_FFMPEG, { CAP_PROP_OUTPUT_FORMAT, CAP_OUTPUT_FORMAT_NV12 });
+    ASSERT_TRUE(capGray.isOpened());
+    ASSERT_TRUE(capI420.isOpened());
+    ASSERT_TRUE(capNV12.isOpened());
+    EXPECT_EQ(CAP_OUTPUT_FORMAT_I420, capI420.get(CAP_PROP_OUTPUT_FORMAT));
+
+    const Size sz(672, 384);
+    for (int i = 0; i < 10; i++)
+    {
+        SCOPED_TRACE(cv::format("frame=%d", i));
+        Mat gray, i420;
+        std::vector<Mat> planes;
+        ASSERT_TRUE(capGray.read(gray));
+        ASSERT_TRUE(capI420.read(i420));
+        ASSERT_TRUE(capNV12.read(planes));
+
+        ASSERT_EQ(CV_8UC1, gray.type());
+        ASSERT_EQ(sz, gray.size());
+        ASSERT_EQ(CV_8UC1, i420.type());
+        ASSERT_EQ(Size(sz.width, sz.height * 3 / 2), i420.size());
+        EXPECT_EQ(0, cvtest::norm(gray, i420.rowRange(0, sz.height), NORM_INF));
+
+        ASSERT_EQ(2u, planes.size());
+        ASSERT_EQ(CV_8UC2, planes[1].type());
+        ASSERT_EQ(Size(sz.width / 2, sz.height / 2), planes[1].size());
+        EXPECT_EQ(0, cvtest::norm(gray, planes[0], NORM_INF));
+        // planes of the same picture in NV12 and I420 layouts
+        Mat uv[2];
+        split(planes[1], uv);
+        const int chroma = sz.width * sz.height / 4;
+        EXPECT_EQ(0, cvtest::norm(uv[0].reshape(1, 1), i420.reshape(1, 1).colRange(sz.area(), sz.area() + chroma), NORM_INF));
+        EXPECT_EQ(0, cvtest::norm(uv[1].reshape(1, 1), i420.reshape(1, 1).colRange(sz.area() + chroma, sz.area() + 2 * chroma), NORM_INF));
+    }
+}
+
+TEST(videoio_ffmpeg, output_size)
+{
+    if (!videoio_registry::hasBackend(CAP_FFMPEG))
+        throw SkipTestException("FFmpeg backend was not found");
+
+    string video_file = findDataFile("video/big_buck_bunny.mp4");
+    VideoCapture cap(video_file, CAP_FFMPEG, { CAP_PROP_OUTPUT_WIDTH, 336 });
+    ASSERT_TRUE(cap.isOpened());
+    Mat frame;
+    ASSERT_TRUE(cap.read(frame));
+    EXPECT_EQ(CV_8UC3, frame.type());
+    EXPECT_EQ(Size(336, 192), frame.size());
+    EXPECT_EQ(336, cap.get(CAP_PROP_FRAME_WIDTH));
+    EXPECT_EQ(192, cap.get(CAP_PROP_FRAME_HEIGHT));
+
+    ASSERT_TRUE(cap.set(CAP_PROP_OUTPUT_FORMAT, CAP_OUTPUT_FORMAT_GRAY));
+    ASSERT_TRUE(cap.set(CAP_PROP_OUTPUT_HEIGHT, 96));
+    ASSERT_TRUE(cap.read(frame));
+    EXPECT_EQ(CV_8UC1, frame.type());
+    EXPECT_EQ(Size(336, 96), frame.size());
+    EXPECT_EQ(336, cap.get(CAP_PROP_FRAME_WIDTH));
+    EXPECT_EQ(96, cap.get(CAP_PROP_FRAME_HEIGHT));
+}
+
+TEST(videoio_ffmpeg, output_format_planes_writable)
+{
+    if (!videoio_registry::hasBackend(CAP_FFMPEG))
+        throw SkipTestException("FFmpeg backend was not found");
+
+    string video_file = findDataFile("video/big_buck_bunny.mp4");
+    VideoCapture cap(video_file, CAP_FFMPEG, { CAP_PROP_OUTPUT_FORMAT, CAP_OUTPUT_FORMAT_GRAY });
+    VideoCapture ref(video_file, CAP_FFMPEG, { CAP_PROP_OUTPUT_FORMAT, CAP_OUTPUT_FORMAT_GRAY });
+    ASSERT_TRUE(cap.isOpened());
+    ASSERT_TRUE(ref.isOpened());
+    for (int i = 0; i < 10; i++)
+    {
+        SCOPED_TRACE(cv::format("frame=%d", i));
+        Mat frame, expected;
+        ASSERT_TRUE(cap.read(frame));
+        ASSERT_TRUE(ref.read(expected));
+        expected = expected.clone();
+        EXPECT_EQ(0, cvtest::norm(frame, expected, NORM_INF));
+        // the next frames are predicted from this one, they must not change
+        frame.setTo(Scalar::all(255));
+    }
+}
+
 // related issue: https://github.com/opencv/opencv/issues/16821
 TEST(videoio_ffmpeg, DISABLED_open_from_web)
 {